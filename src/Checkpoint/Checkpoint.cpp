@@ -400,6 +400,9 @@ void Checkpoint::dumpPatch( ElectroMagn *EMfields, std::vector<Species *> vecSpe
     H5Fflush( patch_gid, H5F_SCOPE_GLOBAL );
     H5::attr( patch_gid, "species", vecSpecies.size() );
     
+    // Momentum and weight are stored in their in-memory precision
+    hid_t pdouble_type = ( sizeof( pdouble ) == sizeof( double ) ) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+    
     for( unsigned int ispec=0 ; ispec<vecSpecies.size() ; ispec++ ) {
         ostringstream name( "" );
         name << setfill( '0' ) << setw( 2 ) << ispec;
@@ -416,17 +419,17 @@ void Checkpoint::dumpPatch( ElectroMagn *EMfields, std::vector<Species *> vecSpe
             for( unsigned int i=0; i<vecSpecies[ispec]->particles->Position.size(); i++ ) {
                 ostringstream my_name( "" );
                 my_name << "Position-" << i;
-                H5::vect( gid, my_name.str(), vecSpecies[ispec]->particles->Position[i], dump_deflate );
+                H5::vect( gid, my_name.str(), vecSpecies[ispec]->particles->Position[i], H5T_NATIVE_DOUBLE, dump_deflate );
             }
             
             for( unsigned int i=0; i<vecSpecies[ispec]->particles->Momentum.size(); i++ ) {
                 ostringstream my_name( "" );
                 my_name << "Momentum-" << i;
-                H5::vect( gid, my_name.str(), vecSpecies[ispec]->particles->Momentum[i], dump_deflate );
+                H5::vect( gid, my_name.str(), vecSpecies[ispec]->particles->Momentum[i], pdouble_type, dump_deflate );
             }
             
-            H5::vect( gid, "Weight", vecSpecies[ispec]->particles->Weight, dump_deflate );
-            H5::vect( gid, "Charge", vecSpecies[ispec]->particles->Charge, dump_deflate );
+            H5::vect( gid, "Weight", vecSpecies[ispec]->particles->Weight, pdouble_type, dump_deflate );
+            H5::vect( gid, "Charge", vecSpecies[ispec]->particles->Charge, H5T_NATIVE_SHORT, dump_deflate );
             
             if( vecSpecies[ispec]->particles->tracked ) {
                 H5::vect( gid, "Id", vecSpecies[ispec]->particles->Id, H5T_NATIVE_UINT64, dump_deflate );
@@ -699,6 +702,8 @@ void Checkpoint::restartPatch( ElectroMagn *EMfields, std::vector<Species *> &ve
         ERROR( "Number of species differs between dump (" << vecSpeciesSize << ") and namelist ("<<vecSpecies.size()<<")" );
     }
     
+    // HDF5 converts momentum and weight if the dump was made with another precision
+    hid_t pdouble_type = ( sizeof( pdouble ) == sizeof( double ) ) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
     
     for( unsigned int ispec=0 ; ispec<vecSpecies.size() ; ispec++ ) {
         ostringstream name( "" );
@@ -724,18 +729,18 @@ void Checkpoint::restartPatch( ElectroMagn *EMfields, std::vector<Species *> &ve
             for( unsigned int i=0; i<vecSpecies[ispec]->particles->Position.size(); i++ ) {
                 ostringstream namePos( "" );
                 namePos << "Position-" << i;
-                H5::getVect( gid, namePos.str(), vecSpecies[ispec]->particles->Position[i] );
+                H5::getVect( gid, namePos.str(), vecSpecies[ispec]->particles->Position[i], H5T_NATIVE_DOUBLE );
             }
             
             for( unsigned int i=0; i<vecSpecies[ispec]->particles->Momentum.size(); i++ ) {
                 ostringstream namePos( "" );
                 namePos << "Momentum-" << i;
-                H5::getVect( gid, namePos.str(), vecSpecies[ispec]->particles->Momentum[i] );
+                H5::getVect( gid, namePos.str(), vecSpecies[ispec]->particles->Momentum[i], pdouble_type );
             }
             
-            H5::getVect( gid, "Weight", vecSpecies[ispec]->particles->Weight );
+            H5::getVect( gid, "Weight", vecSpecies[ispec]->particles->Weight, pdouble_type );
             
-            H5::getVect( gid, "Charge", vecSpecies[ispec]->particles->Charge );
+            H5::getVect( gid, "Charge", vecSpecies[ispec]->particles->Charge, H5T_NATIVE_SHORT );
             
             if( vecSpecies[ispec]->particles->tracked ) {
                 H5::getVect( gid, "Id", vecSpecies[ispec]->particles->Id, H5T_NATIVE_UINT64 );
@@ -757,29 +762,38 @@ void Checkpoint::restartPatch( ElectroMagn *EMfields, std::vector<Species *> &ve
 
 void Checkpoint::dumpFieldsPerProc( hid_t fid, Field *field )
 {
-    hsize_t dims[1]= {field->globalDims_};
+    hsize_t dims[1]= {field->unpaddedSize()};
     hid_t sid = H5Screate_simple( 1, dims, NULL );
-    hid_t did = H5Dcreate( fid, field->name.c_str(), H5T_NATIVE_DOUBLE, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
-    H5Dwrite( did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &field->data_[0] );
+    hid_t mid = fieldMemspace( field, 1 );
+    // Real fields are stored in their in-memory precision
+    hid_t fdouble_type = ( sizeof( fdouble ) == sizeof( double ) ) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+    hid_t did = H5Dcreate( fid, field->name.c_str(), fdouble_type, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    H5Dwrite( did, fdouble_type, mid, H5S_ALL, H5P_DEFAULT, &field->data_[0] );
     H5Dclose( did );
+    H5Sclose( mid );
     H5Sclose( sid );
 }
 
 void Checkpoint::dump_cFieldsPerProc( hid_t fid, Field *field )
 {
     cField *cfield = static_cast<cField *>( field );
-    hsize_t dims[1]= {2*field->globalDims_}; //*2 : to manage complex data
+    hsize_t dims[1]= {2*field->unpaddedSize()}; //*2 : to manage complex data
     hid_t sid = H5Screate_simple( 1, dims, NULL );
+    hid_t mid = fieldMemspace( field, 2 );
     hid_t did = H5Dcreate( fid, field->name.c_str(), H5T_NATIVE_DOUBLE, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
-    H5Dwrite( did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &cfield->cdata_[0] );
+    H5Dwrite( did, H5T_NATIVE_DOUBLE, mid, H5S_ALL, H5P_DEFAULT, &cfield->cdata_[0] );
     H5Dclose( did );
+    H5Sclose( mid );
     H5Sclose( sid );
 }
 
 void Checkpoint::restartFieldsPerProc( hid_t fid, Field *field )
 {
     hid_t did = H5Dopen( fid, field->name.c_str(), H5P_DEFAULT );
-    H5Dread( did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &field->data_[0] );
+    hid_t mid = fieldMemspace( field, 1 );
+    hid_t fdouble_type = ( sizeof( fdouble ) == sizeof( double ) ) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+    H5Dread( did, fdouble_type, mid, H5S_ALL, H5P_DEFAULT, &field->data_[0] );
+    H5Sclose( mid );
     H5Dclose( did );
 }
 
@@ -787,10 +801,24 @@ void Checkpoint::restart_cFieldsPerProc( hid_t fid, Field *field )
 {
     cField *cfield = static_cast<cField *>( field );
     hid_t did = H5Dopen( fid, field->name.c_str(), H5P_DEFAULT );
-    H5Dread( did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &cfield->cdata_[0] );
+    hid_t mid = fieldMemspace( field, 2 );
+    H5Dread( did, H5T_NATIVE_DOUBLE, mid, H5S_ALL, H5P_DEFAULT, &cfield->cdata_[0] );
+    H5Sclose( mid );
     H5Dclose( did );
 }
 
+hid_t Checkpoint::fieldMemspace( Field *field, hsize_t nval )
+{
+    // The field is seen as rows along its last dimension, of which only the first dims_.back() values are selected
+    hsize_t nrows = field->globalDims_ / field->paddedDims_.back();
+    hsize_t dims[2]  = { nrows, nval*field->paddedDims_.back() };
+    hsize_t start[2] = { 0, 0 };
+    hsize_t count[2] = { nrows, nval*field->dims_.back() };
+    hid_t mid = H5Screate_simple( 2, dims, NULL );
+    H5Sselect_hyperslab( mid, H5S_SELECT_SET, start, NULL, count, NULL );
+    return mid;
+}
+
 void Checkpoint::dumpMovingWindow( hid_t fid, SimWindow *simWin )
 {
     H5::attr( fid, "x_moved", simWin->getXmoved() );
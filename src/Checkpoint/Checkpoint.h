@@ -105,6 +105,9 @@ private:
     void dumpFieldsPerProc( hid_t fid, Field *field );
     void dump_cFieldsPerProc( hid_t fid, Field *field );
     
+    //! memory dataspace of a field (nval doubles per value), the padding of the rows being excluded
+    hid_t fieldMemspace( Field *field, hsize_t nval );
+    
     //! dump moving window parameters
     void dumpMovingWindow( hid_t fid, SimWindow *simWindow );
     
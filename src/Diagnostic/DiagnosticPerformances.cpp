@@ -2,11 +2,12 @@
 #include <iomanip>
 
 #include "DiagnosticPerformances.h"
+#include "MemoryArena.h"
 
 
 using namespace std;
 
-const unsigned int n_quantities_double = 14;
+const unsigned int n_quantities_double = 16;
 const unsigned int n_quantities_uint   = 4;
 
 // Constructor
@@ -112,6 +113,8 @@ void DiagnosticPerformances::openFile( Params &params, SmileiMPI *smpi, bool new
         quantities_double[11] = "timer_diags"     ;
         quantities_double[12] = "timer_total"     ;
         quantities_double[13] = "memory_total"     ;
+        quantities_double[14] = "allocations_system"  ;
+        quantities_double[15] = "allocations_recycled";
         H5::attr( fileId_, "quantities_double", quantities_double );
         
     } else {
@@ -253,6 +256,10 @@ void DiagnosticPerformances::run( SmileiMPI *smpi, VectorPatch &vecPatches, int
         
         quantities_double[13] = Tools::getMemFootPrint();
         
+        // Particle arrays obtained from the system or reused from the thread caches
+        quantities_double[14] = ( double )MemoryArena::getSystemAllocations();
+        quantities_double[15] = ( double )MemoryArena::getRecycledAllocations();
+        
         // Write doubles to file
         hid_t dset_double  = H5Dcreate( iteration_group_id, "quantities_double", H5T_NATIVE_DOUBLE, filespace_double, H5P_DEFAULT, create_plist, H5P_DEFAULT );
         H5Dwrite( dset_double, H5T_NATIVE_DOUBLE, memspace_double, filespace_double, write_plist, &quantities_double[0] );
@@ -595,10 +595,8 @@ void DiagnosticProbes::run( SmileiMPI *smpi, VectorPatch &vecPatches, int timest
             
             // Store the positions of all particles, unless done already
             if( !positions_written ) {
-                vector<unsigned int> posArraySize( 2 );
-                posArraySize[0] = nPart_MPI;
-                posArraySize[1] = nDim_particle;
-                Field2D *posArray = new Field2D( posArraySize );
+                // (kept in double precision, whatever the precision of the fields)
+                vector<double> posArray( nPart_MPI*nDim_particle );
                 unsigned int ipart = 0;
                 for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
                     if( ipart>=nPart_MPI ) {
@@ -607,9 +605,9 @@ void DiagnosticProbes::run( SmileiMPI *smpi, VectorPatch &vecPatches, int timest
                     Particles *particles = &( vecPatches( ipatch )->probes[probe_n]->particles );
                     for( unsigned int ip=0 ; ip<particles->size() ; ip++ ) {
                         for( unsigned int idim=0 ; idim<nDim_particle  ; idim++ ) {
-                            ( *posArray )( ipart, idim ) = particles->position( idim, ip );
+                            posArray[ipart*nDim_particle+idim] = particles->position( idim, ip );
                         }
-                        ( *posArray )( ipart, 0 ) -= x_moved;
+                        posArray[ipart*nDim_particle] -= x_moved;
                         ipart++;
                     }
                 }
@@ -643,7 +641,7 @@ void DiagnosticProbes::run( SmileiMPI *smpi, VectorPatch &vecPatches, int timest
                 H5Pclose( plist_id );
                 // Write
                 if( nPart_MPI>0 ) {
-                    H5Dwrite( dset_id, H5T_NATIVE_DOUBLE, memspace, filespace, transfer, &( ( *posArray )( 0, 0 ) ) );
+                    H5Dwrite( dset_id, H5T_NATIVE_DOUBLE, memspace, filespace, transfer, &posArray[0] );
                 } else {
                     H5Dwrite( dset_id, H5T_NATIVE_DOUBLE, memspace, filespace, transfer, NULL );
                 }
@@ -652,7 +650,6 @@ void DiagnosticProbes::run( SmileiMPI *smpi, VectorPatch &vecPatches, int timest
                 H5Sclose( filespace );
                 H5Sclose( memspace );
                 
-                delete posArray;
                 H5Fflush( fileId_, H5F_SCOPE_GLOBAL );
                 positions_written = true;
             }
@@ -707,15 +704,18 @@ void DiagnosticProbes::run( SmileiMPI *smpi, VectorPatch &vecPatches, int timest
         }
         
         // Interpolate the species-related fields
+        vector<double> FieldLoc( npart );
         for( unsigned int ifield=0; ifield<fieldindex.size(); ifield++ ) {
             int istart( 0 ), iend( npart );
-            double *FieldLoc = &( ( *probesArray )( fieldlocation[13+ifield], offset_in_MPI[ipatch] ) );
             vecPatches( ipatch )->probesInterp->oneField(
                 vecPatches( ipatch )->EMfields->allFields[fieldindex[ifield]],
                 vecPatches( ipatch )->probes[probe_n]->particles,
                 &istart, &iend,
-                FieldLoc
+                FieldLoc.data()
             );
+            for( unsigned int ipart=0; ipart<npart; ipart++ ) {
+                ( *probesArray )( fieldlocation[13+ifield], offset_in_MPI[ipatch]+ipart ) = FieldLoc[ipart];
+            }
         }
         
         // Probes for envelope
@@ -770,8 +770,9 @@ void DiagnosticProbes::run( SmileiMPI *smpi, VectorPatch &vecPatches, int timest
         // Define transfer
         hid_t transfer = H5Pcreate( H5P_DATASET_XFER );
         H5Pset_dxpl_mpio( transfer, H5FD_MPIO_INDEPENDENT );
-        // Write
-        H5Dwrite( dset_id, H5T_NATIVE_DOUBLE, memspace, filespace, transfer, probesArray->data_ );
+        // Write (converted to double if the fields are stored in single precision)
+        hid_t fdouble_type = ( sizeof( fdouble ) == sizeof( double ) ) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+        H5Dwrite( dset_id, fdouble_type, memspace, filespace, transfer, probesArray->data_ );
         
         // Write x_moved
         H5::attr( dset_id, "x_moved", x_moved );
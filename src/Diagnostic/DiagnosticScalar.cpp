@@ -196,6 +196,7 @@ void DiagnosticScalar::init( Params &params, SmileiMPI *smpi, VectorPatch &vecPa
                                        || allowedKey( Tools::merge( "Zavg_", species_name ) )
                                        || allowedKey( Tools::merge( "Ukin_", species_name ) )
                                        || allowedKey( Tools::merge( "Urad_", species_name ) )
+                                       || allowedKey( Tools::merge( "Nmerged_", species_name ) )
                                        || allowedKey( "UmBWpairs" );
         }
     }
@@ -238,7 +239,7 @@ void DiagnosticScalar::init( Params &params, SmileiMPI *smpi, VectorPatch &vecPa
     // 2 - Prepare the Scalar* objects that will contain the data
     // ----------------------------------------------------------
     
-    values_SUM   .reserve( 13 + nspec*5 + 6 + 2*npoy );
+    values_SUM   .reserve( 13 + nspec*6 + 6 + 2*npoy );
     
     if( !params.Laser_Envelope_model ) {
         values_MINLOC.reserve( 10 );
@@ -270,6 +271,7 @@ void DiagnosticScalar::init( Params &params, SmileiMPI *smpi, VectorPatch &vecPa
     sZavg.resize( nspec, NULL );
     sUkin.resize( nspec, NULL );
     sUrad.resize( nspec, NULL );
+    sNmerged.resize( nspec, NULL );
     for( unsigned int ispec=0; ispec<nspec; ispec++ ) {
         if( ! vecPatches( 0 )->vecSpecies[ispec]->particles->is_test ) {
             species_name = vecPatches( 0 )->vecSpecies[ispec]->name;
@@ -278,6 +280,9 @@ void DiagnosticScalar::init( Params &params, SmileiMPI *smpi, VectorPatch &vecPa
             sZavg[ispec] = newScalar_SUM( Tools::merge( "Zavg_", species_name ) );
             sUkin[ispec] = newScalar_SUM( Tools::merge( "Ukin_", species_name ) );
             sUrad[ispec] = newScalar_SUM( Tools::merge( "Urad_", species_name ) );
+            if( vecPatches( 0 )->vecSpecies[ispec]->Merge ) {
+                sNmerged[ispec] = newScalar_SUM( Tools::merge( "Nmerged_", species_name ) );
+            }
         }
     }
     
@@ -466,6 +471,11 @@ void DiagnosticScalar::compute( Patch *patch, int timestep )
                 Urad_         += vecSpecies[ispec]->getNrjRadiation();
             }
             
+            // If merging activated, number of particles removed since the last output
+            if( vecSpecies[ispec]->Merge ) {
+                *sNmerged[ispec] += vecSpecies[ispec]->nmerged_particles;
+            }
+            
             // If multiphoton Breit-Wheeler activated for photons
             // increment the total pair energy from this process
             if( vecSpecies[ispec]->Multiphoton_Breit_Wheeler_process ) {
@@ -619,7 +629,7 @@ void DiagnosticScalar::compute( Patch *patch, int timestep )
             for( unsigned int i=0 ; i<field->isDual_.size() ; i++ ) {
                 iFieldStart[i] = EMfields->istart[i][field->isDual( i )];
                 iFieldEnd [i] = iFieldStart[i] + EMfields->bufsize[i][field->isDual( i )];
-                iFieldGlobalSize [i] = field->dims_[i];
+                iFieldGlobalSize [i] = field->paddedDims_[i];
             }
             
             unsigned int iifield= iFieldStart[2] + iFieldStart[1]*iFieldGlobalSize[2] +iFieldStart[0]*iFieldGlobalSize[1]*iFieldGlobalSize[2];
@@ -764,6 +774,9 @@ uint64_t DiagnosticScalar::getDiskFootPrint( int istart, int istop, Patch *patch
             scalars.push_back( Tools::merge( "Zavg_", species_name ) );
             scalars.push_back( Tools::merge( "Ukin_", species_name ) );
             scalars.push_back( Tools::merge( "Urad_", species_name ) );
+            if( patch->vecSpecies[ispec]->Merge ) {
+                scalars.push_back( Tools::merge( "Nmerged_", species_name ) );
+            }
         }
     }
     // 3 - Field scalars
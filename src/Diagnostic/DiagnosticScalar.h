@@ -209,6 +209,8 @@ private :
     std::vector<Scalar_value *> sDens, sNtot, sZavg, sUkin, fieldUelm;
     // For the radiated energy per species
     std::vector<Scalar_value *> sUrad;
+    // For the number of particles removed by the merging per species
+    std::vector<Scalar_value *> sNmerged;
     std::vector<Scalar_value_location *> fieldMin, fieldMax;
     std::vector<Scalar_value *> poy, poyInst;
     
@@ -388,7 +388,7 @@ void DiagnosticTrack::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
     #pragma omp master
     data_uint64.resize( nParticles_local, 1 );
     #pragma omp barrier
-    fill_buffer( vecPatches, 0, data_uint64 );
+    fill_buffer( vecPatches, &Particles::uint64_prop, 0, data_uint64 );
     #pragma omp master
     {
         write_scalar( species_group, "id", data_uint64[0], H5T_NATIVE_UINT64, file_space, mem_space, plist, SMILEI_UNIT_NONE, nParticles_global );
@@ -400,7 +400,7 @@ void DiagnosticTrack::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
         #pragma omp master
         data_short.resize( nParticles_local, 0 );
         #pragma omp barrier
-        fill_buffer( vecPatches, 0, data_short );
+        fill_buffer( vecPatches, &Particles::short_prop, 0, data_short );
         #pragma omp master
         {
             write_scalar( species_group, "charge", data_short[0], H5T_NATIVE_SHORT, file_space, mem_space, plist, SMILEI_UNIT_CHARGE, nParticles_global );
@@ -414,7 +414,7 @@ void DiagnosticTrack::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
     // Weight
     if( write_weight ) {
         #pragma omp barrier
-        fill_buffer( vecPatches, nDim_particle+3, data_double );
+        fill_buffer( vecPatches, &Particles::pdouble_prop, 3, data_double );
         #pragma omp master
         write_scalar( species_group, "weight", data_double[0], H5T_NATIVE_DOUBLE, file_space, mem_space, plist, SMILEI_UNIT_DENSITY, nParticles_global );
     }
@@ -429,7 +429,7 @@ void DiagnosticTrack::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
         for( unsigned int idim=0; idim<3; idim++ ) {
             if( write_momentum[idim] ) {
                 #pragma omp barrier
-                fill_buffer( vecPatches, nDim_particle+idim, data_double );
+                fill_buffer( vecPatches, &Particles::pdouble_prop, idim, data_double );
                 #pragma omp master
                 {
                     // Multiply by the mass to obtain an actual momentum
@@ -456,7 +456,7 @@ void DiagnosticTrack::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
         for( unsigned int idim=0; idim<nDim_particle; idim++ ) {
             if( write_position[idim] ) {
                 #pragma omp barrier
-                fill_buffer( vecPatches, idim, data_double );
+                fill_buffer( vecPatches, &Particles::double_prop, idim, data_double );
                 #pragma omp master
                 write_component( position_group, xyz.substr( idim, 1 ).c_str(), data_double[0], H5T_NATIVE_DOUBLE, file_space, mem_space, plist, SMILEI_UNIT_POSITION, nParticles_global );
             }
@@ -468,13 +468,7 @@ void DiagnosticTrack::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
     // Chi - quantum parameter
     if( write_chi ) {
         #pragma omp barrier
-// Position old exists in this case
-#ifdef  __DEBUG
-        fill_buffer( vecPatches, nDim_particle+3+3+1, data_double );
-// Else, position old does not exist
-#else
-        fill_buffer( vecPatches, nDim_particle+3+1, data_double );
-#endif
+        fill_buffer( vecPatches, &Particles::pdouble_prop, 3+1, data_double );
         #pragma omp master
         write_scalar( species_group, "chi", data_double[0], H5T_NATIVE_DOUBLE, file_space, mem_space, plist, SMILEI_UNIT_NONE, nParticles_global );
     }
@@ -609,17 +603,17 @@ void DiagnosticTrack::setIDs( Particles &particles )
 }
 
 
-template<typename T>
-void DiagnosticTrack::fill_buffer( VectorPatch &vecPatches, unsigned int iprop, vector<T> &buffer )
+template<typename T, typename P>
+void DiagnosticTrack::fill_buffer( VectorPatch &vecPatches, vector<ParticleProperty<P>*> Particles::*prop_list, unsigned int iprop, vector<T> &buffer )
 {
     unsigned int patch_nParticles, i, j, nPatches=vecPatches.size();
-    vector<T> *property = NULL;
+    ParticleProperty<P> *property = NULL;
     
     if( has_filter ) {
         #pragma omp for schedule(runtime)
         for( unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++ ) {
             patch_nParticles = patch_selection[ipatch].size();
-            vecPatches( ipatch )->vecSpecies[speciesId_]->particles->getProperty( iprop, property );
+            property = ( vecPatches( ipatch )->vecSpecies[speciesId_]->particles->*prop_list )[iprop];
             i=0;
             j=patch_start[ipatch];
             while( i<patch_nParticles ) {
@@ -632,7 +626,7 @@ void DiagnosticTrack::fill_buffer( VectorPatch &vecPatches, unsigned int iprop,
         #pragma omp for schedule(runtime)
         for( unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++ ) {
             patch_nParticles = vecPatches( ipatch )->vecSpecies[speciesId_]->particles->size();
-            vecPatches( ipatch )->vecSpecies[speciesId_]->particles->getProperty( iprop, property );
+            property = ( vecPatches( ipatch )->vecSpecies[speciesId_]->particles->*prop_list )[iprop];
             i=0;
             j=patch_start[ipatch];
             while( i<patch_nParticles ) {
@@ -36,8 +36,8 @@ public :
     //! Get disk footprint of current diagnostic
     uint64_t getDiskFootPrint( int istart, int istop, Patch *patch ) override;
     
-    //! Fills a buffer with the required particle property
-    template<typename T> void fill_buffer( VectorPatch &vecPatches, unsigned int iprop, std::vector<T> &buffer );
+    //! Fills a buffer with the property iprop of the list prop_list (e.g. &Particles::double_prop)
+    template<typename T, typename P> void fill_buffer( VectorPatch &vecPatches, std::vector<ParticleProperty<P>*> Particles::*prop_list, unsigned int iprop, std::vector<T> &buffer );
     
     //! Write a scalar dataset with the given buffer
     template<typename T> void write_scalar( hid_t, std::string, T &, hid_t, hid_t, hid_t, hid_t, unsigned int, unsigned int );
@@ -396,9 +396,11 @@ void ElectroMagn::restartRhoJ()
     Jz_ ->put_to( 0. );
     rho_->put_to( 0. );
 
-    Jmx_ ->put_to( 0. );
-    Jmy_ ->put_to( 0. );
-    Jmz_ ->put_to( 0. );
+    if( Jmx_ ) {
+        Jmx_ ->put_to( 0. );
+        Jmy_ ->put_to( 0. );
+        Jmz_ ->put_to( 0. );
+    }
 }
 
 void ElectroMagn::restartEnvChi()
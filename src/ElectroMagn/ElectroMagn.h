@@ -314,7 +314,10 @@ public:
     Solver *MaxwellFaradaySolver_;
     virtual void saveMagneticFields( bool ) = 0;
     virtual void centerMagneticFields() = 0;
-    virtual void binomialCurrentFilter() = 0;
+    //! Applies the binomial filter to the currents, with passes[idim] passes along each dimension, followed by the
+    //! compensation pass of compensated[idim] binomial passes if compensated[idim]>0.
+    //! The ghost cells are then only valid over oversize minus the number of passes, and must be exchanged
+    virtual void binomialCurrentFilter( std::vector<unsigned int> passes, std::vector<unsigned int> compensated ) = 0;
     
     void boundaryConditions( int itime, double time_dual, Patch *patch, Params &params, SimWindow *simWindow );
     
@@ -469,6 +472,62 @@ public:
 protected :
     bool is_pxr;
     
+    //! Number of contiguous values filtered together by binomialFilterBlock along the non-contiguous dimensions
+    static const unsigned int binomial_filter_block = 128;
+    
+    //! Weights ( w0, w1 ) of the passes of the binomial filter along one dimension : npass binomial passes ( 1/2, 1/4 ),
+    //! followed if ncompensated>0 by the pass ( 1+n/2, -n/4 ) which cancels the k^2 damping of n=ncompensated passes [Vay et al. 2011]
+    static void binomialFilterWeights( unsigned int npass, unsigned int ncompensated, std::vector<double> &w0, std::vector<double> &w1 )
+    {
+        w0.assign( npass, 0.5 );
+        w1.assign( npass, 0.25 );
+        if( ncompensated > 0 ) {
+            w0.push_back( 1.+0.5*( double )ncompensated );
+            w1.push_back( -0.25*( double )ncompensated );
+        }
+    }
+    
+    //! Applies all the passes f_i <- w0 f_i + w1 ( f_{i-1} + f_{i+1} ), 0<i<n-1, along a dimension of stride `stride`,
+    //! to the `width` contiguous values starting at each f+i*stride : the block stays in cache during the passes.
+    //! prev is a buffer of `width` values
+    static inline void binomialFilterBlock( fdouble *f, unsigned int n, unsigned int stride, unsigned int width,
+                                            std::vector<double> &w0, std::vector<double> &w1, fdouble *prev )
+    {
+        for( unsigned int ipass=0 ; ipass<w0.size() ; ipass++ ) {
+            double a = w0[ipass];
+            double b = w1[ipass];
+            for( unsigned int l=0 ; l<width ; l++ ) {
+                prev[l] = f[l];
+            }
+            for( unsigned int i=1 ; i<n-1 ; i++ ) {
+                fdouble *fi = f + i*stride;
+                fdouble *fn = fi + stride;
+                #pragma omp simd
+                for( unsigned int l=0 ; l<width ; l++ ) {
+                    fdouble fil = fi[l];
+                    fi[l] = a*fil + b*( prev[l] + fn[l] );
+                    prev[l] = fil;
+                }
+            }
+        }
+    }
+    
+    //! Applies all the passes of weights ( w0, w1 ) to a row of n contiguous values. tmp is a buffer of n values
+    static inline void binomialFilterRow( fdouble *f, unsigned int n, std::vector<double> &w0, std::vector<double> &w1, fdouble *tmp )
+    {
+        for( unsigned int ipass=0 ; ipass<w0.size() ; ipass++ ) {
+            double a = w0[ipass];
+            double b = w1[ipass];
+            for( unsigned int i=0 ; i<n ; i++ ) {
+                tmp[i] = f[i];
+            }
+            #pragma omp simd
+            for( unsigned int i=1 ; i<n-1 ; i++ ) {
+                f[i] = a*tmp[i] + b*( tmp[i-1] + tmp[i+1] );
+            }
+        }
+    }
+    
 private:
 
     //! Accumulate nrj lost with moving window
@@ -573,64 +573,21 @@ void ElectroMagn1D::centerMagneticFields()
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Apply a single pass binomial filter on currents
+// Apply the multi-pass binomial filter on currents
 // ---------------------------------------------------------------------------------------------------------------------
-void ElectroMagn1D::binomialCurrentFilter()
+void ElectroMagn1D::binomialCurrentFilter( vector<unsigned int> passes, vector<unsigned int> compensated )
 {
-
-    Field1D *Jx1D     = static_cast<Field1D *>( Jx_ );
-    Field1D *Jy1D     = static_cast<Field1D *>( Jy_ );
-    Field1D *Jz1D     = static_cast<Field1D *>( Jz_ );
-    
-    // Apply a single pass of the binomial filter on currents
+    vector<double> wx0, wx1;
+    binomialFilterWeights( passes[0], compensated[0], wx0, wx1 );
     
-    // on Jx^(d) -- external points are treated by exchange
-    double temp0, tempN;
-    //Field1D *tmp   = new Field1D(dimPrim, 0, false);
-    //tmp->copyFrom(Jx1D);
-    temp0 = ( *Jx1D )( 0 );
-    tempN = ( *Jx1D )( dimDual[0]-1 );
-    for( unsigned int ix=0 ; ix<dimDual[0]-1 ; ix++ ) {
-        ( *Jx1D )( ix )  = ( ( *Jx1D )( ix ) + ( *Jx1D )( ix+1 ) ) * 0.5 ;
-    }
-    for( unsigned int ix=1 ; ix<dimDual[0]-1 ; ix++ ) {
-        ( *Jx1D )( ix )  = ( ( *Jx1D )( ix-1 ) + ( *Jx1D )( ix ) ) * 0.5 ;
-    }
-    ( *Jx1D )( 0 ) = temp0;
-    ( *Jx1D )( dimDual[0]-1 ) = tempN;
+    vector<fdouble> buffer( dimDual[0] );
     
-    temp0 = ( *Jy1D )( 0 );
-    tempN = ( *Jy1D )( dimPrim[0]-1 );
-    // on Jy^(p) -- external points are treated by exchange
-    //tmp   = new Field1D(dimPrim, 1, false);
-    //tmp->copyFrom(Jy1D);
-    for( unsigned int ix=0 ; ix<dimPrim[0]-1 ; ix++ ) {
-        ( *Jy1D )( ix )  = ( ( *Jy1D )( ix ) + ( *Jy1D )( ix+1 ) ) * 0.5 ;
-    }
-    for( unsigned int ix=1 ; ix<dimPrim[0]-1 ; ix++ ) {
-        ( *Jy1D )( ix )  = ( ( *Jy1D )( ix ) + ( *Jy1D )( ix+1 ) ) * 0.5 ;
-    }
-    //delete tmp;
+    // Each pass invalidates one more ghost cell on each side, the exchange following the filter restores them
+    binomialFilterRow( Jx_->data_, Jx_->dims_[0], wx0, wx1, &buffer[0] );
+    binomialFilterRow( Jy_->data_, Jy_->dims_[0], wx0, wx1, &buffer[0] );
+    binomialFilterRow( Jz_->data_, Jz_->dims_[0], wx0, wx1, &buffer[0] );
     
-    ( *Jy1D )( 0 ) = temp0;
-    ( *Jy1D )( dimPrim[0]-1 ) = tempN;
-    
-    temp0 = ( *Jz1D )( 0 );
-    tempN = ( *Jz1D )( dimPrim[0]-1 );
-    // on Jz^(p) -- external points are treated by exchange
-    //tmp   = new Field1D(dimPrim, 2, false);
-    //tmp->copyFrom(Jz1D);
-    for( unsigned int ix=0 ; ix<dimPrim[0]-1 ; ix++ ) {
-        ( *Jz1D )( ix )  = ( ( *Jz1D )( ix ) + ( *Jz1D )( ix+1 ) ) * 0.5 ;
-    }
-    for( unsigned int ix=1 ; ix<dimPrim[0]-1 ; ix++ ) {
-        ( *Jz1D )( ix )  = ( ( *Jz1D )( ix ) + ( *Jz1D )( ix+1 ) ) * 0.5 ;
-    }
-    //delete tmp;
-    ( *Jz1D )( 0 ) = temp0;
-    ( *Jz1D )( dimPrim[0]-1 ) = tempN;
-    
-}
+}//END binomialCurrentFilter
 
 
 
@@ -103,8 +103,8 @@ public:
     //! Method used to center the Magnetic fields (used to push the particles)
     void centerMagneticFields();
     
-    //! Method used to apply a single-pass binomial filter on currents
-    void binomialCurrentFilter();
+    //! Method used to apply the multi-pass binomial filter on currents
+    void binomialCurrentFilter( std::vector<unsigned int> passes, std::vector<unsigned int> compensated );
     
     //! Creates a new field with the right characteristics, depending on the name
     Field *createField( std::string fieldname );
@@ -143,16 +143,19 @@ void ElectroMagn2D::initElectroMagn2DQuantities( Params &params, Patch *patch )
     ny_p = n_space[1]+1+2*oversize[1];
     ny_d = n_space[1]+2+2*oversize[1];
     
+    // Rows of E and B padded to the alignment of the vectorized operators
+    field_padding_ = params.field_padding;
+    
     // Allocation of the EM fields
-    Ex_  = new Field2D( dimPrim, 0, false, "Ex" );
-    Ey_  = new Field2D( dimPrim, 1, false, "Ey" );
-    Ez_  = new Field2D( dimPrim, 2, false, "Ez" );
-    Bx_  = new Field2D( dimPrim, 0, true,  "Bx" );
-    By_  = new Field2D( dimPrim, 1, true,  "By" );
-    Bz_  = new Field2D( dimPrim, 2, true,  "Bz" );
-    Bx_m = new Field2D( dimPrim, 0, true,  "Bx_m" );
-    By_m = new Field2D( dimPrim, 1, true,  "By_m" );
-    Bz_m = new Field2D( dimPrim, 2, true,  "Bz_m" );
+    Ex_  = new Field2D( dimPrim, 0, false, "Ex", field_padding_ );
+    Ey_  = new Field2D( dimPrim, 1, false, "Ey", field_padding_ );
+    Ez_  = new Field2D( dimPrim, 2, false, "Ez", field_padding_ );
+    Bx_  = new Field2D( dimPrim, 0, true,  "Bx", field_padding_ );
+    By_  = new Field2D( dimPrim, 1, true,  "By", field_padding_ );
+    Bz_  = new Field2D( dimPrim, 2, true,  "Bz", field_padding_ );
+    Bx_m = new Field2D( dimPrim, 0, true,  "Bx_m", field_padding_ );
+    By_m = new Field2D( dimPrim, 1, true,  "By_m", field_padding_ );
+    Bz_m = new Field2D( dimPrim, 2, true,  "Bz_m", field_padding_ );
     
     if( params.Laser_Envelope_model ) {
         Env_A_abs_ = new Field2D( dimPrim, "Env_A_abs" );
@@ -904,28 +907,28 @@ void ElectroMagn2D::saveMagneticFields( bool is_spectral )
         
         // Magnetic field Bx^(p,d)
         for( unsigned int i=0 ; i<nx_p ; i++ ) {
-            memcpy( &( ( *Bx2D_m )( i, 0 ) ), &( ( *Bx2D )( i, 0 ) ), ny_d*sizeof( double ) );
+            memcpy( &( ( *Bx2D_m )( i, 0 ) ), &( ( *Bx2D )( i, 0 ) ), ny_d*sizeof( fdouble ) );
             //for (unsigned int j=0 ; j<ny_d ; j++) {
             //    (*Bx2D_m)(i,j)=(*Bx2D)(i,j);
             //}
             
             // Magnetic field By^(d,p)
-            memcpy( &( ( *By2D_m )( i, 0 ) ), &( ( *By2D )( i, 0 ) ), ny_p*sizeof( double ) );
+            memcpy( &( ( *By2D_m )( i, 0 ) ), &( ( *By2D )( i, 0 ) ), ny_p*sizeof( fdouble ) );
             //for (unsigned int j=0 ; j<ny_p ; j++) {
             //    (*By2D_m)(i,j)=(*By2D)(i,j);
             //}
             
             // Magnetic field Bz^(d,d)
-            memcpy( &( ( *Bz2D_m )( i, 0 ) ), &( ( *Bz2D )( i, 0 ) ), ny_d*sizeof( double ) );
+            memcpy( &( ( *Bz2D_m )( i, 0 ) ), &( ( *Bz2D )( i, 0 ) ), ny_d*sizeof( fdouble ) );
             //for (unsigned int j=0 ; j<ny_d ; j++) {
             //    (*Bz2D_m)(i,j)=(*Bz2D)(i,j);
             //}
         }// end for i
-        memcpy( &( ( *By2D_m )( nx_p, 0 ) ), &( ( *By2D )( nx_p, 0 ) ), ny_p*sizeof( double ) );
+        memcpy( &( ( *By2D_m )( nx_p, 0 ) ), &( ( *By2D )( nx_p, 0 ) ), ny_p*sizeof( fdouble ) );
         //for (unsigned int j=0 ; j<ny_p ; j++) {
         //    (*By2D_m)(nx_p,j)=(*By2D)(nx_p,j);
         //}
-        memcpy( &( ( *Bz2D_m )( nx_p, 0 ) ), &( ( *Bz2D )( nx_p, 0 ) ), ny_d*sizeof( double ) );
+        memcpy( &( ( *Bz2D_m )( nx_p, 0 ) ), &( ( *Bz2D )( nx_p, 0 ) ), ny_d*sizeof( fdouble ) );
         //for (unsigned int j=0 ; j<ny_d ; j++) {
         //    (*Bz2D_m)(nx_p,j)=(*Bz2D)(nx_p,j);
         //}
@@ -938,47 +941,40 @@ void ElectroMagn2D::saveMagneticFields( bool is_spectral )
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Apply a single pass binomial filter on currents
+// Apply the multi-pass binomial filter on currents
 // ---------------------------------------------------------------------------------------------------------------------
-void ElectroMagn2D::binomialCurrentFilter()
+void ElectroMagn2D::binomialCurrentFilter( vector<unsigned int> passes, vector<unsigned int> compensated )
 {
-    // Static-cast of the currents
-    Field2D *Jx2D = static_cast<Field2D *>( Jx_ );
-    Field2D *Jy2D = static_cast<Field2D *>( Jy_ );
-    Field2D *Jz2D = static_cast<Field2D *>( Jz_ );
-    
-    // applying a single pass of the binomial filter
-    // 9-point filter: (4*point itself + 2*(4*direct neighbors) + 1*(4*cross neghbors))/16
-    
-    // on Jx^(d,p) -- external points are treated by exchange
-    Field2D *tmp   = new Field2D( dimPrim, 0, false );
-    tmp->copyFrom( Jx2D );
-    for( unsigned int i=1; i<nx_d-1; i++ ) {
-        for( unsigned int j=1; j<ny_p-1; j++ ) {
-            ( *Jx2D )( i, j ) = ( ( *tmp )( i+1, j-1 ) + 2.*( *tmp )( i+1, j ) + ( *tmp )( i+1, j+1 ) + 2.*( *tmp )( i, j-1 ) + 4.*( *tmp )( i, j ) + 2.*( *tmp )( i, j+1 ) + ( *tmp )( i-1, j-1 ) + 2.*( *tmp )( i-1, j ) + ( *tmp )( i-1, j+1 ) )/16.;
-        }
-    }
-    delete tmp;
-    
-    // on Jy^(p,d) -- external points are treated by exchange
-    tmp   = new Field2D( dimPrim, 1, false );
-    tmp->copyFrom( Jy2D );
-    for( unsigned int i=1; i<nx_p-1; i++ ) {
-        for( unsigned int j=1; j<ny_d-1; j++ ) {
-            ( *Jy2D )( i, j ) = ( ( *tmp )( i+1, j-1 ) + 2.*( *tmp )( i+1, j ) + ( *tmp )( i+1, j+1 ) + 2.*( *tmp )( i, j-1 ) + 4.*( *tmp )( i, j ) + 2.*( *tmp )( i, j+1 ) + ( *tmp )( i-1, j-1 ) + 2.*( *tmp )( i-1, j ) + ( *tmp )( i-1, j+1 ) )/16.;
+    vector<double> wx0, wx1, wy0, wy1;
+    binomialFilterWeights( passes[0], compensated[0], wx0, wx1 );
+    binomialFilterWeights( passes[1], compensated[1], wy0, wy1 );
+    
+    unsigned int block = binomial_filter_block;
+    vector<fdouble> buffer( max( block, ny_d ) );
+    
+    // All the passes are applied in two sweeps over each current : the passes along x by blocks of columns,
+    // then the passes along y row by row. Each pass along a dimension invalidates one more ghost cell on
+    // each side, the exchange following the filter restores them (see Params for the width of the ghost regions)
+    Field *J[3] = { Jx_, Jy_, Jz_ };
+    for( unsigned int icomp=0 ; icomp<3 ; icomp++ ) {
+        unsigned int nx = J[icomp]->dims_[0];
+        unsigned int ny = J[icomp]->dims_[1];
+        unsigned int stride_x = J[icomp]->paddedDims_[1];
+        fdouble *f = J[icomp]->data_;
+        
+        // on x (the padding values of a padded Field are 0 and remain 0)
+        if( wx0.size() > 0 ) {
+            for( unsigned int l=0 ; l<stride_x ; l+=block ) {
+                binomialFilterBlock( f+l, nx, stride_x, min( block, stride_x-l ), wx0, wx1, &buffer[0] );
+            }
         }
-    }
-    delete tmp;
-    
-    // on Jz^(p,p) -- external points are treated by exchange
-    tmp   = new Field2D( dimPrim, 2, false );
-    tmp->copyFrom( Jz2D );
-    for( unsigned int i=1; i<nx_p-1; i++ ) {
-        for( unsigned int j=1; j<ny_p-1; j++ ) {
-            ( *Jz2D )( i, j ) = ( ( *tmp )( i+1, j-1 ) + 2.*( *tmp )( i+1, j ) + ( *tmp )( i+1, j+1 ) + 2.*( *tmp )( i, j-1 ) + 4.*( *tmp )( i, j ) + 2.*( *tmp )( i, j+1 ) + ( *tmp )( i-1, j-1 ) + 2.*( *tmp )( i-1, j ) + ( *tmp )( i-1, j+1 ) )/16.;
+        // on y
+        if( wy0.size() > 0 ) {
+            for( unsigned int i=0 ; i<nx ; i++ ) {
+                binomialFilterRow( f+i*stride_x, ny, wy0, wy1, &buffer[0] );
+            }
         }
     }
-    delete tmp;
     
 }//END binomialCurrentFilter
 
@@ -1081,17 +1077,17 @@ void ElectroMagn2D::centerMagneticFields()
 Field *ElectroMagn2D::createField( string fieldname )
 {
     if( fieldname.substr( 0, 2 )=="Ex" ) {
-        return new Field2D( dimPrim, 0, false, fieldname );
+        return new Field2D( dimPrim, 0, false, fieldname, field_padding_ );
     } else if( fieldname.substr( 0, 2 )=="Ey" ) {
-        return new Field2D( dimPrim, 1, false, fieldname );
+        return new Field2D( dimPrim, 1, false, fieldname, field_padding_ );
     } else if( fieldname.substr( 0, 2 )=="Ez" ) {
-        return new Field2D( dimPrim, 2, false, fieldname );
+        return new Field2D( dimPrim, 2, false, fieldname, field_padding_ );
     } else if( fieldname.substr( 0, 2 )=="Bx" ) {
-        return new Field2D( dimPrim, 0, true,  fieldname );
+        return new Field2D( dimPrim, 0, true,  fieldname, field_padding_ );
     } else if( fieldname.substr( 0, 2 )=="By" ) {
-        return new Field2D( dimPrim, 1, true,  fieldname );
+        return new Field2D( dimPrim, 1, true,  fieldname, field_padding_ );
     } else if( fieldname.substr( 0, 2 )=="Bz" ) {
-        return new Field2D( dimPrim, 2, true,  fieldname );
+        return new Field2D( dimPrim, 2, true,  fieldname, field_padding_ );
     } else if( fieldname.substr( 0, 2 )=="Jx" ) {
         return new Field2D( dimPrim, 0, false, fieldname );
     } else if( fieldname.substr( 0, 2 )=="Jy" ) {
@@ -157,17 +157,20 @@ void ElectroMagn3D::initElectroMagn3DQuantities( Params &params, Patch *patch )
     nz_p = n_space[2]+1+2*oversize[2];
     nz_d = n_space[2]+2+2*oversize[2];
     
+    // Rows of E and B padded to the alignment of the vectorized operators
+    field_padding_ = params.field_padding;
+    
     // Allocation of the EM fields
     
-    Ex_  = new Field3D( dimPrim, 0, false, "Ex" );
-    Ey_  = new Field3D( dimPrim, 1, false, "Ey" );
-    Ez_  = new Field3D( dimPrim, 2, false, "Ez" );
-    Bx_  = new Field3D( dimPrim, 0, true,  "Bx" );
-    By_  = new Field3D( dimPrim, 1, true,  "By" );
-    Bz_  = new Field3D( dimPrim, 2, true,  "Bz" );
-    Bx_m = new Field3D( dimPrim, 0, true,  "Bx_m" );
-    By_m = new Field3D( dimPrim, 1, true,  "By_m" );
-    Bz_m = new Field3D( dimPrim, 2, true,  "Bz_m" );
+    Ex_  = new Field3D( dimPrim, 0, false, "Ex", field_padding_ );
+    Ey_  = new Field3D( dimPrim, 1, false, "Ey", field_padding_ );
+    Ez_  = new Field3D( dimPrim, 2, false, "Ez", field_padding_ );
+    Bx_  = new Field3D( dimPrim, 0, true,  "Bx", field_padding_ );
+    By_  = new Field3D( dimPrim, 1, true,  "By", field_padding_ );
+    Bz_  = new Field3D( dimPrim, 2, true,  "Bz", field_padding_ );
+    Bx_m = new Field3D( dimPrim, 0, true,  "Bx_m", field_padding_ );
+    By_m = new Field3D( dimPrim, 1, true,  "By_m", field_padding_ );
+    Bz_m = new Field3D( dimPrim, 2, true,  "Bz_m", field_padding_ );
     if( params.Laser_Envelope_model ) {
         Env_A_abs_ = new Field3D( dimPrim, "Env_A_abs" );
         Env_Chi_   = new Field3D( dimPrim, "Env_Chi" );
@@ -1042,13 +1045,13 @@ void ElectroMagn3D::saveMagneticFields( bool is_spectral )
         Field3D *Bz3D_m = static_cast<Field3D *>( Bz_m );
         
         // Magnetic field Bx^(p,d,d)
-        memcpy( &( ( *Bx3D_m )( 0, 0, 0 ) ), &( ( *Bx3D )( 0, 0, 0 ) ), nx_p*ny_d*nz_d*sizeof( double ) );
+        memcpy( &( ( *Bx3D_m )( 0, 0, 0 ) ), &( ( *Bx3D )( 0, 0, 0 ) ), Bx3D->globalDims_*sizeof( fdouble ) );
         
         // Magnetic field By^(d,p,d)
-        memcpy( &( ( *By3D_m )( 0, 0, 0 ) ), &( ( *By3D )( 0, 0, 0 ) ), nx_d*ny_p*nz_d*sizeof( double ) );
+        memcpy( &( ( *By3D_m )( 0, 0, 0 ) ), &( ( *By3D )( 0, 0, 0 ) ), By3D->globalDims_*sizeof( fdouble ) );
         
         // Magnetic field Bz^(d,d,p)
-        memcpy( &( ( *Bz3D_m )( 0, 0, 0 ) ), &( ( *Bz3D )( 0, 0, 0 ) ), nx_d*ny_d*nz_p*sizeof( double ) );
+        memcpy( &( ( *Bz3D_m )( 0, 0, 0 ) ), &( ( *Bz3D )( 0, 0, 0 ) ), Bz3D->globalDims_*sizeof( fdouble ) );
     } else {
         Bx_m = Bx_;
         By_m = By_;
@@ -1108,17 +1111,17 @@ void ElectroMagn3D::saveMagneticFields( bool is_spectral )
 Field *ElectroMagn3D::createField( string fieldname )
 {
     if( fieldname.substr( 0, 2 )=="Ex" ) {
-        return new Field3D( dimPrim, 0, false, fieldname );
+        return new Field3D( dimPrim, 0, false, fieldname, field_padding_ );
     } else if( fieldname.substr( 0, 2 )=="Ey" ) {
-        return new Field3D( dimPrim, 1, false, fieldname );
+        return new Field3D( dimPrim, 1, false, fieldname, field_padding_ );
     } else if( fieldname.substr( 0, 2 )=="Ez" ) {
-        return new Field3D( dimPrim, 2, false, fieldname );
+        return new Field3D( dimPrim, 2, false, fieldname, field_padding_ );
     } else if( fieldname.substr( 0, 2 )=="Bx" ) {
-        return new Field3D( dimPrim, 0, true,  fieldname );
+        return new Field3D( dimPrim, 0, true,  fieldname, field_padding_ );
     } else if( fieldname.substr( 0, 2 )=="By" ) {
-        return new Field3D( dimPrim, 1, true,  fieldname );
+        return new Field3D( dimPrim, 1, true,  fieldname, field_padding_ );
     } else if( fieldname.substr( 0, 2 )=="Bz" ) {
-        return new Field3D( dimPrim, 2, true,  fieldname );
+        return new Field3D( dimPrim, 2, true,  fieldname, field_padding_ );
     } else if( fieldname.substr( 0, 2 )=="Jx" ) {
         return new Field3D( dimPrim, 0, false, fieldname );
     } else if( fieldname.substr( 0, 2 )=="Jy" ) {
@@ -1185,148 +1188,51 @@ void ElectroMagn3D::centerMagneticFields()
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Apply a single pass binomial filter on currents
+// Apply the multi-pass binomial filter on currents
 // ---------------------------------------------------------------------------------------------------------------------
-void ElectroMagn3D::binomialCurrentFilter()
+void ElectroMagn3D::binomialCurrentFilter( vector<unsigned int> passes, vector<unsigned int> compensated )
 {
-    // Static-cast of the currents
-    Field3D *Jx3D = static_cast<Field3D *>( Jx_ );
-    Field3D *Jy3D = static_cast<Field3D *>( Jy_ );
-    Field3D *Jz3D = static_cast<Field3D *>( Jz_ );
-    
-    // applying a single pass of the binomial filter
-    // on Jx^(d,p) -- external points are treated by exchange. Boundary points not concerned by exchange are treated with a lower order filter.
-    for( unsigned int i=0; i<nx_d-1; i++ ) {
-        for( unsigned int j=0; j<ny_p; j++ ) {
-            for( unsigned int k=0; k<nz_p; k++ ) {
-                ( *Jx3D )( i, j, k ) = ( ( *Jx3D )( i, j, k ) + ( *Jx3D )( i+1, j, k ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=nx_d-2; i>0; i-- ) {
-        for( unsigned int j=0; j<ny_p; j++ ) {
-            for( unsigned int k=0; k<nz_p; k++ ) {
-                ( *Jx3D )( i, j, k ) = ( ( *Jx3D )( i, j, k ) + ( *Jx3D )( i-1, j, k ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=1; i<nx_d-1; i++ ) {
-        for( unsigned int j=0; j<ny_p-1; j++ ) {
-            for( unsigned int k=0; k<nz_p; k++ ) {
-                ( *Jx3D )( i, j, k ) = ( ( *Jx3D )( i, j, k ) + ( *Jx3D )( i, j+1, k ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=1; i<nx_d-1; i++ ) {
-        for( unsigned int j=ny_p-2; j>0; j-- ) {
-            for( unsigned int k=0; k<nz_p; k++ ) {
-                ( *Jx3D )( i, j, k ) = ( ( *Jx3D )( i, j, k ) + ( *Jx3D )( i, j-1, k ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=1; i<nx_d-1; i++ ) {
-        for( unsigned int j=1; j<ny_p-1; j++ ) {
-            for( unsigned int k=0; k<nz_p-1; k++ ) {
-                ( *Jx3D )( i, j, k ) = ( ( *Jx3D )( i, j, k ) + ( *Jx3D )( i, j, k+1 ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=1; i<nx_d-1; i++ ) {
-        for( unsigned int j=1; j<ny_p-1; j++ ) {
-            for( unsigned int k=nz_p-2; k>0; k-- ) {
-                ( *Jx3D )( i, j, k ) = ( ( *Jx3D )( i, j, k ) + ( *Jx3D )( i, j, k-1 ) )*0.5;
-            }
-        }
-    }
-    // Jy
-    for( unsigned int i=0; i<nx_p-1; i++ ) {
-        for( unsigned int j=0; j<ny_d; j++ ) {
-            for( unsigned int k=0; k<nz_p; k++ ) {
-                ( *Jy3D )( i, j, k ) = ( ( *Jy3D )( i, j, k ) + ( *Jy3D )( i+1, j, k ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=nx_p-2; i>0; i-- ) {
-        for( unsigned int j=0; j<ny_d; j++ ) {
-            for( unsigned int k=0; k<nz_p; k++ ) {
-                ( *Jy3D )( i, j, k ) = ( ( *Jy3D )( i, j, k ) + ( *Jy3D )( i-1, j, k ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=1; i<nx_p-1; i++ ) {
-        for( unsigned int j=0; j<ny_d-1; j++ ) {
-            for( unsigned int k=0; k<nz_p; k++ ) {
-                ( *Jy3D )( i, j, k ) = ( ( *Jy3D )( i, j, k ) + ( *Jy3D )( i, j+1, k ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=1; i<nx_p-1; i++ ) {
-        for( unsigned int j=ny_d-2; j>0; j-- ) {
-            for( unsigned int k=0; k<nz_p; k++ ) {
-                ( *Jy3D )( i, j, k ) = ( ( *Jy3D )( i, j, k ) + ( *Jy3D )( i, j-1, k ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=1; i<nx_p-1; i++ ) {
-        for( unsigned int j=1; j<ny_d-1; j++ ) {
-            for( unsigned int k=0; k<nz_p-1; k++ ) {
-                ( *Jy3D )( i, j, k ) = ( ( *Jy3D )( i, j, k ) + ( *Jy3D )( i, j, k+1 ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=1; i<nx_p-1; i++ ) {
-        for( unsigned int j=1; j<ny_d-1; j++ ) {
-            for( unsigned int k=nz_p-2; k>0; k-- ) {
-                ( *Jy3D )( i, j, k ) = ( ( *Jy3D )( i, j, k ) + ( *Jy3D )( i, j, k-1 ) )*0.5;
-            }
-        }
-    }
-    // Jz
-    for( unsigned int i=0; i<nx_p-1; i++ ) {
-        for( unsigned int j=0; j<ny_p; j++ ) {
-            for( unsigned int k=0; k<nz_d; k++ ) {
-                ( *Jz3D )( i, j, k ) = ( ( *Jz3D )( i, j, k ) + ( *Jz3D )( i+1, j, k ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=nx_p-2; i>0; i-- ) {
-        for( unsigned int j=0; j<ny_p; j++ ) {
-            for( unsigned int k=0; k<nz_d; k++ ) {
-                ( *Jz3D )( i, j, k ) = ( ( *Jz3D )( i, j, k ) + ( *Jz3D )( i-1, j, k ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=1; i<nx_p-1; i++ ) {
-        for( unsigned int j=0; j<ny_p-1; j++ ) {
-            for( unsigned int k=0; k<nz_d; k++ ) {
-                ( *Jz3D )( i, j, k ) = ( ( *Jz3D )( i, j, k ) + ( *Jz3D )( i, j+1, k ) )*0.5;
-            }
-        }
-    }
-    for( unsigned int i=1; i<nx_p-1; i++ ) {
-        for( unsigned int j=ny_p-2; j>0; j-- ) {
-            for( unsigned int k=0; k<nz_d; k++ ) {
-                ( *Jz3D )( i, j, k ) = ( ( *Jz3D )( i, j, k ) + ( *Jz3D )( i, j-1, k ) )*0.5;
+    vector<double> wx0, wx1, wy0, wy1, wz0, wz1;
+    binomialFilterWeights( passes[0], compensated[0], wx0, wx1 );
+    binomialFilterWeights( passes[1], compensated[1], wy0, wy1 );
+    binomialFilterWeights( passes[2], compensated[2], wz0, wz1 );
+    
+    unsigned int block = binomial_filter_block;
+    vector<fdouble> buffer( max( block, nz_d ) );
+    
+    // All the passes are applied in two sweeps over each current : the passes along x by blocks of the (y,z) planes,
+    // then the passes along y and z plane by plane. Each pass along a dimension invalidates one more ghost cell on
+    // each side, the exchange following the filter restores them (see Params for the width of the ghost regions)
+    Field *J[3] = { Jx_, Jy_, Jz_ };
+    for( unsigned int icomp=0 ; icomp<3 ; icomp++ ) {
+        unsigned int nx = J[icomp]->dims_[0];
+        unsigned int ny = J[icomp]->dims_[1];
+        unsigned int nz = J[icomp]->dims_[2];
+        unsigned int stride_y = J[icomp]->paddedDims_[2];
+        unsigned int stride_x = J[icomp]->paddedDims_[1]*stride_y;
+        fdouble *f = J[icomp]->data_;
+        
+        // on x (the padding values of a padded Field are 0 and remain 0)
+        if( wx0.size() > 0 ) {
+            for( unsigned int l=0 ; l<stride_x ; l+=block ) {
+                binomialFilterBlock( f+l, nx, stride_x, min( block, stride_x-l ), wx0, wx1, &buffer[0] );
             }
         }
-    }
-    for( unsigned int i=1; i<nx_p-1; i++ ) {
-        for( unsigned int j=1; j<ny_p-1; j++ ) {
-            for( unsigned int k=0; k<nz_d-1; k++ ) {
-                ( *Jz3D )( i, j, k ) = ( ( *Jz3D )( i, j, k ) + ( *Jz3D )( i, j, k+1 ) )*0.5;
+        // on y and z
+        for( unsigned int i=0 ; i<nx ; i++ ) {
+            fdouble *fi = f + i*stride_x;
+            if( wy0.size() > 0 ) {
+                binomialFilterBlock( fi, ny, stride_y, nz, wy0, wy1, &buffer[0] );
             }
-        }
-    }
-    for( unsigned int i=1; i<nx_p-1; i++ ) {
-        for( unsigned int j=1; j<ny_p-1; j++ ) {
-            for( unsigned int k=nz_d-2; k>0; k-- ) {
-                ( *Jz3D )( i, j, k ) = ( ( *Jz3D )( i, j, k ) + ( *Jz3D )( i, j, k-1 ) )*0.5;
+            if( wz0.size() > 0 ) {
+                for( unsigned int j=0 ; j<ny ; j++ ) {
+                    binomialFilterRow( fi+j*stride_y, nz, wz0, wz1, &buffer[0] );
+                }
             }
         }
     }
     
-    
-}
+}//END binomialCurrentFilter
 
 void ElectroMagn3D::center_fields_from_relativistic_Poisson( Patch *patch )
 {
@@ -1730,7 +1636,20 @@ void ElectroMagn3D::applyExternalField( Field *my_field,  Profile *profile, Patc
         pos[0] += dx;
     }
     
-    profile->valuesAt( xyz, *field3D );
+    // The profile is evaluated on the contiguous maps, then copied in a padded field
+    if( field3D->padded_ ) {
+        Field3D values( n_space_to_create );
+        profile->valuesAt( xyz, values );
+        for( int i=0 ; i<N0 ; i++ ) {
+            for( int j=0 ; j<N1 ; j++ ) {
+                for( int k=0 ; k<N2 ; k++ ) {
+                    ( *field3D )( i, j, k ) = values( i, j, k );
+                }
+            }
+        }
+    } else {
+        profile->valuesAt( xyz, *field3D );
+    }
     
     for( unsigned int idim=0 ; idim<3 ; idim++ ) {
         delete xyz[idim];
@@ -1098,9 +1098,9 @@ void ElectroMagnAM::centerMagneticFields()
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Apply a single pass binomial filter on currents
+// Apply the multi-pass binomial filter on currents
 // ---------------------------------------------------------------------------------------------------------------------
-void ElectroMagnAM::binomialCurrentFilter()
+void ElectroMagnAM::binomialCurrentFilter( vector<unsigned int>, vector<unsigned int> )
 {
     ERROR( "Binomial current filtering not yet implemented in AM" );
 }
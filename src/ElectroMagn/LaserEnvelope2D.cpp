@@ -197,7 +197,7 @@ void LaserEnvelope2D::compute( ElectroMagn *EMfields )
     //// explicit solver
     for( unsigned int i=1 ; i <A_->dims_[0]-1; i++ ) { // x loop
         for( unsigned int j=1 ; j < A_->dims_[1]-1 ; j++ ) { // y loop
-            ( *A2Dnew )( i, j ) -= ( *Env_Chi2D )( i, j )*( *A2D )( i, j ); // subtract here source term Chi*A from plasma
+            ( *A2Dnew )( i, j ) -= ( double )( *Env_Chi2D )( i, j )*( *A2D )( i, j ); // subtract here source term Chi*A from plasma
             // A2Dnew = laplacian - source term
             ( *A2Dnew )( i, j ) += ( ( *A2D )( i-1, j )-2.*( *A2D )( i, j )+( *A2D )( i+1, j ) )*one_ov_dx_sq; // x part
             ( *A2Dnew )( i, j ) += ( ( *A2D )( i, j-1 )-2.*( *A2D )( i, j )+( *A2D )( i, j+1 ) )*one_ov_dy_sq; // y part
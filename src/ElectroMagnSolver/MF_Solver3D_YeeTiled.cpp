@@ -0,0 +1,144 @@
+#include "MF_Solver3D_YeeTiled.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "ElectroMagn.h"
+#include "Field3D.h"
+
+MF_Solver3D_YeeTiled::MF_Solver3D_YeeTiled( Params &params )
+    : Solver3D( params )
+{
+    tile_size = params.maxwell_tile_size;
+}
+
+MF_Solver3D_YeeTiled::~MF_Solver3D_YeeTiled()
+{
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Maxwell-Ampere, saving of B at time n in B_m and Maxwell-Faraday, line by line along z
+// The tiles along y are swept from low to high x, then from low to high y : when a line (i,j) is treated,
+// E has been updated on the lines (i-1,j) and (i,j-1) used by Maxwell-Faraday, while B has not been updated yet
+// on the lines (i+1,j) and (i,j+1) used by Maxwell-Ampere. The result is then identical to the separate sweeps.
+// ---------------------------------------------------------------------------------------------------------------------
+void MF_Solver3D_YeeTiled::operator()( ElectroMagn *fields )
+{
+    // Static-cast of the fields
+    Field3D *Ex3D = static_cast<Field3D *>( fields->Ex_ );
+    Field3D *Ey3D = static_cast<Field3D *>( fields->Ey_ );
+    Field3D *Ez3D = static_cast<Field3D *>( fields->Ez_ );
+    Field3D *Bx3D = static_cast<Field3D *>( fields->Bx_ );
+    Field3D *By3D = static_cast<Field3D *>( fields->By_ );
+    Field3D *Bz3D = static_cast<Field3D *>( fields->Bz_ );
+    Field3D *Bx3D_m = static_cast<Field3D *>( fields->Bx_m );
+    Field3D *By3D_m = static_cast<Field3D *>( fields->By_m );
+    Field3D *Bz3D_m = static_cast<Field3D *>( fields->Bz_m );
+    Field3D *Jx3D = static_cast<Field3D *>( fields->Jx_ );
+    Field3D *Jy3D = static_cast<Field3D *>( fields->Jy_ );
+    Field3D *Jz3D = static_cast<Field3D *>( fields->Jz_ );
+    
+    for( unsigned int jtile=0 ; jtile<ny_d ; jtile+=tile_size ) {
+        unsigned int jend = std::min( jtile+tile_size, ny_d );
+        
+        for( unsigned int i=0 ; i<nx_d ; i++ ) {
+            for( unsigned int j=jtile ; j<jend ; j++ ) {
+                
+                // Electric field Ex^(d,p,p)
+                if( j<ny_p ) {
+                    fdouble *ex    = &( *Ex3D )( i, j, 0 );
+                    fdouble *jx    = &( *Jx3D )( i, j, 0 );
+                    fdouble *bz    = &( *Bz3D )( i, j, 0 );
+                    fdouble *bz_jp = &( *Bz3D )( i, j+1, 0 );
+                    fdouble *by    = &( *By3D )( i, j, 0 );
+                    #pragma omp simd
+                    for( unsigned int k=0 ; k<nz_p ; k++ ) {
+                        ex[k] += -dt*jx[k]
+                                 +                 dt_ov_dy * ( bz_jp[k] - bz[k] )
+                                 -                 dt_ov_dz * ( by[k+1] - by[k] );
+                    }
+                }
+                
+                if( i<nx_p ) {
+                    // Electric field Ey^(p,d,p)
+                    fdouble *ey    = &( *Ey3D )( i, j, 0 );
+                    fdouble *jy    = &( *Jy3D )( i, j, 0 );
+                    fdouble *bz    = &( *Bz3D )( i, j, 0 );
+                    fdouble *bz_ip = &( *Bz3D )( i+1, j, 0 );
+                    fdouble *bx    = &( *Bx3D )( i, j, 0 );
+                    #pragma omp simd
+                    for( unsigned int k=0 ; k<nz_p ; k++ ) {
+                        ey[k] += -dt*jy[k]
+                                 -                  dt_ov_dx * ( bz_ip[k] - bz[k] )
+                                 +                  dt_ov_dz * ( bx[k+1] - bx[k] );
+                    }
+                    
+                    // Electric field Ez^(p,p,d)
+                    if( j<ny_p ) {
+                        fdouble *ez    = &( *Ez3D )( i, j, 0 );
+                        fdouble *jz    = &( *Jz3D )( i, j, 0 );
+                        fdouble *by    = &( *By3D )( i, j, 0 );
+                        fdouble *by_ip = &( *By3D )( i+1, j, 0 );
+                        fdouble *bx_jp = &( *Bx3D )( i, j+1, 0 );
+                        #pragma omp simd
+                        for( unsigned int k=0 ; k<nz_d ; k++ ) {
+                            ez[k] += -dt*jz[k]
+                                     +                  dt_ov_dx * ( by_ip[k] - by[k] )
+                                     -                  dt_ov_dy * ( bx_jp[k] - bx[k] );
+                        }
+                    }
+                }
+                
+                // Stores B at time n in B_m
+                if( i<nx_p ) {
+                    memcpy( &( *Bx3D_m )( i, j, 0 ), &( *Bx3D )( i, j, 0 ), nz_d*sizeof( fdouble ) );
+                }
+                if( j<ny_p ) {
+                    memcpy( &( *By3D_m )( i, j, 0 ), &( *By3D )( i, j, 0 ), nz_d*sizeof( fdouble ) );
+                }
+                memcpy( &( *Bz3D_m )( i, j, 0 ), &( *Bz3D )( i, j, 0 ), nz_p*sizeof( fdouble ) );
+                
+                // Magnetic field Bx^(p,d,d)
+                if( i<nx_p && j>0 && j<ny_d-1 ) {
+                    fdouble *bx    = &( *Bx3D )( i, j, 0 );
+                    fdouble *ez    = &( *Ez3D )( i, j, 0 );
+                    fdouble *ez_jm = &( *Ez3D )( i, j-1, 0 );
+                    fdouble *ey    = &( *Ey3D )( i, j, 0 );
+                    #pragma omp simd
+                    for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
+                        bx[k] += -dt_ov_dy * ( ez[k] - ez_jm[k] ) + dt_ov_dz * ( ey[k] - ey[k-1] );
+                    }
+                }
+                
+                if( i>0 && i<nx_d-1 ) {
+                    // Magnetic field By^(d,p,d)
+                    if( j<ny_p ) {
+                        fdouble *by    = &( *By3D )( i, j, 0 );
+                        fdouble *ex    = &( *Ex3D )( i, j, 0 );
+                        fdouble *ez    = &( *Ez3D )( i, j, 0 );
+                        fdouble *ez_im = &( *Ez3D )( i-1, j, 0 );
+                        #pragma omp simd
+                        for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
+                            by[k] += -dt_ov_dz * ( ex[k] - ex[k-1] ) + dt_ov_dx * ( ez[k] - ez_im[k] );
+                        }
+                    }
+                    
+                    // Magnetic field Bz^(d,d,p)
+                    if( j>0 && j<ny_d-1 ) {
+                        fdouble *bz    = &( *Bz3D )( i, j, 0 );
+                        fdouble *ey    = &( *Ey3D )( i, j, 0 );
+                        fdouble *ey_im = &( *Ey3D )( i-1, j, 0 );
+                        fdouble *ex    = &( *Ex3D )( i, j, 0 );
+                        fdouble *ex_jm = &( *Ex3D )( i, j-1, 0 );
+                        #pragma omp simd
+                        for( unsigned int k=0 ; k<nz_p ; k++ ) {
+                            bz[k] += -dt_ov_dx * ( ey[k] - ey_im[k] ) + dt_ov_dy * ( ex[k] - ex_jm[k] );
+                        }
+                    }
+                }
+            }
+        }
+    }
+    
+}
+
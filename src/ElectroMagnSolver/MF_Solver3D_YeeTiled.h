@@ -0,0 +1,30 @@
+#ifndef MF_SOLVER3D_YEETILED_H
+#define MF_SOLVER3D_YEETILED_H
+
+#include "Solver3D.h"
+class ElectroMagn;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class MF_Solver3D_YeeTiled : Yee scheme with Maxwell-Ampere, the saving of B and Maxwell-Faraday fused in a single
+//! sweep of the patch, by tiles along y. Used in place of the Maxwell-Faraday solver, the Maxwell-Ampere solver
+//! being then a NullSolver.
+//  --------------------------------------------------------------------------------------------------------------------
+class MF_Solver3D_YeeTiled : public Solver3D
+{
+    
+public:
+    //! Creator for MF_Solver3D_YeeTiled
+    MF_Solver3D_YeeTiled( Params &params );
+    virtual ~MF_Solver3D_YeeTiled();
+    
+    //! Overloading of () operator
+    virtual void operator()( ElectroMagn *fields );
+    
+protected:
+    //! Number of cells along y in a tile
+    unsigned int tile_size;
+    
+};//END class
+
+#endif
+
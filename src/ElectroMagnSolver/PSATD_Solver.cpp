@@ -0,0 +1,433 @@
+#include "PSATD_Solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mpi.h>
+
+#include "ElectroMagn.h"
+#include "Field.h"
+#include "Patch.h"
+
+using namespace std;
+
+PSATD_Solver::PSATD_Solver( Params &params )
+    : Solver( params )
+{
+    // The decomposition is set only for the Domain patch, in setDomain
+    nDim_ = params.nDim_field;
+    dt_ = params.timestep;
+    nxslab_ = 0;
+    nyslab_ = 0;
+}
+
+PSATD_Solver::~PSATD_Solver()
+{
+    for( unsigned int i=0 ; i<fft_.size() ; i++ ) {
+        delete fft_[i];
+    }
+}
+
+void PSATD_Solver::setDomain( Params &params, Patch *patch )
+{
+    MPI_Comm_rank( MPI_COMM_WORLD, &rank_ );
+    MPI_Comm_size( MPI_COMM_WORLD, &nproc_ );
+    
+    int origin[3] = {0, 0, 0};
+    for( unsigned int i=0 ; i<3 ; i++ ) {
+        if( i<nDim_ ) {
+            N_[i] = params.n_space[i] * params.number_of_patches[i];
+            n_[i] = params.n_space[i] * params.global_factor[i];
+            oversize_[i] = params.oversize[i];
+            dx_[i] = params.cell_length[i];
+            origin[i] = patch->Pcoordinates[i] * n_[i];
+        } else {
+            N_[i] = 1;
+            n_[i] = 1;
+            oversize_[i] = 0;
+            dx_[i] = 1.;
+        }
+    }
+    if( nproc_ * n_[0]*n_[1]*n_[2] != N_[0]*N_[1]*N_[2] ) {
+        ERROR( "The spectral solver requires global_factor to match the number of patches of each MPI process" );
+    }
+    
+    // Blocks of all processes
+    vector<int> origins( 3*nproc_ );
+    MPI_Allgather( origin, 3, MPI_INT, &origins[0], 3, MPI_INT, MPI_COMM_WORLD );
+    
+    blocks_.resize( nproc_ );
+    blocks_ext_.resize( nproc_ );
+    xslabs_.resize( nproc_ );
+    yslabs_.resize( nproc_ );
+    for( int p=0 ; p<nproc_ ; p++ ) {
+        for( unsigned int i=0 ; i<3 ; i++ ) {
+            int o = origins[3*p+i];
+            Segment owned = { o, n_[i], 0 };
+            blocks_[p].seg[i].push_back( owned );
+            
+            // Points written back : the block and one point on each side, wrapped periodically
+            if( i<nDim_ ) {
+                int lo = o-1;
+                int hi = o+n_[i]+1;
+                for( int g=lo ; g<hi ; ) {
+                    int gw = ( ( g%N_[i] ) + N_[i] ) % N_[i];
+                    int length = min( hi-g, N_[i]-gw );
+                    Segment s = { gw, length, g-lo };
+                    blocks_ext_[p].seg[i].push_back( s );
+                    g += length;
+                }
+            } else {
+                blocks_ext_[p].seg[i].push_back( owned );
+            }
+            
+            // Slabs along x and y, balanced between processes
+            Segment all = { 0, N_[i], 0 };
+            int start = ( long long )p * N_[i] / nproc_;
+            int end   = ( long long )( p+1 ) * N_[i] / nproc_;
+            Segment part = { start, end-start, 0 };
+            xslabs_[p].seg[i].push_back( i==0 ? part : all );
+            yslabs_[p].seg[i].push_back( i==1 ? part : all );
+        }
+    }
+    nxslab_ = xslabs_[rank_].seg[0][0].length;
+    nyslab_ = yslabs_[rank_].seg[1][0].length;
+    
+    xslab_data_.resize( 9 * nxslab_ * N_[1] * N_[2] );
+    yslab_data_.resize( 9 * N_[0] * nyslab_ * N_[2] );
+    line_.resize( max( N_[0], N_[1] ) );
+    
+    // Transforms and wave numbers
+    for( unsigned int i=0 ; i<3 ; i++ ) {
+        fft_.push_back( new FFT( N_[i] ) );
+        k_[i].resize( N_[i] );
+        half_shift_[i].resize( N_[i] );
+        nyquist_[i].resize( N_[i], false );
+        for( int m=0 ; m<N_[i] ; m++ ) {
+            int ms = ( 2*m < N_[i] ) ? m : m-N_[i];
+            k_[i][m] = 2.*M_PI*( double )ms / ( ( double )N_[i]*dx_[i] );
+            half_shift_[i][m] = exp( complex<double>( 0., -0.5*k_[i][m]*dx_[i] ) );
+            nyquist_[i][m] = ( 2*m == N_[i] ) && ( N_[i] > 1 );
+        }
+    }
+    
+    send_counts_.resize( nproc_ );
+    send_displs_.resize( nproc_ );
+    recv_counts_.resize( nproc_ );
+    recv_displs_.resize( nproc_ );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Advance of E and B from time n to n+1, with J at time n+1/2
+// ---------------------------------------------------------------------------------------------------------------------
+void PSATD_Solver::operator()( ElectroMagn *fields )
+{
+    Field *components[9] = { fields->Ex_, fields->Ey_, fields->Ez_,
+                             fields->Bx_, fields->By_, fields->Bz_,
+                             fields->Jx_, fields->Jy_, fields->Jz_
+                           };
+    
+    int slab_size[2] = { nxslab_ * N_[1] * N_[2], N_[0] * nyslab_ * N_[2] };
+    vector<Array> owned( 9 ), written( 6 ), xslab( 9 ), yslab( 9 );
+    for( unsigned int c=0 ; c<9 ; c++ ) {
+        Field *f = components[c];
+        for( unsigned int i=0 ; i<3 ; i++ ) {
+            isDual_[c][i] = f->isDual( i );
+            owned[c].dims[i] = i<nDim_ ? f->paddedDims_[i] : 1;
+            owned[c].shift[i] = oversize_[i] + isDual_[c][i];
+        }
+        owned[c].field = f->data_;
+        owned[c].data = NULL;
+        owned[c].stride = 1;
+        if( c<6 ) {
+            written[c] = owned[c];
+            for( unsigned int i=0 ; i<nDim_ ; i++ ) {
+                written[c].shift[i] -= 1;
+            }
+        }
+        
+        xslab[c].field = NULL;
+        yslab[c].field = NULL;
+        xslab[c].data = reinterpret_cast<double *>( xslab_data_.data() + c*slab_size[0] );
+        yslab[c].data = reinterpret_cast<double *>( yslab_data_.data() + c*slab_size[1] );
+        xslab[c].dims[0] = nxslab_;
+        yslab[c].dims[0] = N_[0];
+        xslab[c].dims[1] = N_[1];
+        yslab[c].dims[1] = nyslab_;
+        xslab[c].dims[2] = N_[2];
+        yslab[c].dims[2] = N_[2];
+        for( unsigned int i=0 ; i<3 ; i++ ) {
+            xslab[c].shift[i] = 0;
+            yslab[c].shift[i] = 0;
+        }
+        xslab[c].stride = 2;
+        yslab[c].stride = 2;
+    }
+    
+    // Forward transforms of E, B and J
+    fill( xslab_data_.begin(), xslab_data_.end(), complex<double>( 0., 0. ) );
+    redistribute( blocks_, owned, xslabs_, xslab );
+    transformYZ( 9, true );
+    redistribute( xslabs_, xslab, yslabs_, yslab );
+    transformX( 9, true );
+    
+    advance();
+    
+    // Backward transforms of E and B
+    xslab.resize( 6 );
+    yslab.resize( 6 );
+    transformX( 6, false );
+    redistribute( yslabs_, yslab, xslabs_, xslab );
+    transformYZ( 6, false );
+    redistribute( xslabs_, xslab, blocks_ext_, written );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Analytical solution of the Maxwell equations for each mode, J being constant over the timestep
+// E_T(n+1) = C E_T + i S k^ x B - S/k J_T          E_L(n+1) = E_L - dt J_L
+// B(n+1)   = C B - i S k^ x E + i (1-C)/k k^ x J     with C = cos(k dt), S = sin(k dt)
+// ---------------------------------------------------------------------------------------------------------------------
+void PSATD_Solver::advance()
+{
+    const complex<double> I( 0., 1. );
+    int ystart = yslabs_[rank_].seg[1][0].gstart;
+    int slab_size = N_[0] * nyslab_ * N_[2];
+    double norm = 1. / ( ( double )N_[0]*( double )N_[1]*( double )N_[2] );
+    
+    for( int i=0 ; i<N_[0] ; i++ ) {
+        for( int j=0 ; j<nyslab_ ; j++ ) {
+            for( int k=0 ; k<N_[2] ; k++ ) {
+                int idx = ( i*nyslab_ + j )*N_[2] + k;
+                
+                // Fields defined at the same point, the dual components being shifted by half a cell
+                complex<double> h[3] = { half_shift_[0][i], half_shift_[1][ystart+j], half_shift_[2][k] };
+                complex<double> shift[9];
+                complex<double> F[9];
+                for( unsigned int c=0 ; c<9 ; c++ ) {
+                    shift[c] = 1.;
+                    for( unsigned int d=0 ; d<nDim_ ; d++ ) {
+                        if( isDual_[c][d] ) {
+                            shift[c] *= h[d];
+                        }
+                    }
+                    F[c] = yslab_data_[c*slab_size+idx] * shift[c];
+                }
+                complex<double> *E = &F[0];
+                complex<double> *B = &F[3];
+                complex<double> *J = &F[6];
+                complex<double> Enew[3], Bnew[3];
+                
+                double kx = k_[0][i];
+                double ky = k_[1][ystart+j];
+                double kz = k_[2][k];
+                double knorm = sqrt( kx*kx + ky*ky + kz*kz );
+                
+                if( nyquist_[0][i] || nyquist_[1][ystart+j] || nyquist_[2][k] ) {
+                    // Nyquist modes are removed to keep the fields real
+                    for( unsigned int d=0 ; d<3 ; d++ ) {
+                        Enew[d] = 0.;
+                        Bnew[d] = 0.;
+                    }
+                } else if( knorm == 0. ) {
+                    for( unsigned int d=0 ; d<3 ; d++ ) {
+                        Enew[d] = E[d] - dt_*J[d];
+                        Bnew[d] = B[d];
+                    }
+                } else {
+                    double u[3] = { kx/knorm, ky/knorm, kz/knorm };
+                    double C = cos( knorm*dt_ );
+                    double S = sin( knorm*dt_ );
+                    
+                    complex<double> uE = u[0]*E[0] + u[1]*E[1] + u[2]*E[2];
+                    complex<double> uJ = u[0]*J[0] + u[1]*J[1] + u[2]*J[2];
+                    complex<double> uxB[3] = { u[1]*B[2] - u[2]*B[1], u[2]*B[0] - u[0]*B[2], u[0]*B[1] - u[1]*B[0] };
+                    complex<double> uxE[3] = { u[1]*E[2] - u[2]*E[1], u[2]*E[0] - u[0]*E[2], u[0]*E[1] - u[1]*E[0] };
+                    complex<double> uxJ[3] = { u[1]*J[2] - u[2]*J[1], u[2]*J[0] - u[0]*J[2], u[0]*J[1] - u[1]*J[0] };
+                    
+                    for( unsigned int d=0 ; d<3 ; d++ ) {
+                        complex<double> EL = u[d]*uE;
+                        complex<double> JL = u[d]*uJ;
+                        Enew[d] = C*( E[d]-EL ) + I*S*uxB[d] - S/knorm*( J[d]-JL ) + EL - dt_*JL;
+                        Bnew[d] = C*B[d] - I*S*uxE[d] + I*( 1.-C )/knorm*uxJ[d];
+                    }
+                }
+                
+                // Back to the staggered grid, with the normalization of the backward transforms
+                for( unsigned int d=0 ; d<3 ; d++ ) {
+                    yslab_data_[d*slab_size+idx]     = Enew[d] * conj( shift[d] ) * norm;
+                    yslab_data_[( d+3 )*slab_size+idx] = Bnew[d] * conj( shift[d+3] ) * norm;
+                }
+            }
+        }
+    }
+}
+
+void PSATD_Solver::transformYZ( unsigned int ncomp, bool forward )
+{
+    int ny = N_[1];
+    int nz = N_[2];
+    for( unsigned int c=0 ; c<ncomp ; c++ ) {
+        for( int i=0 ; i<nxslab_ ; i++ ) {
+            complex<double> *plane = xslab_data_.data() + ( c*nxslab_ + i )*ny*nz;
+            if( nz > 1 ) {
+                for( int j=0 ; j<ny ; j++ ) {
+                    if( forward ) {
+                        fft_[2]->forward( &plane[j*nz] );
+                    } else {
+                        fft_[2]->backward( &plane[j*nz] );
+                    }
+                }
+            }
+            for( int k=0 ; k<nz ; k++ ) {
+                for( int j=0 ; j<ny ; j++ ) {
+                    line_[j] = plane[j*nz+k];
+                }
+                if( forward ) {
+                    fft_[1]->forward( &line_[0] );
+                } else {
+                    fft_[1]->backward( &line_[0] );
+                }
+                for( int j=0 ; j<ny ; j++ ) {
+                    plane[j*nz+k] = line_[j];
+                }
+            }
+        }
+    }
+}
+
+void PSATD_Solver::transformX( unsigned int ncomp, bool forward )
+{
+    int nx = N_[0];
+    int stride = nyslab_*N_[2];
+    for( unsigned int c=0 ; c<ncomp ; c++ ) {
+        complex<double> *slab = yslab_data_.data() + c*nx*stride;
+        for( int jk=0 ; jk<stride ; jk++ ) {
+            for( int i=0 ; i<nx ; i++ ) {
+                line_[i] = slab[i*stride+jk];
+            }
+            if( forward ) {
+                fft_[0]->forward( &line_[0] );
+            } else {
+                fft_[0]->backward( &line_[0] );
+            }
+            for( int i=0 ; i<nx ; i++ ) {
+                slab[i*stride+jk] = line_[i];
+            }
+        }
+    }
+}
+
+void PSATD_Solver::overlap( Box &a, Box &b, vector<Run> &runs )
+{
+    runs.clear();
+    for( unsigned int sx=0 ; sx<a.seg[0].size() ; sx++ ) {
+        for( unsigned int dx=0 ; dx<b.seg[0].size() ; dx++ ) {
+            Segment &ax = a.seg[0][sx], &bx = b.seg[0][dx];
+            int lox = max( ax.gstart, bx.gstart );
+            int hix = min( ax.gstart+ax.length, bx.gstart+bx.length );
+            for( unsigned int sy=0 ; sy<a.seg[1].size() ; sy++ ) {
+                for( unsigned int dy=0 ; dy<b.seg[1].size() ; dy++ ) {
+                    Segment &ay = a.seg[1][sy], &by = b.seg[1][dy];
+                    int loy = max( ay.gstart, by.gstart );
+                    int hiy = min( ay.gstart+ay.length, by.gstart+by.length );
+                    for( unsigned int sz=0 ; sz<a.seg[2].size() ; sz++ ) {
+                        for( unsigned int dz=0 ; dz<b.seg[2].size() ; dz++ ) {
+                            Segment &az = a.seg[2][sz], &bz = b.seg[2][dz];
+                            int loz = max( az.gstart, bz.gstart );
+                            int hiz = min( az.gstart+az.length, bz.gstart+bz.length );
+                            if( hiz <= loz ) {
+                                continue;
+                            }
+                            for( int gx=lox ; gx<hix ; gx++ ) {
+                                for( int gy=loy ; gy<hiy ; gy++ ) {
+                                    Run r;
+                                    r.la[0] = ax.lstart + gx - ax.gstart;
+                                    r.la[1] = ay.lstart + gy - ay.gstart;
+                                    r.la[2] = az.lstart + loz - az.gstart;
+                                    r.lb[0] = bx.lstart + gx - bx.gstart;
+                                    r.lb[1] = by.lstart + gy - by.gstart;
+                                    r.lb[2] = bz.lstart + loz - bz.gstart;
+                                    r.length = hiz - loz;
+                                    runs.push_back( r );
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Exchange of the components between two layouts, all the values sent to a process being packed in a single message
+// ---------------------------------------------------------------------------------------------------------------------
+void PSATD_Solver::redistribute( vector<Box> &src, vector<Array> &src_arrays, vector<Box> &dst, vector<Array> &dst_arrays )
+{
+    unsigned int ncomp = src_arrays.size();
+    int nval = min( src_arrays[0].stride, dst_arrays[0].stride );
+    
+    send_buffer_.clear();
+    for( int p=0 ; p<nproc_ ; p++ ) {
+        send_displs_[p] = send_buffer_.size();
+        overlap( src[rank_], dst[p], runs_ );
+        for( unsigned int c=0 ; c<ncomp ; c++ ) {
+            Array &a = src_arrays[c];
+            for( unsigned int r=0 ; r<runs_.size() ; r++ ) {
+                Run &run = runs_[r];
+                int idx = ( ( run.la[0]+a.shift[0] )*a.dims[1] + run.la[1]+a.shift[1] )*a.dims[2] + run.la[2]+a.shift[2];
+                if( a.field ) {
+                    for( int l=0 ; l<run.length ; l++ ) {
+                        send_buffer_.push_back( a.field[idx+l] );
+                    }
+                    continue;
+                }
+                for( int l=0 ; l<run.length ; l++ ) {
+                    for( int v=0 ; v<nval ; v++ ) {
+                        send_buffer_.push_back( a.data[( idx+l )*a.stride+v] );
+                    }
+                }
+            }
+        }
+        send_counts_[p] = send_buffer_.size() - send_displs_[p];
+    }
+    
+    int recv_size = 0;
+    for( int p=0 ; p<nproc_ ; p++ ) {
+        overlap( src[p], dst[rank_], runs_ );
+        int npoints = 0;
+        for( unsigned int r=0 ; r<runs_.size() ; r++ ) {
+            npoints += runs_[r].length;
+        }
+        recv_displs_[p] = recv_size;
+        recv_counts_[p] = npoints * ncomp * nval;
+        recv_size += recv_counts_[p];
+    }
+    recv_buffer_.resize( recv_size );
+    
+    MPI_Alltoallv( send_buffer_.data(), &send_counts_[0], &send_displs_[0], MPI_DOUBLE,
+                   recv_buffer_.data(), &recv_counts_[0], &recv_displs_[0], MPI_DOUBLE, MPI_COMM_WORLD );
+    
+    for( int p=0 ; p<nproc_ ; p++ ) {
+        overlap( src[p], dst[rank_], runs_ );
+        double *buffer = recv_buffer_.data() + recv_displs_[p];
+        for( unsigned int c=0 ; c<ncomp ; c++ ) {
+            Array &b = dst_arrays[c];
+            for( unsigned int r=0 ; r<runs_.size() ; r++ ) {
+                Run &run = runs_[r];
+                int idx = ( ( run.lb[0]+b.shift[0] )*b.dims[1] + run.lb[1]+b.shift[1] )*b.dims[2] + run.lb[2]+b.shift[2];
+                if( b.field ) {
+                    for( int l=0 ; l<run.length ; l++ ) {
+                        b.field[idx+l] = *( buffer++ );
+                    }
+                    continue;
+                }
+                for( int l=0 ; l<run.length ; l++ ) {
+                    for( int v=0 ; v<nval ; v++ ) {
+                        b.data[( idx+l )*b.stride+v] = *( buffer++ );
+                    }
+                }
+            }
+        }
+    }
+}
+
@@ -0,0 +1,128 @@
+#ifndef PSATD_SOLVER_H
+#define PSATD_SOLVER_H
+
+#include <complex>
+#include <vector>
+
+#include "Solver.h"
+#include "FFT.h"
+
+class ElectroMagn;
+class Field;
+class Patch;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class PSATD_Solver : pseudo-spectral analytical time-domain solver (2D and 3D cartesian, periodic domain)
+//! It advances E and B together, on the Domain grid of each MPI process (one block of global_factor patches),
+//! and is used in place of the Maxwell-Ampere solver, the Maxwell-Faraday solver being a NullSolver.
+//! The blocks are redistributed in slabs along x to compute the FFTs along y (and z), transposed in slabs along y
+//! to compute the FFTs along x, the analytical solution for J constant over the timestep being computed there.
+//  --------------------------------------------------------------------------------------------------------------------
+class PSATD_Solver : public Solver
+{
+    
+public:
+    PSATD_Solver( Params &params );
+    virtual ~PSATD_Solver();
+    
+    //! Set up of the decomposition from the Domain patch of the MPI process
+    void setDomain( Params &params, Patch *patch ) override;
+    //! Overloading of () operator
+    virtual void operator()( ElectroMagn *fields ) override;
+    
+protected:
+    //! Range of global indices [gstart, gstart+length), stored from the index lstart of a local array
+    struct Segment {
+        int gstart;
+        int length;
+        int lstart;
+    };
+    //! Part of the global grid held by an MPI process in a given layout, as segments along each dimension
+    struct Box {
+        std::vector<Segment> seg[3];
+    };
+    //! Contiguous run of points along the last dimension, common to two boxes
+    struct Run {
+        int la[3];
+        int lb[3];
+        int length;
+    };
+    
+    //! Local array of one component : the point of box-local indices (l0,l1,l2) is stored at
+    //! data[ stride * ( ( (l0+shift[0])*dims[1] + l1+shift[1] )*dims[2] + l2+shift[2] ) ]
+    //! or, for the components held by a Field, at field[ ( (l0+shift[0])*dims[1] + l1+shift[1] )*dims[2] + l2+shift[2] ]
+    struct Array {
+        fdouble *field;
+        double *data;
+        //! Allocated dimensions (including the padding of the Fields)
+        int dims[3];
+        int shift[3];
+        //! Number of doubles per point (1 for the real fields, 2 for the transforms)
+        int stride;
+    };
+    
+    //! Runs of points common to the boxes a and b, in box-local indices of a and of b
+    void overlap( Box &a, Box &b, std::vector<Run> &runs );
+    //! Exchanges the values of the components between the layouts src and dst of all MPI processes
+    //! Only the real part is exchanged if one of the layouts is real
+    void redistribute( std::vector<Box> &src, std::vector<Array> &src_arrays,
+                       std::vector<Box> &dst, std::vector<Array> &dst_arrays );
+    
+    //! FFTs along y and z of the components stored in slabs along x
+    void transformYZ( unsigned int ncomp, bool forward );
+    //! FFTs along x of the components stored in slabs along y
+    void transformX( unsigned int ncomp, bool forward );
+    //! Analytical advance of E and B in the Fourier space
+    void advance();
+    
+    //! Number of dimensions of the fields
+    unsigned int nDim_;
+    //! Number of cells of the whole grid (1 along z in 2D)
+    int N_[3];
+    //! Number of cells of the Domain block of an MPI process
+    int n_[3];
+    //! Number of ghost cells
+    int oversize_[3];
+    //! Cell lengths
+    double dx_[3];
+    double dt_;
+    
+    //! MPI process number and number of MPI processes
+    int rank_, nproc_;
+    
+    //! Owned points of the Domain blocks of all MPI processes
+    std::vector<Box> blocks_;
+    //! Points of the Domain blocks written back after the advance (owned and boundary points, periodically wrapped)
+    std::vector<Box> blocks_ext_;
+    //! Slabs along x and along y of all MPI processes
+    std::vector<Box> xslabs_;
+    std::vector<Box> yslabs_;
+    //! Size of the slabs of this MPI process
+    int nxslab_, nyslab_;
+    
+    //! Components in slabs along x and along y
+    std::vector<std::complex<double> > xslab_data_;
+    std::vector<std::complex<double> > yslab_data_;
+    //! Buffer for the transforms of strided lines
+    std::vector<std::complex<double> > line_;
+    
+    //! 1D transforms along each dimension
+    std::vector<FFT *> fft_;
+    //! Wave numbers along each dimension
+    std::vector<double> k_[3];
+    //! Half cell shift of the dual components exp(-i k dx/2) along each dimension
+    std::vector<std::complex<double> > half_shift_[3];
+    //! Nyquist modes along each dimension
+    std::vector<bool> nyquist_[3];
+    //! Dual directions of the components Ex, Ey, Ez, Bx, By, Bz, Jx, Jy, Jz
+    int isDual_[9][3];
+    
+    //! MPI buffers
+    std::vector<double> send_buffer_, recv_buffer_;
+    std::vector<int> send_counts_, send_displs_, recv_counts_, recv_displs_;
+    std::vector<Run> runs_;
+    
+};//END class
+
+#endif
+
@@ -4,6 +4,7 @@
 #include "Params.h"
 
 class ElectroMagn;
+class Patch;
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class Solver
@@ -17,6 +18,8 @@ public:
     virtual ~Solver() {};
     
     virtual void coupling( Params &params, ElectroMagn *EMfields ) {};
+    //! Set up of the solvers working on the whole Domain patch of an MPI process
+    virtual void setDomain( Params &params, Patch *patch ) {};
     //! Overloading of () operator
     virtual void operator()( ElectroMagn *fields ) = 0;
     
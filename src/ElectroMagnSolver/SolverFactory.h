@@ -9,6 +9,7 @@
 #include "MF_Solver1D_Yee.h"
 #include "MF_Solver2D_Yee.h"
 #include "MF_Solver3D_Yee.h"
+#include "MF_Solver3D_YeeTiled.h"
 #include "MF_SolverAM_Yee.h"
 #include "MF_Solver2D_Grassi.h"
 #include "MF_Solver2D_GrassiSpL.h"
@@ -19,6 +20,7 @@
 #include "PXR_Solver2D_GPSTD.h"
 #include "PXR_Solver3D_FDTD.h"
 #include "PXR_Solver3D_GPSTD.h"
+#include "PSATD_Solver.h"
 
 #include "Params.h"
 
@@ -39,9 +41,8 @@ public:
         } else if( params.geometry == "2Dcartesian" ) {
             if( params.is_pxr == false ) {
                 if( params.is_spectral ) {
-                    WARNING( "PS solveur are not available without Picsar" );
-                }
-                if( params.Friedman_filter ) {
+                    solver = new PSATD_Solver( params );
+                } else if( params.Friedman_filter ) {
                     solver = new MA_Solver2D_Friedman( params );
                 } else {
                     solver = new MA_Solver2D_norm( params );
@@ -53,9 +54,13 @@ public:
         } else if( params.geometry == "3Dcartesian" ) {
             if( params.is_pxr == false ) {
                 if( params.is_spectral ) {
-                    WARNING( "PS solveur are not available without Picsar" );
+                    solver = new PSATD_Solver( params );
+                } else if( params.maxwell_tile_size > 0 ) {
+                    // Maxwell-Ampere is done by the tiled Maxwell-Faraday solver
+                    solver = new NullSolver( params );
+                } else {
+                    solver = new MA_Solver3D_norm( params );
                 }
-                solver = new MA_Solver3D_norm( params );
             } else if( ( params.is_pxr == true ) && ( params.is_spectral == false ) ) {
                 solver = new PXR_Solver3D_FDTD( params );
             } else if( ( params.is_pxr == true ) && ( params.is_spectral == true ) ) {
@@ -85,7 +90,10 @@ public:
                 solver = new MF_Solver1D_Yee( params );
             }
         } else if( params.geometry == "2Dcartesian" ) {
-            if( params.is_pxr == false ) {
+            if( params.is_spectral ) {
+                // E and B are both advanced by the spectral solver
+                solver = new NullSolver( params );
+            } else if( params.is_pxr == false ) {
             
                 if( params.maxwell_sol == "Yee" ) {
                     solver = new MF_Solver2D_Yee( params );
@@ -98,14 +106,19 @@ public:
                 } else if( params.maxwell_sol == "Lehe" ) {
                     solver = new MF_Solver2D_Lehe( params );
                 }
-            } else if( params.is_spectral == true ) {
-                solver = new NullSolver( params );
             }
             
         } else if( params.geometry == "3Dcartesian" ) {
-            if( params.is_pxr == false ) {
+            if( params.is_spectral ) {
+                // E and B are both advanced by the spectral solver
+                solver = new NullSolver( params );
+            } else if( params.is_pxr == false ) {
                 if( params.maxwell_sol == "Yee" ) {
-                    solver = new MF_Solver3D_Yee( params );
+                    if( params.maxwell_tile_size > 0 ) {
+                        solver = new MF_Solver3D_YeeTiled( params );
+                    } else {
+                        solver = new MF_Solver3D_Yee( params );
+                    }
                 } else if( params.maxwell_sol == "Lehe" ) {
                     solver = new MF_Solver3D_Lehe( params );
                 }
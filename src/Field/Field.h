@@ -4,6 +4,7 @@
 #include <cmath>
 
 #include <vector>
+#include <algorithm>
 #include <cstdlib>
 #include <string>
 #include <iostream>
@@ -11,6 +12,7 @@
 
 #include "Tools.h"
 #include "AsyncMPIbuffers.h"
+#include "AlignedAllocator.h"
 
 class Params;
 class SmileiMPI;
@@ -37,26 +39,26 @@ public:
     std::string name;
     
     //! Constructor for Field: with no input argument
-    Field()
+    Field() : padded_( false )
     {
     };
     
     //! Constructor for Field: with the Field dimensions as input argument
-    Field( std::vector<unsigned int> dims )
+    Field( std::vector<unsigned int> dims ) : padded_( false )
     {
     };
     //! Constructor, isPrimal define if mainDim is Primal or Dual
-    Field( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal )
+    Field( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal ) : padded_( false )
     {
     };
     
     //! Constructor for Field: with the Field dimensions and dump file name as input argument
-    Field( std::vector<unsigned int> dims, std::string name_in ) : name( name_in )
+    Field( std::vector<unsigned int> dims, std::string name_in ) : name( name_in ), padded_( false )
     {
     } ;
     
     //! Constructor for Field: isPrimal define if mainDim is Primal or Dual
-    Field( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, std::string name_in ) : name( name_in )
+    Field( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, std::string name_in, bool padded = false ) : name( name_in ), padded_( padded )
     {
     } ;
     
@@ -87,6 +89,26 @@ public:
     //! keep track ofwich direction of the Field is dual
     std::vector<unsigned int> isDual_;
     
+    //! number of values allocated along each dimension : dims_, except along the last dimension of
+    //! a padded Field which is rounded up so that each row starts on a SMILEI_ALIGNMENT boundary
+    std::vector<unsigned int> paddedDims_;
+    //! true if the rows along the last dimension are padded (2D and 3D Fields, see allocateDims)
+    //! The padding values are never modified, and are hidden from the diagnostics, checkpoints and MPI exchanges
+    bool padded_;
+    
+    //! Number of values allocated for n values (of size bytes) along the last dimension of a padded Field
+    static inline unsigned int paddedSize( unsigned int n, std::size_t size = sizeof( fdouble ) )
+    {
+        unsigned int nalign = SMILEI_ALIGNMENT / size;
+        return ( ( n + nalign - 1 ) / nalign ) * nalign;
+    }
+    
+    //! Number of values of the Field, without the padding
+    inline unsigned int unpaddedSize()
+    {
+        return globalDims_ / paddedDims_.back() * dims_.back();
+    }
+    
     //! Return 0 if direction i is primal, 1 if dual
     inline unsigned int isDual( unsigned int i )
     {
@@ -103,24 +125,24 @@ public:
         return dims_;
     }
     //! All arrays may be viewed as a 1D array
-    //! Linearized diags
+    //! Linearized diags (including the padding)
     unsigned int globalDims_;
     //! pointer to the linearized array
-    double *data_;
+    fdouble *data_;
     
-    inline double *data()
+    inline fdouble *data()
     {
         return data_;
     }
     //! reference access to the linearized array (with check in DEBUG mode)
-    inline double &operator()( unsigned int i )
+    inline fdouble &operator()( unsigned int i )
     {
         DEBUGEXEC( if( i>=globalDims_ ) ERROR( name << " Out of limits "<< i << " < " << globalDims_ ) );
         DEBUGEXEC( if( !std::isfinite( data_[i] ) ) ERROR( name << " Not finite "<< i << " = " << data_[i] ) );
         return data_[i];
     };
     //! access to the linearized array (with check in DEBUG mode)
-    inline double operator()( unsigned int i ) const
+    inline fdouble operator()( unsigned int i ) const
     {
         DEBUGEXEC( if( i>=globalDims_ ) ERROR( name << " Out of limits "<< i ) );
         DEBUGEXEC( if( !std::isfinite( data_[i] ) ) ERROR( name << " Not finite "<< i << " = " << data_[i] ) );
@@ -146,34 +168,34 @@ public:
     
     
     //! 2D reference access to the linearized array (with check in DEBUG mode)
-    inline double &operator()( unsigned int i, unsigned int j )
+    inline fdouble &operator()( unsigned int i, unsigned int j )
     {
-        int unsigned idx = i*dims_[1]+j;
+        int unsigned idx = i*paddedDims_[1]+j;
         DEBUGEXEC( if( idx>=globalDims_ ) ERROR( "Out of limits & "<< i << " " << j ) );
         DEBUGEXEC( if( !std::isfinite( data_[idx] ) ) ERROR( "Not finite "<< i << " " << j << " = " << data_[idx] ) );
         return data_[idx];
     };
     //! 2D access to the linearized array (with check in DEBUG mode)
-    inline double operator()( unsigned int i, unsigned int j ) const
+    inline fdouble operator()( unsigned int i, unsigned int j ) const
     {
-        unsigned int idx = i*dims_[1]+j;
+        unsigned int idx = i*paddedDims_[1]+j;
         DEBUGEXEC( if( idx>=globalDims_ ) ERROR( "Out of limits "<< i << " " << j ) );
         DEBUGEXEC( if( !std::isfinite( data_[idx] ) ) ERROR( "Not finite "<< i << " " << j << " = " << data_[idx] ) );
         return data_[idx];
     };
     
     //! 3D reference access to the linearized array (with check in DEBUG mode)
-    inline double &operator()( unsigned int i, unsigned int j, unsigned k )
+    inline fdouble &operator()( unsigned int i, unsigned int j, unsigned k )
     {
-        unsigned int idx = i*dims_[1]*dims_[2]+j*dims_[2]+k;
+        unsigned int idx = i*paddedDims_[1]*paddedDims_[2]+j*paddedDims_[2]+k;
         DEBUGEXEC( if( idx>=globalDims_ ) ERROR( "Out of limits & "<< i << " " << j ) );
         DEBUGEXEC( if( !std::isfinite( data_[idx] ) ) ERROR( "Not finite "<< i << " " << j << " = " << data_[idx] ) );
         return data_[idx];
     };
     //! 3D access to the linearized array (with check in DEBUG mode)
-    inline double operator()( unsigned int i, unsigned int j, unsigned k ) const
+    inline fdouble operator()( unsigned int i, unsigned int j, unsigned k ) const
     {
-        unsigned int idx = i*dims_[1]*dims_[2]+j*dims_[2]+k;
+        unsigned int idx = i*paddedDims_[1]*paddedDims_[2]+j*paddedDims_[2]+k;
         DEBUGEXEC( if( idx>=globalDims_ ) ERROR( "Out of limits "<< i << " " << j ) );
         DEBUGEXEC( if( !std::isfinite( data_[idx] ) ) ERROR( "Not finite "<< i << " " << j << " = " << data_[idx] ) );
         return data_[idx];
@@ -192,7 +214,7 @@ public:
             if( i < ( int ) isDual_.size() ) {
                 idxlocalstart[i] = istart[i][isDual_[i]];
                 idxlocalend[i]   = istart[i][isDual_[i]]+bufsize[i][isDual_[i]];
-                globalsize[i]    = dims_[i];
+                globalsize[i]    = paddedDims_[i];
             } else {
             
                 idxlocalstart[i] = 0;
@@ -234,7 +256,30 @@ public:
     
     
 protected:
-
+    //! Allocate n values aligned on SMILEI_ALIGNMENT bytes (to be released with free)
+    template<typename T>
+    static T *allocateAligned( unsigned int n )
+    {
+        void *p = NULL;
+        if( posix_memalign( &p, SMILEI_ALIGNMENT, std::max( n, 1u )*sizeof( T ) ) != 0 ) {
+            ERROR( "Cannot allocate " << n << " values of " << sizeof( T ) << " bytes" );
+        }
+        return static_cast<T *>( p );
+    }
+    
+    //! Set paddedDims_ from dims_, and globalDims_ accordingly
+    inline void setPaddedDims( std::size_t size = sizeof( fdouble ) )
+    {
+        paddedDims_ = dims_;
+        if( padded_ && dims_.size() > 1 ) {
+            paddedDims_.back() = paddedSize( dims_.back(), size );
+        }
+        globalDims_ = 1;
+        for( unsigned int i=0 ; i<paddedDims_.size() ; i++ ) {
+            globalDims_ *= paddedDims_[i];
+        }
+    }
+    
 private:
 
 };
@@ -58,7 +58,7 @@ Field1D::Field1D( string name_in, vector<unsigned int> dims ) : Field( dims, nam
 Field1D::~Field1D()
 {
     if( data_!=NULL ) {
-        delete [] data_;
+        free( data_ );
     }
 }
 
@@ -75,19 +75,18 @@ void Field1D::allocateDims()
     
     isDual_.resize( dims_.size(), 0 );
     
-    data_ = new double[ dims_[0] ];
+    setPaddedDims();
+    data_ = allocateAligned<fdouble>( globalDims_ );
     //! \todo{change to memset (JD)}
     for( unsigned int i=0; i<dims_[0]; i++ ) {
         data_[i]=0.0;
     }
     
-    globalDims_ = dims_[0];
-    
 }
 
 void Field1D::deallocateDims()
 {
-    delete [] data_;
+    free( data_ );
     data_=NULL;
 }
 
@@ -125,14 +124,13 @@ void Field1D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    data_ = new double[ dims_[0] ];
+    setPaddedDims();
+    data_ = allocateAligned<fdouble>( globalDims_ );
     //! \todo{change to memset (JD)}
     for( unsigned int i=0; i<dims_[0]; i++ ) {
         data_[i]=0.0;
     }
     
-    globalDims_ = dims_[0];
-    
 }
 
 
@@ -141,7 +139,7 @@ void Field1D::allocateDims( unsigned int mainDim, bool isPrimal )
 // ---------------------------------------------------------------------------------------------------------------------
 void Field1D::shift_x( unsigned int delta )
 {
-    memmove( &( data_[0] ), &( data_[delta] ), ( dims_[0]-delta )*sizeof( double ) );
+    memmove( &( data_[0] ), &( data_[delta] ), ( dims_[0]-delta )*sizeof( fdouble ) );
     //memset ( &(data_[dims_[0]-delta]), 0, delta*sizeof(double));
     for( int i=dims_[0]-delta; i<( int )dims_[0]; i++ ) {
         data_[i] = 0.;
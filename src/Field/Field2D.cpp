@@ -43,7 +43,7 @@ Field2D::Field2D( vector<unsigned int> dims, unsigned int mainDim, bool isPrimal
 }
 
 // with the dimensions and output (dump) file name as input argument
-Field2D::Field2D( vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, string name_in ) : Field( dims, mainDim, isPrimal, name_in )
+Field2D::Field2D( vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, string name_in, bool padded ) : Field( dims, mainDim, isPrimal, name_in, padded )
 {
     data_=NULL;
     allocateDims( dims, mainDim, isPrimal );
@@ -65,7 +65,7 @@ Field2D::~Field2D()
 {
 
     if( data_!=NULL ) {
-        delete [] data_;
+        free( data_ );
         delete [] data_2D;
     }
 }
@@ -81,29 +81,28 @@ void Field2D::allocateDims()
         ERROR( "Alloc error must be 2 : " << dims_.size() );
     }
     if( data_!=NULL ) {
-        delete [] data_;
+        free( data_ );
     }
     
     isDual_.resize( dims_.size(), 0 );
     
-    data_ = new double[dims_[0]*dims_[1]];
+    setPaddedDims();
+    data_ = allocateAligned<fdouble>( globalDims_ );
     //! \todo{check row major order!!! (JD)}
     
-    data_2D= new double*[dims_[0]];
+    data_2D= new fdouble*[dims_[0]];
     for( unsigned int i=0; i<dims_[0]; i++ ) {
-        data_2D[i] = data_ + i*dims_[1];
-        for( unsigned int j=0; j<dims_[1]; j++ ) {
+        data_2D[i] = data_ + i*paddedDims_[1];
+        for( unsigned int j=0; j<paddedDims_[1]; j++ ) {
             data_2D[i][j] = 0.0;
         }
     }
     
-    globalDims_ = dims_[0]*dims_[1];
-    
 }
 
 void Field2D::deallocateDims()
 {
-    delete [] data_;
+    free( data_ );
     data_ = NULL;
     delete [] data_2D;
     data_2D = NULL;
@@ -128,7 +127,7 @@ void Field2D::allocateDims( unsigned int mainDim, bool isPrimal )
         ERROR( "Alloc error must be 2 : " << dims_.size() );
     }
     if( data_ ) {
-        delete [] data_;
+        free( data_ );
     }
     
     // isPrimal define if mainDim is Primal or Dual
@@ -145,19 +144,18 @@ void Field2D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    data_ = new double[dims_[0]*dims_[1]];
+    setPaddedDims();
+    data_ = allocateAligned<fdouble>( globalDims_ );
     //! \todo{check row major order!!! (JD)}
     
-    data_2D= new double*[dims_[0]];
+    data_2D= new fdouble*[dims_[0]];
     for( unsigned int i=0; i<dims_[0]; i++ )  {
-        data_2D[i] = data_ + i*dims_[1];
-        for( unsigned int j=0; j<dims_[1]; j++ ) {
+        data_2D[i] = data_ + i*paddedDims_[1];
+        for( unsigned int j=0; j<paddedDims_[1]; j++ ) {
             data_2D[i][j] = 0.0;
         }
     }
     
-    globalDims_ = dims_[0]*dims_[1];
-    
 }
 
 
@@ -167,8 +165,8 @@ void Field2D::allocateDims( unsigned int mainDim, bool isPrimal )
 // ---------------------------------------------------------------------------------------------------------------------
 void Field2D::shift_x( unsigned int delta )
 {
-    memmove( &( data_2D[0][0] ), &( data_2D[delta][0] ), ( dims_[1]*dims_[0]-delta*dims_[1] )*sizeof( double ) );
-    memset( &( data_2D[dims_[0]-delta][0] ), 0, delta*dims_[1]*sizeof( double ) );
+    memmove( &( data_2D[0][0] ), &( data_2D[delta][0] ), ( paddedDims_[1]*dims_[0]-delta*paddedDims_[1] )*sizeof( fdouble ) );
+    memset( &( data_2D[dims_[0]-delta][0] ), 0, delta*paddedDims_[1]*sizeof( fdouble ) );
     
 }
 
@@ -27,7 +27,7 @@ public:
     //! Constructor for Field2D: with the vector dimension and filename for the dump as input argument
     Field2D( std::vector<unsigned int> dims, std::string name );
     //! Constructor, isPrimal define if mainDim is Primal or Dual and a name
-    Field2D( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, std::string name );
+    Field2D( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, std::string name, bool padded = false );
     
     //! Constructor, without allocating
     Field2D( std::string name, std::vector<unsigned int> dims );
@@ -58,7 +58,7 @@ public:
     virtual void shift_x( unsigned int delta ) override;
     
     //! Overloading of the () operator allowing to set a new value for the (i,j) element of a Field2D
-    inline double &operator()( unsigned int i, unsigned int j )
+    inline fdouble &operator()( unsigned int i, unsigned int j )
     {
         DEBUGEXEC( if( i>=dims_[0] || j>=dims_[1] ) ERROR( name << "Out of limits ("<< i << "," << j << ")  > (" <<dims_[0] << "," <<dims_[1] << ")" ) );
         DEBUGEXEC( if( !std::isfinite( data_2D[i][j] ) ) ERROR( name << " Not finite "<< i << "," << j << " = " << data_2D[i][j] ) );
@@ -72,7 +72,7 @@ public:
     };*/
     
     //! Overloading of the () operator allowing to get the value of the (i,j) element of a Field2D
-    inline double operator()( unsigned int i, unsigned int j ) const
+    inline fdouble operator()( unsigned int i, unsigned int j ) const
     {
         DEBUGEXEC( if( i>=dims_[0] || j>=dims_[1] ) ERROR( name << "Out of limits "<< i << " " << j ) );
         DEBUGEXEC( if( !std::isfinite( data_2D[i][j] ) ) ERROR( name << "Not finite "<< i << "," << j << " = " << data_2D[i][j] ) );
@@ -94,7 +94,7 @@ public:
     //!\todo{Comment what are these stuffs (MG for JD)}
     //double *data_2D;
     //! this will present the data as a 2d matrix
-    double **data_2D;
+    fdouble **data_2D;
     
 };
 
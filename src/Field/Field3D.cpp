@@ -45,7 +45,7 @@ Field3D::Field3D( vector<unsigned int> dims, unsigned int mainDim, bool isPrimal
 }
 
 // with the dimensions and output (dump) file name as input argument
-Field3D::Field3D( vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, string name_in ) : Field( dims, mainDim, isPrimal, name_in )
+Field3D::Field3D( vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, string name_in, bool padded ) : Field( dims, mainDim, isPrimal, name_in, padded )
 {
     data_=NULL;
     allocateDims( dims, mainDim, isPrimal );
@@ -66,7 +66,7 @@ Field3D::Field3D( string name_in, vector<unsigned int> dims ) : Field( dims, nam
 Field3D::~Field3D()
 {
     if( data_!=NULL ) {
-        delete [] data_;
+        free( data_ );
         for( unsigned int i=0; i<dims_[0]; i++ ) {
             delete [] this->data_3D[i];
         }
@@ -84,31 +84,30 @@ void Field3D::allocateDims()
         ERROR( "Alloc error must be 3 : " << dims_.size() );
     }
     if( data_ ) {
-        delete [] data_;
+        free( data_ );
     }
     
     isDual_.resize( dims_.size(), 0 );
     
-    data_ = new double[dims_[0]*dims_[1]*dims_[2]];
+    setPaddedDims();
+    data_ = allocateAligned<fdouble>( globalDims_ );
     //! \todo{check row major order!!!}
-    data_3D= new double **[dims_[0]];
+    data_3D= new fdouble **[dims_[0]];
     for( unsigned int i=0; i<dims_[0]; i++ ) {
-        data_3D[i]= new double*[dims_[1]];
+        data_3D[i]= new fdouble*[dims_[1]];
         for( unsigned int j=0; j<dims_[1]; j++ ) {
-            data_3D[i][j] = data_ + i*dims_[1]*dims_[2] + j*dims_[2];
-            for( unsigned int k=0; k<dims_[2]; k++ ) {
+            data_3D[i][j] = data_ + i*paddedDims_[1]*paddedDims_[2] + j*paddedDims_[2];
+            for( unsigned int k=0; k<paddedDims_[2]; k++ ) {
                 this->data_3D[i][j][k] = 0.0;
             }
         }
     }//i
     
-    globalDims_ = dims_[0]*dims_[1]*dims_[2];
-    
 }
 
 void Field3D::deallocateDims()
 {
-    delete [] data_;
+    free( data_ );
     data_ = NULL;
     for( unsigned int i=0; i<dims_[0]; i++ ) {
         delete [] data_3D[i];
@@ -138,7 +137,7 @@ void Field3D::allocateDims( unsigned int mainDim, bool isPrimal )
         ERROR( "Alloc error must be 3 : " << dims_.size() );
     }
     if( data_ ) {
-        delete [] data_;
+        free( data_ );
     }
     
     // isPrimal define if mainDim is Primal or Dual
@@ -155,21 +154,20 @@ void Field3D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    data_ = new double[dims_[0]*dims_[1]*dims_[2]];
+    setPaddedDims();
+    data_ = allocateAligned<fdouble>( globalDims_ );
     //! \todo{check row major order!!!}
-    data_3D= new double **[dims_[0]*dims_[1]];
+    data_3D= new fdouble **[dims_[0]*dims_[1]];
     for( unsigned int i=0; i<dims_[0]; i++ ) {
-        data_3D[i]= new double*[dims_[1]];
+        data_3D[i]= new fdouble*[dims_[1]];
         for( unsigned int j=0; j<dims_[1]; j++ ) {
-            this->data_3D[i][j] = data_ + i*dims_[1]*dims_[2] + j*dims_[2];
-            for( unsigned int k=0; k<dims_[2]; k++ ) {
+            this->data_3D[i][j] = data_ + i*paddedDims_[1]*paddedDims_[2] + j*paddedDims_[2];
+            for( unsigned int k=0; k<paddedDims_[2]; k++ ) {
                 this->data_3D[i][j][k] = 0.0;
             }
         }
     }//i
     
-    globalDims_ = dims_[0]*dims_[1]*dims_[2];
-    
     //isDual_ = isPrimal;
 }
 
@@ -180,8 +178,8 @@ void Field3D::allocateDims( unsigned int mainDim, bool isPrimal )
 // ---------------------------------------------------------------------------------------------------------------------
 void Field3D::shift_x( unsigned int delta )
 {
-    memmove( &( data_3D[0][0][0] ), &( data_3D[delta][0][0] ), ( dims_[2]*dims_[1]*dims_[0]-delta*dims_[2]*dims_[1] )*sizeof( double ) );
-    memset( &( data_3D[dims_[0]-delta][0][0] ), 0, delta*dims_[1]*dims_[2]*sizeof( double ) );
+    memmove( &( data_3D[0][0][0] ), &( data_3D[delta][0][0] ), ( paddedDims_[2]*dims_[1]*dims_[0]-delta*paddedDims_[2]*dims_[1] )*sizeof( fdouble ) );
+    memset( &( data_3D[dims_[0]-delta][0][0] ), 0, delta*dims_[1]*paddedDims_[2]*sizeof( fdouble ) );
     
 }
 
@@ -28,7 +28,7 @@ public:
     //! Constructor for Field2D: with the vector dimension and filename for the dump as input argument
     Field3D( std::vector<unsigned int> dims, std::string name );
     //! Constructor, isPrimal define if mainDim is Primal or Dual and a name
-    Field3D( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, std::string name );
+    Field3D( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, std::string name, bool padded = false );
     
     //! Constructor, without allocating
     Field3D( std::string name, std::vector<unsigned int> dims );
@@ -59,7 +59,7 @@ public:
     virtual void shift_x( unsigned int delta ) override;
     
     //! Overloading of the () operator allowing to set a new value for the (i,j,k) element of a Field3D
-    inline double &operator()( unsigned int i, unsigned int j, unsigned int k )
+    inline fdouble &operator()( unsigned int i, unsigned int j, unsigned int k )
     {
         DEBUGEXEC( if( i>=dims_[0] || j>=dims_[1] || k >= dims_[2] ) ERROR( name << "Out of limits & "<< i << " " << j << " " << k ) );
         return data_3D[i][j][k];
@@ -73,7 +73,7 @@ public:
     };*/
     
     //! Overloading of the () operator allowing to get the value for the (i,j,k) element of a Field3D
-    inline double operator()( unsigned int i, unsigned int j, unsigned int k ) const
+    inline fdouble operator()( unsigned int i, unsigned int j, unsigned int k ) const
     {
         DEBUGEXEC( if( i>=dims_[0] || j>=dims_[1] || k >= dims_[2] ) ERROR( name << "Out of limits "<< i << " " << j << " " << k ) );
         return data_3D[i][j][k];
@@ -97,7 +97,7 @@ public:
     //!\todo{Comment what are these stuffs (MG for JD)}
     //double *data_3D;
     //! this will present the data as a 3d matrix
-    double ***data_3D;
+    fdouble ***data_3D;
     
 };
 
@@ -33,7 +33,7 @@ public:
     {
     };
     //! Constructor, isPrimal define if mainDim is Primal or Dual and a name
-    cField( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, std::string name_in ) : Field( dims, mainDim, isPrimal, name_in )
+    cField( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, std::string name_in, bool padded = false ) : Field( dims, mainDim, isPrimal, name_in, padded )
     {
     };
     
@@ -67,7 +67,7 @@ public:
     //! 2D reference access to the linearized array (with check in DEBUG mode)
     inline std::complex<double> &operator()( unsigned int i, unsigned int j )
     {
-        int unsigned idx = i*dims_[1]+j;
+        int unsigned idx = i*paddedDims_[1]+j;
         DEBUGEXEC( if( idx>=globalDims_ ) ERROR( "Out of limits & "<< i << " " << j ) );
         DEBUGEXEC( if( !std::isfinite( real( cdata_[idx] )+imag( cdata_[idx] ) ) ) ERROR( "Not finite "<< i << " " << j << " = " << cdata_[idx] ) );
         return cdata_[idx];
@@ -75,7 +75,7 @@ public:
     //! 2D access to the linearized array (with check in DEBUG mode)
     inline std::complex<double> operator()( unsigned int i, unsigned int j ) const
     {
-        unsigned int idx = i*dims_[1]+j;
+        unsigned int idx = i*paddedDims_[1]+j;
         DEBUGEXEC( if( idx>=globalDims_ ) ERROR( "Out of limits "<< i << " " << j ) );
         DEBUGEXEC( if( !std::isfinite( real( cdata_[idx] )+imag( cdata_[idx] ) ) ) ERROR( "Not finite "<< i << " " << j << " = " << cdata_[idx] ) );
         return cdata_[idx];
@@ -58,7 +58,7 @@ cField1D::cField1D( string name, vector<unsigned int> dims ) : cField( dims, nam
 cField1D::~cField1D()
 {
     if( cdata_!=NULL ) {
-        delete [] cdata_;
+        free( cdata_ );
     }
 }
 
@@ -75,19 +75,18 @@ void cField1D::allocateDims()
     
     isDual_.resize( dims_.size(), 0 );
     
-    cdata_ = new complex<double>[ dims_[0] ];
+    setPaddedDims( sizeof( complex<double> ) );
+    cdata_ = allocateAligned<complex<double> >( globalDims_ );
     //! \todo{change to memset (JD)}
     for( unsigned int i=0; i<dims_[0]; i++ ) {
         cdata_[i]=0.0;
     }
     
-    globalDims_ = dims_[0];
-    
 }
 
 void cField1D::deallocateDims()
 {
-    delete [] cdata_;
+    free( cdata_ );
     cdata_=NULL;
 }
 
@@ -125,14 +124,13 @@ void cField1D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    cdata_ = new complex<double>[ dims_[0] ];
+    setPaddedDims( sizeof( complex<double> ) );
+    cdata_ = allocateAligned<complex<double> >( globalDims_ );
     //! \todo{change to memset (JD)}
     for( unsigned int i=0; i<dims_[0]; i++ ) {
         cdata_[i]=0.0;
     }
     
-    globalDims_ = dims_[0];
-    
 }
 
 
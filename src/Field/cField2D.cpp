@@ -44,7 +44,7 @@ cField2D::cField2D( vector<unsigned int> dims, unsigned int mainDim, bool isPrim
 }
 
 // with the dimensions and output (dump) file name as input argument
-cField2D::cField2D( vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, string name_in ) : cField( dims, mainDim, isPrimal, name_in )
+cField2D::cField2D( vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, string name_in, bool padded ) : cField( dims, mainDim, isPrimal, name_in, padded )
 {
     cdata_=NULL;
     allocateDims( dims, mainDim, isPrimal );
@@ -66,7 +66,7 @@ cField2D::~cField2D()
 {
 
     if( cdata_!=NULL ) {
-        delete [] cdata_;
+        free( cdata_ );
         delete [] data_2D;
     }
 }
@@ -82,29 +82,28 @@ void cField2D::allocateDims()
         ERROR( "Alloc error must be 2 : " << dims_.size() );
     }
     if( cdata_!=NULL ) {
-        delete [] cdata_;
+        free( cdata_ );
     }
     
     isDual_.resize( dims_.size(), 0 );
     
-    cdata_ = new complex<double>[dims_[0]*dims_[1]];
+    setPaddedDims( sizeof( complex<double> ) );
+    cdata_ = allocateAligned<complex<double> >( globalDims_ );
     //! \todo{check row major order!!! (JD)}
     
     data_2D= new complex<double> *[dims_[0]];
     for( unsigned int i=0; i<dims_[0]; i++ ) {
-        data_2D[i] = cdata_ + i*dims_[1];
-        for( unsigned int j=0; j<dims_[1]; j++ ) {
+        data_2D[i] = cdata_ + i*paddedDims_[1];
+        for( unsigned int j=0; j<paddedDims_[1]; j++ ) {
             data_2D[i][j] = 0.0;
         }
     }
     
-    globalDims_ = dims_[0]*dims_[1];
-    
 }
 
 void cField2D::deallocateDims()
 {
-    delete [] cdata_;
+    free( cdata_ );
     cdata_ = NULL;
     delete [] data_2D;
     data_2D = NULL;
@@ -129,7 +128,7 @@ void cField2D::allocateDims( unsigned int mainDim, bool isPrimal )
         ERROR( "Alloc error must be 2 : " << dims_.size() );
     }
     if( cdata_ ) {
-        delete [] cdata_;
+        free( cdata_ );
     }
     
     // isPrimal define if mainDim is Primal or Dual
@@ -146,19 +145,18 @@ void cField2D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    cdata_ = new complex<double>[dims_[0]*dims_[1]];
+    setPaddedDims( sizeof( complex<double> ) );
+    cdata_ = allocateAligned<complex<double> >( globalDims_ );
     //! \todo{check row major order!!! (JD)}
     
     data_2D= new complex<double> *[dims_[0]];
     for( unsigned int i=0; i<dims_[0]; i++ )  {
-        data_2D[i] = cdata_ + i*dims_[1];
-        for( unsigned int j=0; j<dims_[1]; j++ ) {
+        data_2D[i] = cdata_ + i*paddedDims_[1];
+        for( unsigned int j=0; j<paddedDims_[1]; j++ ) {
             data_2D[i][j] = 0.0;
         }
     }
     
-    globalDims_ = dims_[0]*dims_[1];
-    
 }
 
 
@@ -168,8 +166,8 @@ void cField2D::allocateDims( unsigned int mainDim, bool isPrimal )
 // ---------------------------------------------------------------------------------------------------------------------
 void cField2D::shift_x( unsigned int delta )
 {
-    memmove( &( data_2D[0][0] ), &( data_2D[delta][0] ), ( dims_[1]*dims_[0]-delta*dims_[1] )*sizeof( complex<double> ) );
-    memset( &( data_2D[dims_[0]-delta][0] ), 0, delta*dims_[1]*sizeof( complex<double> ) );
+    memmove( &( data_2D[0][0] ), &( data_2D[delta][0] ), ( paddedDims_[1]*dims_[0]-delta*paddedDims_[1] )*sizeof( complex<double> ) );
+    memset( &( data_2D[dims_[0]-delta][0] ), 0, delta*paddedDims_[1]*sizeof( complex<double> ) );
     
 }
 
@@ -24,7 +24,7 @@ public:
     //! Constructor for cField2D: with the vector dimension and filename for the dump as input argument
     cField2D( std::vector<unsigned int> dims, std::string name );
     //! Constructor, isPrimal define if mainDim is Primal or Dual and a name
-    cField2D( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, std::string name );
+    cField2D( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, std::string name, bool padded = false );
     
     //! Constructor, without allocating
     cField2D( std::string name, std::vector<unsigned int> dims );
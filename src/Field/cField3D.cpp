@@ -40,7 +40,7 @@ cField3D::cField3D( vector<unsigned int> dims, unsigned int mainDim, bool isPrim
 }
 
 // with the dimensions and output (dump) file name as input argument
-cField3D::cField3D( vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, string name_in ) : cField( dims, mainDim, isPrimal, name_in )
+cField3D::cField3D( vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, string name_in, bool padded ) : cField( dims, mainDim, isPrimal, name_in, padded )
 {
     cdata_=NULL;
     allocateDims( dims, mainDim, isPrimal );
@@ -62,7 +62,7 @@ cField3D::~cField3D()
 {
 
     if( cdata_!=NULL ) {
-        delete [] cdata_;
+        free( cdata_ );
         for( unsigned int i=0; i<dims_[0]; i++ ) {
             delete [] data_3D[i];
         }
@@ -81,31 +81,30 @@ void cField3D::allocateDims()
         ERROR( "Alloc error must be 3 : " << dims_.size() );
     }
     if( cdata_!=NULL ) {
-        delete [] cdata_;
+        free( cdata_ );
     }
     
     isDual_.resize( dims_.size(), 0 );
     
-    cdata_ = new complex<double>[dims_[0]*dims_[1]*dims_[2]];
+    setPaddedDims( sizeof( complex<double> ) );
+    cdata_ = allocateAligned<complex<double> >( globalDims_ );
     //! \todo{check row major order!!! (JD)}
     
     data_3D= new complex<double> **[dims_[0]];
     for( unsigned int i=0; i<dims_[0]; i++ ) {
         data_3D[i]= new complex<double> *[dims_[1]];
         for( unsigned int j=0; j<dims_[1]; j++ ) {
-            data_3D[i][j] = cdata_ + i*dims_[1]*dims_[2] + j*dims_[2];
-            for( unsigned int k=0; k<dims_[2]; k++ ) {
+            data_3D[i][j] = cdata_ + i*paddedDims_[1]*paddedDims_[2] + j*paddedDims_[2];
+            for( unsigned int k=0; k<paddedDims_[2]; k++ ) {
                 data_3D[i][j][k] = 0.0;
             }
         }
     }
-    globalDims_ = dims_[0]*dims_[1]*dims_[2];
-    
 }
 
 void cField3D::deallocateDims()
 {
-    delete [] cdata_;
+    free( cdata_ );
     cdata_ = NULL;
     delete [] data_3D;
     data_3D = NULL;
@@ -131,7 +130,7 @@ void cField3D::allocateDims( unsigned int mainDim, bool isPrimal )
         ERROR( "Alloc error must be 3 : " << dims_.size() );
     }
     if( cdata_ ) {
-        delete [] cdata_;
+        free( cdata_ );
     }
     
     // isPrimal define if mainDim is Primal or Dual
@@ -148,23 +147,22 @@ void cField3D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    cdata_ = new complex<double>[dims_[0]*dims_[1]*dims_[2]];
+    setPaddedDims( sizeof( complex<double> ) );
+    cdata_ = allocateAligned<complex<double> >( globalDims_ );
     //! \todo{check row major order!!! (JD)}
     
     data_3D= new complex<double> **[dims_[0]];
     for( unsigned int i=0; i<dims_[0]; i++ )  {
         data_3D[i]= new complex<double> *[dims_[1]];
         for( unsigned int j=0; j<dims_[1]; j++ ) {
-            data_3D[i][j] = cdata_ + i*dims_[1]*dims_[2] + j*dims_[2];
-            for( unsigned int k=0; k<dims_[2]; k++ ) {
+            data_3D[i][j] = cdata_ + i*paddedDims_[1]*paddedDims_[2] + j*paddedDims_[2];
+            for( unsigned int k=0; k<paddedDims_[2]; k++ ) {
                 data_3D[i][j][k] = 0.0;
             }
         }
         
     }
     
-    globalDims_ = dims_[0]*dims_[1]*dims_[2];
-    
 }
 
 
@@ -26,7 +26,7 @@ public:
     //! Constructor for cField3D: with the vector dimension and filename for the dump as input argument
     cField3D( std::vector<unsigned int> dims, std::string name );
     //! Constructor, isPrimal define if mainDim is Primal or Dual and a name
-    cField3D( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, std::string name );
+    cField3D( std::vector<unsigned int> dims, unsigned int mainDim, bool isPrimal, std::string name, bool padded = false );
     
     //! Constructor, without allocating
     cField3D( std::string name, std::vector<unsigned int> dims );
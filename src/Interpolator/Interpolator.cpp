@@ -9,6 +9,7 @@
 using namespace std;
 
 Interpolator::Interpolator( Params &params, Patch *patch )
+    : reconstruct_old_positions( params.reconstruct_old_positions )
 {
 }
 
@@ -39,6 +39,10 @@ public:
         ERROR( "Envelope not implemented with this geometry and this order" );
     };
     
+protected:
+    //! If true, the former cell index and position are not buffered for the projectors
+    bool reconstruct_old_positions;
+    
 private:
 
 };//END class
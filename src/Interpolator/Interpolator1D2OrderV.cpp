@@ -0,0 +1,222 @@
+#include "Interpolator1D2OrderV.h"
+
+#include <cmath>
+#include <iostream>
+
+#include "ElectroMagn.h"
+#include "Field1D.h"
+#include "Particles.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Creator for Interpolator1D2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Interpolator1D2OrderV::Interpolator1D2OrderV( Params &params, Patch *patch ) : Interpolator1D( params, patch )
+{
+    dx_inv_ = 1.0/params.cell_length[0];
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 2nd Order vectorized interpolation of the fields for all particles of a cell (3 nodes are used)
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator1D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    if( istart[0] == iend[0] ) {
+        return;    //Don't treat empty cells.
+    }
+    
+    int nparts( ( smpi->dynamics_invgf[ithread] ).size() );
+    
+    double *Epart[3], *Bpart[3];
+    
+    double *deltaO = &( smpi->dynamics_deltaold[ithread][0] );
+    
+    for( unsigned int k=0; k<3; k++ ) {
+        Epart[k]= &( smpi->dynamics_Epart[ithread][k*nparts] );
+        Bpart[k]= &( smpi->dynamics_Bpart[ithread][k*nparts] );
+    }
+    
+    //Primal index is constant over the all cell
+    int idx  = round( particles.position( 0, *istart ) * dx_inv_ );
+    int idxO = idx - index_domain_begin -1 ;
+    
+    Field1D *Ex1D = static_cast<Field1D *>( EMfields->Ex_ );
+    Field1D *Ey1D = static_cast<Field1D *>( EMfields->Ey_ );
+    Field1D *Ez1D = static_cast<Field1D *>( EMfields->Ez_ );
+    Field1D *Bx1D = static_cast<Field1D *>( EMfields->Bx_m );
+    Field1D *By1D = static_cast<Field1D *>( EMfields->By_m );
+    Field1D *Bz1D = static_cast<Field1D *>( EMfields->Bz_m );
+    
+    double coeff[2][3][32];
+    int dual[32]; // Boolean indicating if the part has a dual indice equal to the primal one (dual=0) or if it is +1 (dual=1).
+    
+    int vecSize = 32;
+    
+    int cell_nparts( ( int )iend[0]-( int )istart[0] );
+    
+    for( int ivect=0 ; ivect < cell_nparts; ivect += vecSize ) {
+        
+        int np_computed = min( cell_nparts-ivect, vecSize );
+        
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            
+            double delta0, delta;
+            double delta2;
+            
+            delta0 = particles.position( 0, ipart+ivect+istart[0] )*dx_inv_;
+            dual[ipart] = ( delta0 - ( double )idx >=0. );
+            
+            for( int j=0; j<2; j++ ) { // for dual
+                
+                delta   = delta0 - ( double )idx + ( double )j*( 0.5-dual[ipart] );
+                delta2  = delta*delta;
+                
+                coeff[j][0][ipart]    =  0.5 * ( delta2-delta+0.25 );
+                coeff[j][1][ipart]    = ( 0.75 - delta2 );
+                coeff[j][2][ipart]    =  0.5 * ( delta2+delta+0.25 );
+                
+                if( j==0 ) {
+                    deltaO[ipart-ipart_ref+ivect+istart[0]] = delta;
+                }
+            }
+        }
+        
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            
+            double *coeffxp = &( coeff[0][1][ipart] );
+            double *coeffxd = &( coeff[1][1][ipart] );
+            
+            double interp_Ex = 0.;
+            double interp_By = 0.;
+            double interp_Bz = 0.;
+            double interp_Ey = 0.;
+            double interp_Ez = 0.;
+            double interp_Bx = 0.;
+            for( int iloc=-1 ; iloc<2 ; iloc++ ) {
+                // Dual grid : Ex, By, Bz
+                double cd = *( coeffxd+iloc*32 );
+                interp_Ex += cd * ( ( 1-dual[ipart] )*( *Ex1D )( idxO+1+iloc ) + dual[ipart]*( *Ex1D )( idxO+2+iloc ) );
+                interp_By += cd * ( ( 1-dual[ipart] )*( *By1D )( idxO+1+iloc ) + dual[ipart]*( *By1D )( idxO+2+iloc ) );
+                interp_Bz += cd * ( ( 1-dual[ipart] )*( *Bz1D )( idxO+1+iloc ) + dual[ipart]*( *Bz1D )( idxO+2+iloc ) );
+                // Primal grid : Ey, Ez, Bx
+                double cp = *( coeffxp+iloc*32 );
+                interp_Ey += cp * ( *Ey1D )( idxO+1+iloc );
+                interp_Ez += cp * ( *Ez1D )( idxO+1+iloc );
+                interp_Bx += cp * ( *Bx1D )( idxO+1+iloc );
+            }
+            Epart[0][ipart-ipart_ref+ivect+istart[0]] = interp_Ex;
+            Epart[1][ipart-ipart_ref+ivect+istart[0]] = interp_Ey;
+            Epart[2][ipart-ipart_ref+ivect+istart[0]] = interp_Ez;
+            Bpart[0][ipart-ipart_ref+ivect+istart[0]] = interp_Bx;
+            Bpart[1][ipart-ipart_ref+ivect+istart[0]] = interp_By;
+            Bpart[2][ipart-ipart_ref+ivect+istart[0]] = interp_Bz;
+        }
+    }
+    
+} // END Interpolator1D2OrderV
+
+void Interpolator1D2OrderV::fieldsAndCurrents( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, LocalFields *JLoc, double *RhoLoc )
+{
+    // iend not used for now
+    // probes are interpolated one by one for now
+    
+    int ipart = *istart;
+    int nparts( particles.size() );
+    
+    double *Epart[3], *Bpart[3];
+    
+    for( unsigned int k=0; k<3; k++ ) {
+        Epart[k]= &( smpi->dynamics_Epart[ithread][k*nparts] );
+        Bpart[k]= &( smpi->dynamics_Bpart[ithread][k*nparts] );
+    }
+    
+    int idx  = round( particles.position( 0, ipart ) * dx_inv_ );
+    int idxO = idx - index_domain_begin -1 ;
+    
+    Field1D *Ex1D = static_cast<Field1D *>( EMfields->Ex_ );
+    Field1D *Ey1D = static_cast<Field1D *>( EMfields->Ey_ );
+    Field1D *Ez1D = static_cast<Field1D *>( EMfields->Ez_ );
+    Field1D *Bx1D = static_cast<Field1D *>( EMfields->Bx_m );
+    Field1D *By1D = static_cast<Field1D *>( EMfields->By_m );
+    Field1D *Bz1D = static_cast<Field1D *>( EMfields->Bz_m );
+    Field1D *Jx1D = static_cast<Field1D *>( EMfields->Jx_ );
+    Field1D *Jy1D = static_cast<Field1D *>( EMfields->Jy_ );
+    Field1D *Jz1D = static_cast<Field1D *>( EMfields->Jz_ );
+    Field1D *rho1D = static_cast<Field1D *>( EMfields->rho_ );
+    
+    double coeff[2][3];
+    
+    double delta0 = particles.position( 0, ipart )*dx_inv_;
+    int dual = ( delta0 - ( double )idx >=0. );
+    
+    for( int j=0; j<2; j++ ) { // for dual
+        double delta  = delta0 - ( double )idx + ( double )j*( 0.5-dual );
+        double delta2 = delta*delta;
+        
+        coeff[j][0]    =  0.5 * ( delta2-delta+0.25 );
+        coeff[j][1]    = ( 0.75 - delta2 );
+        coeff[j][2]    =  0.5 * ( delta2+delta+0.25 );
+    }
+    
+    double *coeffxp = &( coeff[0][1] );
+    double *coeffxd = &( coeff[1][1] );
+    
+    double interp_Ex = 0., interp_By = 0., interp_Bz = 0., interp_Jx = 0.;
+    double interp_Ey = 0., interp_Ez = 0., interp_Bx = 0.;
+    double interp_Jy = 0., interp_Jz = 0., interp_rho = 0.;
+    for( int iloc=-1 ; iloc<2 ; iloc++ ) {
+        // Dual grid : Ex, By, Bz, Jx
+        double cd = *( coeffxd+iloc );
+        interp_Ex += cd * ( ( 1-dual )*( *Ex1D )( idxO+1+iloc ) + dual*( *Ex1D )( idxO+2+iloc ) );
+        interp_By += cd * ( ( 1-dual )*( *By1D )( idxO+1+iloc ) + dual*( *By1D )( idxO+2+iloc ) );
+        interp_Bz += cd * ( ( 1-dual )*( *Bz1D )( idxO+1+iloc ) + dual*( *Bz1D )( idxO+2+iloc ) );
+        interp_Jx += cd * ( ( 1-dual )*( *Jx1D )( idxO+1+iloc ) + dual*( *Jx1D )( idxO+2+iloc ) );
+        // Primal grid : Ey, Ez, Bx, Jy, Jz, rho
+        double cp = *( coeffxp+iloc );
+        interp_Ey  += cp * ( *Ey1D )( idxO+1+iloc );
+        interp_Ez  += cp * ( *Ez1D )( idxO+1+iloc );
+        interp_Bx  += cp * ( *Bx1D )( idxO+1+iloc );
+        interp_Jy  += cp * ( *Jy1D )( idxO+1+iloc );
+        interp_Jz  += cp * ( *Jz1D )( idxO+1+iloc );
+        interp_rho += cp * ( *rho1D )( idxO+1+iloc );
+    }
+    Epart[0][ipart] = interp_Ex;
+    Epart[1][ipart] = interp_Ey;
+    Epart[2][ipart] = interp_Ez;
+    Bpart[0][ipart] = interp_Bx;
+    Bpart[1][ipart] = interp_By;
+    Bpart[2][ipart] = interp_Bz;
+    JLoc->x = interp_Jx;
+    JLoc->y = interp_Jy;
+    JLoc->z = interp_Jz;
+    ( *RhoLoc ) = interp_rho;
+    
+}
+
+
+// Interpolator on another field than the basic ones
+void Interpolator1D2OrderV::oneField( Field *field, Particles &particles, int *istart, int *iend, double *FieldLoc )
+{
+    ERROR( "Single field 1D2O interpolator not available in vectorized mode" );
+}
+
+void Interpolator1D2OrderV::fieldsAndEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    ERROR( "Vectorized interpolation for the envelope model is not implemented for 1D geometry" );
+} // END Interpolator1D2OrderV
+
+
+void Interpolator1D2OrderV::timeCenteredEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    ERROR( "Vectorized interpolation for the envelope model is not implemented for 1D geometry" );
+} // END Interpolator1D2OrderV
+
+
+void Interpolator1D2OrderV::envelopeAndSusceptibility( ElectroMagn *EMfields, Particles &particles, int ipart, double *Env_A_abs_Loc, double *Env_Chi_Loc, double *Env_E_abs_Loc )
+{
+    ERROR( "Vectorized interpolation for the envelope model is not implemented for 1D geometry" );
+} // END Interpolator1D2OrderV
@@ -0,0 +1,30 @@
+#ifndef INTERPOLATOR1D2ORDERV_H
+#define INTERPOLATOR1D2ORDERV_H
+
+
+#include "Interpolator1D.h"
+#include "Field1D.h"
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class for vectorized 2nd order interpolator for 1Dcartesian simulations
+//  --------------------------------------------------------------------------------------------------------------------
+class Interpolator1D2OrderV : public Interpolator1D
+{
+    
+public:
+    Interpolator1D2OrderV( Params &, Patch * );
+    ~Interpolator1D2OrderV() override final {};
+    
+    void fieldsAndCurrents( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, LocalFields *JLoc, double *RhoLoc ) override final ;
+    void fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void fieldsSelection( ElectroMagn *EMfields, Particles &particles, double *buffer, int offset, std::vector<unsigned int> *selection ) override final {};
+    void oneField( Field *field, Particles &particles, int *istart, int *iend, double *FieldLoc ) override final;
+    
+    void fieldsAndEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void timeCenteredEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void envelopeAndSusceptibility( ElectroMagn *EMfields, Particles &particles, int ipart, double *Env_A_abs_Loc, double *Env_Chi_Loc, double *Env_E_abs_Loc ) override final;
+    
+};//END class
+
+#endif
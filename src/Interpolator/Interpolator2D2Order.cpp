@@ -128,8 +128,12 @@ void Interpolator2D2Order::fieldsWrapper( ElectroMagn *EMfields, Particles &part
 {
     std::vector<double> *Epart = &( smpi->dynamics_Epart[ithread] );
     std::vector<double> *Bpart = &( smpi->dynamics_Bpart[ithread] );
-    std::vector<int> *iold = &( smpi->dynamics_iold[ithread] );
-    std::vector<double> *delta = &( smpi->dynamics_deltaold[ithread] );
+    std::vector<int> *iold = NULL;
+    std::vector<double> *delta = NULL;
+    if( !reconstruct_old_positions ) {
+        iold  = &( smpi->dynamics_iold[ithread] );
+        delta = &( smpi->dynamics_deltaold[ithread] );
+    }
     
     //Loop on bin particles
     int nparts( particles.size() );
@@ -137,10 +141,12 @@ void Interpolator2D2Order::fieldsWrapper( ElectroMagn *EMfields, Particles &part
         //Interpolation on current particle
         fields( EMfields, particles, ipart, nparts, &( *Epart )[ipart], &( *Bpart )[ipart] );
         //Buffering of iol and delta
-        ( *iold )[ipart+0*nparts]  = ip_;
-        ( *iold )[ipart+1*nparts]  = jp_;
-        ( *delta )[ipart+0*nparts] = deltax;
-        ( *delta )[ipart+1*nparts] = deltay;
+        if( !reconstruct_old_positions ) {
+            ( *iold )[ipart+0*nparts]  = ip_;
+            ( *iold )[ipart+1*nparts]  = jp_;
+            ( *delta )[ipart+0*nparts] = deltax;
+            ( *delta )[ipart+1*nparts] = deltay;
+        }
     }
     
 }
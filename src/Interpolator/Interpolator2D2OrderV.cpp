@@ -40,9 +40,11 @@ void Interpolator2D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
     
     double *Epart[3], *Bpart[3];
     
-    double *deltaO[2];
-    deltaO[0] = &( smpi->dynamics_deltaold[ithread][0] );
-    deltaO[1] = &( smpi->dynamics_deltaold[ithread][nparts] );
+    double *deltaO[2] = { NULL, NULL };
+    if( !reconstruct_old_positions ) {
+        deltaO[0] = &( smpi->dynamics_deltaold[ithread][0] );
+        deltaO[1] = &( smpi->dynamics_deltaold[ithread][nparts] );
+    }
     
     for( unsigned int k=0; k<3; k++ ) {
         Epart[k]= &( smpi->dynamics_Epart[ithread][k*nparts] );
@@ -106,7 +108,7 @@ void Interpolator2D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                     coeff[i][j][1][ipart]    = ( 0.75 - delta2 );
                     coeff[i][j][2][ipart]    =  0.5 * ( delta2+delta+0.25 );
                     
-                    if( j==0 ) {
+                    if( j==0 && !reconstruct_old_positions ) {
                         deltaO[i][ipart-ipart_ref+ivect+istart[0]] = delta;
                     }
                     
@@ -0,0 +1,43 @@
+#ifndef INTERPOLATOR2D4ORDERV_H
+#define INTERPOLATOR2D4ORDERV_H
+
+
+#include "Interpolator2D.h"
+#include "Field2D.h"
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class for vectorized 4th order interpolator for 2Dcartesian simulations
+//  --------------------------------------------------------------------------------------------------------------------
+class Interpolator2D4OrderV : public Interpolator2D
+{
+    
+public:
+    Interpolator2D4OrderV( Params &, Patch * );
+    ~Interpolator2D4OrderV() override final {};
+    
+    void fieldsAndCurrents( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, LocalFields *JLoc, double *RhoLoc ) override final ;
+    void fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void fieldsSelection( ElectroMagn *EMfields, Particles &particles, double *buffer, int offset, std::vector<unsigned int> *selection ) override final {};
+    void oneField( Field *field, Particles &particles, int *istart, int *iend, double *FieldLoc ) override final;
+    
+    void fieldsAndEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void timeCenteredEnvelope( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final;
+    void envelopeAndSusceptibility( ElectroMagn *EMfields, Particles &particles, int ipart, double *Env_A_abs_Loc, double *Env_Chi_Loc, double *Env_E_abs_Loc ) override final;
+    
+private:
+    static constexpr double dble_1_ov_384   = 1.0/384.0;
+    static constexpr double dble_1_ov_48    = 1.0/48.0;
+    static constexpr double dble_1_ov_16    = 1.0/16.0;
+    static constexpr double dble_1_ov_12    = 1.0/12.0;
+    static constexpr double dble_1_ov_24    = 1.0/24.0;
+    static constexpr double dble_19_ov_96   = 19.0/96.0;
+    static constexpr double dble_11_ov_24   = 11.0/24.0;
+    static constexpr double dble_1_ov_4     = 1.0/4.0;
+    static constexpr double dble_1_ov_6     = 1.0/6.0;
+    static constexpr double dble_115_ov_192 = 115.0/192.0;
+    static constexpr double dble_5_ov_8     = 5.0/8.0;
+    
+};//END class
+
+#endif
@@ -23,6 +23,10 @@ Interpolator3D2OrderV::Interpolator3D2OrderV( Params &params, Patch *patch ) : I
     D_inv[1] = 1.0/params.cell_length[1];
     D_inv[2] = 1.0/params.cell_length[2];
     
+    fields_instance = SimdDispatch::select( params.simd_instruction_set,
+                                            &Interpolator3D2OrderV::fieldsGeneric,
+                                            &Interpolator3D2OrderV::fieldsAVX2,
+                                            &Interpolator3D2OrderV::fieldsAVX512 );
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -33,6 +37,26 @@ void Interpolator3D2OrderV::fields( ElectroMagn *EMfields, Particles &particles,
 }
 
 void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    ( this->*fields_instance )( EMfields, particles, smpi, istart, iend, ithread, ipart_ref );
+}
+
+void Interpolator3D2OrderV::fieldsGeneric( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    fieldsKernel( EMfields, particles, smpi, istart, iend, ithread, ipart_ref );
+}
+
+void Interpolator3D2OrderV::fieldsAVX2( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    fieldsKernel( EMfields, particles, smpi, istart, iend, ithread, ipart_ref );
+}
+
+void Interpolator3D2OrderV::fieldsAVX512( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    fieldsKernel( EMfields, particles, smpi, istart, iend, ithread, ipart_ref );
+}
+
+void Interpolator3D2OrderV::fieldsKernel( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
 {
     if( istart[0] == iend[0] ) {
         return;    //Don't treat empty cells.
@@ -82,10 +106,12 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
             np_computed = cell_nparts;
         }
         
-        double *deltaO[3]; //Delta is the distance of the particle from its primal node in cell size. Delta is in [-0.5, +0.5[
-        deltaO[0] = &( smpi->dynamics_deltaold[ithread][0        + ivect + istart[0] - ipart_ref] );
-        deltaO[1] = &( smpi->dynamics_deltaold[ithread][nparts   + ivect + istart[0] - ipart_ref] );
-        deltaO[2] = &( smpi->dynamics_deltaold[ithread][2*nparts + ivect + istart[0] - ipart_ref] );
+        double *deltaO[3] = { NULL, NULL, NULL }; //Delta is the distance of the particle from its primal node in cell size. Delta is in [-0.5, +0.5[
+        if( !reconstruct_old_positions ) {
+            deltaO[0] = &( smpi->dynamics_deltaold[ithread][0        + ivect + istart[0] - ipart_ref] );
+            deltaO[1] = &( smpi->dynamics_deltaold[ithread][nparts   + ivect + istart[0] - ipart_ref] );
+            deltaO[2] = &( smpi->dynamics_deltaold[ithread][2*nparts + ivect + istart[0] - ipart_ref] );
+        }
         
         for( unsigned int k=0; k<3; k++ ) {
             Epart[k]= &( smpi->dynamics_Epart[ithread][k*nparts-ipart_ref+ivect+istart[0]] );
@@ -106,7 +132,9 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &par
                 coeff[i][0][2][ipart]    =  0.5 * ( delta2+delta+0.25 );
                 //store delta primal in global array
                 //deltaO[i][ipart-ipart_ref+ivect+istart[0]] = delta;
-                deltaO[i][ipart] = delta;
+                if( !reconstruct_old_positions ) {
+                    deltaO[i][ipart] = delta;
+                }
                 dual [i][ipart] = ( delta >= 0. );
                 
                 //delta dual = distance to dual node
@@ -86,7 +86,17 @@ public:
     
 private:
 
-
+    //! Body of fieldsWrapper, compiled in each instance below
+    SMILEI_KERNEL_INLINE void fieldsKernel( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref );
+    
+    //! Instances of fieldsWrapper for each instruction set (see SimdDispatch.h)
+    void fieldsGeneric( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref );
+    SMILEI_TARGET_AVX2 void fieldsAVX2( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref );
+    SMILEI_TARGET_AVX512 void fieldsAVX512( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref );
+    
+    //! Instance selected at startup
+    void ( Interpolator3D2OrderV::*fields_instance )( ElectroMagn *, Particles &, SmileiMPI *, int *, int *, int, int );
+    
 };//END class
 
 #endif
@@ -0,0 +1,207 @@
+#include "InterpolatorAM2OrderV.h"
+
+#include <cmath>
+#include <iostream>
+#include <math.h>
+#include "ElectroMagn.h"
+#include "ElectroMagnAM.h"
+#include "cField2D.h"
+#include "Particles.h"
+#include <complex>
+#include "dcomplex.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Creator for InterpolatorAM2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+InterpolatorAM2OrderV::InterpolatorAM2OrderV( Params &params, Patch *patch ) : InterpolatorAM( params, patch )
+{
+    
+    dl_inv_ = 1.0/params.cell_length[0];
+    dr_inv_ = 1.0/params.cell_length[1];
+    nmodes = params.nmodes;
+    dr =  params.cell_length[1];
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 2nd Order vectorized interpolation of the fields of all modes for the particles of a cell
+// The particles are treated by blocks of 32, mode by mode, with real and imaginary parts handled separately
+// ---------------------------------------------------------------------------------------------------------------------
+void InterpolatorAM2OrderV::fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref )
+{
+    if( istart[0] == iend[0] ) {
+        return;    //Don't treat empty cells.
+    }
+    
+    int nparts( ( smpi->dynamics_invgf[ithread] ).size() );
+    
+    double *Epart[3], *Bpart[3];
+    
+    double *deltaO[2];
+    deltaO[0] = &( smpi->dynamics_deltaold[ithread][0] );
+    deltaO[1] = &( smpi->dynamics_deltaold[ithread][nparts] );
+    double *theta_old = &( smpi->dynamics_thetaold[ithread][0] );
+    
+    for( unsigned int k=0; k<3; k++ ) {
+        Epart[k]= &( smpi->dynamics_Epart[ithread][k*nparts] );
+        Bpart[k]= &( smpi->dynamics_Bpart[ithread][k*nparts] );
+    }
+    
+    int idx[2], idxO[2];
+    //Primal indices are constant over the all cell
+    idx[0]  = round( particles.position( 0, *istart ) * dl_inv_ );
+    idxO[0] = idx[0] - i_domain_begin -1 ;
+    double r0 = sqrt( particles.position( 1, *istart )*particles.position( 1, *istart )+particles.position( 2, *istart )*particles.position( 2, *istart ) );
+    idx[1]  = round( r0 * dr_inv_ );
+    idxO[1] = idx[1] - j_domain_begin -1 ;
+    
+    ElectroMagnAM *emAM = static_cast<ElectroMagnAM *>( EMfields );
+    
+    double coeff[2][2][3][32];
+    int dual[2][32]; // Size ndim. Boolean indicating if the part has a dual indice equal to the primal one (dual=0) or if it is +1 (dual=1).
+    // exp(-i theta) and exp(-i m theta) of the particles
+    double exp_m_theta_re[32], exp_m_theta_im[32];
+    double exp_mm_theta_re[32], exp_mm_theta_im[32];
+    
+    int vecSize = 32;
+    
+    int cell_nparts( ( int )iend[0]-( int )istart[0] );
+    
+    for( int ivect=0 ; ivect < cell_nparts; ivect += vecSize ) {
+        
+        int np_computed = min( cell_nparts-ivect, vecSize );
+        
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            
+            double yp = particles.position( 1, ipart+ivect+istart[0] );
+            double zp = particles.position( 2, ipart+ivect+istart[0] );
+            double r = sqrt( yp*yp + zp*zp );
+            
+            double pos[2];
+            pos[0] = particles.position( 0, ipart+ivect+istart[0] ) * dl_inv_;
+            pos[1] = r * dr_inv_;
+            
+            for( int i=0; i<2; i++ ) { // for L/R
+                double delta0 = pos[i];
+                dual [i][ipart] = ( delta0 - ( double )idx[i] >=0. );
+                
+                for( int j=0; j<2; j++ ) { // for dual
+                    
+                    double delta   = delta0 - ( double )idx[i] + ( double )j*( 0.5-dual[i][ipart] );
+                    double delta2  = delta*delta;
+                    
+                    coeff[i][j][0][ipart]    =  0.5 * ( delta2-delta+0.25 );
+                    coeff[i][j][1][ipart]    = ( 0.75 - delta2 );
+                    coeff[i][j][2][ipart]    =  0.5 * ( delta2+delta+0.25 );
+                    
+                    if( j==0 ) {
+                        deltaO[i][ipart-ipart_ref+ivect+istart[0]] = delta;
+                    }
+                }
+            }
+            
+            if( r > 0 ) {
+                exp_m_theta_re[ipart] =  yp / r;
+                exp_m_theta_im[ipart] = -zp / r;
+            } else {
+                exp_m_theta_re[ipart] = 1.;
+                exp_m_theta_im[ipart] = 0.;
+            }
+            exp_mm_theta_re[ipart] = 1.;
+            exp_mm_theta_im[ipart] = 0.;
+            theta_old[ipart-ipart_ref+ivect+istart[0]] = atan2( zp, yp );
+            
+            for( int k=0; k<3; k++ ) {
+                Epart[k][ipart-ipart_ref+ivect+istart[0]] = 0.;
+                Bpart[k][ipart-ipart_ref+ivect+istart[0]] = 0.;
+            }
+        }
+        
+        for( unsigned int imode = 0; imode < nmodes ; imode++ ) {
+            cField2D *El = emAM->El_[imode];
+            cField2D *Er = emAM->Er_[imode];
+            cField2D *Et = emAM->Et_[imode];
+            cField2D *Bl = emAM->Bl_m[imode];
+            cField2D *Br = emAM->Br_m[imode];
+            cField2D *Bt = emAM->Bt_m[imode];
+            
+            #pragma omp simd
+            for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+                
+                double *coeffrp = &( coeff[1][0][1][ipart] );
+                double *coeffrd = &( coeff[1][1][1][ipart] );
+                double *coeffld = &( coeff[0][1][1][ipart] );
+                double *coefflp = &( coeff[0][0][1][ipart] );
+                
+                int ip = idxO[0]+1;
+                int id = idxO[0]+1+dual[0][ipart];
+                int jp = idxO[1]+1;
+                int jd = idxO[1]+1+dual[1][ipart];
+                
+                // exp(-i m theta), only the real part of the fields is kept for mode 0
+                if( imode > 0 ) {
+                    double re = exp_mm_theta_re[ipart]*exp_m_theta_re[ipart] - exp_mm_theta_im[ipart]*exp_m_theta_im[ipart];
+                    double im = exp_mm_theta_re[ipart]*exp_m_theta_im[ipart] + exp_mm_theta_im[ipart]*exp_m_theta_re[ipart];
+                    exp_mm_theta_re[ipart] = re;
+                    exp_mm_theta_im[ipart] = im;
+                }
+                double e_re = exp_mm_theta_re[ipart];
+                double e_im = exp_mm_theta_im[ipart];
+                
+                double interp_re, interp_im;
+                // El^(d,p)
+                computeRI( coeffld, coeffrp, El, id, jp, interp_re, interp_im );
+                Epart[0][ipart-ipart_ref+ivect+istart[0]] += interp_re*e_re - interp_im*e_im;
+                // Er^(p,d)
+                computeRI( coefflp, coeffrd, Er, ip, jd, interp_re, interp_im );
+                Epart[1][ipart-ipart_ref+ivect+istart[0]] += interp_re*e_re - interp_im*e_im;
+                // Et^(p,p)
+                computeRI( coefflp, coeffrp, Et, ip, jp, interp_re, interp_im );
+                Epart[2][ipart-ipart_ref+ivect+istart[0]] += interp_re*e_re - interp_im*e_im;
+                // Bl^(p,d)
+                computeRI( coefflp, coeffrd, Bl, ip, jd, interp_re, interp_im );
+                Bpart[0][ipart-ipart_ref+ivect+istart[0]] += interp_re*e_re - interp_im*e_im;
+                // Br^(d,p)
+                computeRI( coeffld, coeffrp, Br, id, jp, interp_re, interp_im );
+                Bpart[1][ipart-ipart_ref+ivect+istart[0]] += interp_re*e_re - interp_im*e_im;
+                // Bt^(d,d)
+                computeRI( coeffld, coeffrd, Bt, id, jd, interp_re, interp_im );
+                Bpart[2][ipart-ipart_ref+ivect+istart[0]] += interp_re*e_re - interp_im*e_im;
+            }
+        }
+        
+        //Translate field into the cartesian y,z coordinates
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            int iloc = ipart-ipart_ref+ivect+istart[0];
+            double delta2 = exp_m_theta_re[ipart] * Epart[1][iloc] + exp_m_theta_im[ipart] * Epart[2][iloc];
+            Epart[2][iloc] = -exp_m_theta_im[ipart] * Epart[1][iloc] + exp_m_theta_re[ipart] * Epart[2][iloc];
+            Epart[1][iloc] = delta2 ;
+            delta2 = exp_m_theta_re[ipart] * Bpart[1][iloc] + exp_m_theta_im[ipart] * Bpart[2][iloc];
+            Bpart[2][iloc] = -exp_m_theta_im[ipart] * Bpart[1][iloc] + exp_m_theta_re[ipart] * Bpart[2][iloc];
+            Bpart[1][iloc] = delta2 ;
+        }
+    }
+    
+} // END InterpolatorAM2OrderV
+
+void InterpolatorAM2OrderV::fieldsAndCurrents( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, LocalFields *JLoc, double *RhoLoc )
+{
+    // Probes always use the scalar interpolator
+    ERROR( "Fields and currents AM interpolator not available in vectorized mode" );
+}
+
+// Interpolator on another field than the basic ones
+void InterpolatorAM2OrderV::oneField( Field *field, Particles &particles, int *istart, int *iend, double *FieldLoc )
+{
+    ERROR( "Single field AM interpolator not available in vectorized mode" );
+}
+
+// Interpolator specific to tracked particles. A selection of particles may be provided
+void InterpolatorAM2OrderV::fieldsSelection( ElectroMagn *EMfields, Particles &particles, double *buffer, int offset, vector<unsigned int> *selection )
+{
+    ERROR( "To Do" );
+}
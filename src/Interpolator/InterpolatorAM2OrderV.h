@@ -0,0 +1,46 @@
+#ifndef INTERPOLATORAM2ORDERV_H
+#define INTERPOLATORAM2ORDERV_H
+
+
+#include "InterpolatorAM.h"
+#include "cField2D.h"
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class for 2nd order vectorized interpolator for AM simulations
+//  --------------------------------------------------------------------------------------------------------------------
+class InterpolatorAM2OrderV : public InterpolatorAM
+{
+    
+public:
+    InterpolatorAM2OrderV( Params &, Patch * );
+    ~InterpolatorAM2OrderV() override final {};
+    
+    void fieldsAndCurrents( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, LocalFields *JLoc, double *RhoLoc ) override final ;
+    void fieldsWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref = 0 ) override final ;
+    void fieldsSelection( ElectroMagn *EMfields, Particles &particles, double *buffer, int offset, std::vector<unsigned int> *selection ) override final;
+    void oneField( Field *field, Particles &particles, int *istart, int *iend, double *FieldLoc ) override final;
+    
+    //! Interpolation of one mode of a field for one particle, real and imaginary parts accumulated separately
+    //! idx and idy include the dual shift of the particle, coeffx and coeffy are strided by 32 particles
+    inline void computeRI( double *coeffx, double *coeffy, cField2D *f, int idx, int idy, double &res_re, double &res_im )
+    {
+        res_re = 0.;
+        res_im = 0.;
+        for( int iloc=-1 ; iloc<2 ; iloc++ ) {
+            for( int jloc=-1 ; jloc<2 ; jloc++ ) {
+                std::complex<double> v = ( *f )( idx+iloc, idy+jloc );
+                double c = *( coeffx+iloc*32 ) * *( coeffy+jloc*32 );
+                res_re += c * std::real( v );
+                res_im += c * std::imag( v );
+            }
+        }
+    };
+    
+private:
+    //! Number of modes;
+    unsigned int nmodes;
+    
+};//END class
+
+#endif
@@ -12,9 +12,13 @@
 #include "InterpolatorAM2Order.h"
 
 #ifdef _VECTO
+#include "Interpolator1D2OrderV.h"
+#include "Interpolator1D4OrderV.h"
 #include "Interpolator2D2OrderV.h"
+#include "Interpolator2D4OrderV.h"
 #include "Interpolator3D2OrderV.h"
 #include "Interpolator3D4OrderV.h"
+#include "InterpolatorAM2OrderV.h"
 #endif
 
 #include "Params.h"
@@ -32,9 +36,23 @@ public:
         // 1Dcartesian simulation
         // ---------------
         if( ( params.geometry == "1Dcartesian" ) && ( params.interpolation_order == 2 ) ) {
-            Interp = new Interpolator1D2Order( params, patch );
+            if( !vectorization ) {
+                Interp = new Interpolator1D2Order( params, patch );
+            }
+#ifdef _VECTO
+            else {
+                Interp = new Interpolator1D2OrderV( params, patch );
+            }
+#endif
         } else if( ( params.geometry == "1Dcartesian" ) && ( params.interpolation_order == 4 ) ) {
-            Interp = new Interpolator1D4Order( params, patch );
+            if( !vectorization ) {
+                Interp = new Interpolator1D4Order( params, patch );
+            }
+#ifdef _VECTO
+            else {
+                Interp = new Interpolator1D4OrderV( params, patch );
+            }
+#endif
         }
         // ---------------
         // 2Dcartesian simulation
@@ -49,7 +67,14 @@ public:
             }
 #endif
         } else if( ( params.geometry == "2Dcartesian" ) && ( params.interpolation_order == 4 ) ) {
-            Interp = new Interpolator2D4Order( params, patch );
+            if( !vectorization ) {
+                Interp = new Interpolator2D4Order( params, patch );
+            }
+#ifdef _VECTO
+            else {
+                Interp = new Interpolator2D4OrderV( params, patch );
+            }
+#endif
         }
         // ---------------
         // 3Dcartesian simulation
@@ -77,7 +102,14 @@ public:
         // AM simulation
         // ---------------
         else if( params.geometry == "AMcylindrical" ) {
-            Interp = new InterpolatorAM2Order( params, patch );
+            if( !vectorization ) {
+                Interp = new InterpolatorAM2Order( params, patch );
+            }
+#ifdef _VECTO
+            else {
+                Interp = new InterpolatorAM2OrderV( params, patch );
+            }
+#endif
         }
         
         else {
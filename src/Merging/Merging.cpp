@@ -0,0 +1,28 @@
+// ----------------------------------------------------------------------------
+//! \file Merging.cpp
+//
+//! \brief This file contains the generic class Merging
+//   for the reduction of the number of macro-particles.
+//
+// ----------------------------------------------------------------------------
+
+#include "Merging.h"
+
+// -----------------------------------------------------------------------------
+//! Constructor for Merging
+//! \param params simulation parameters
+//! \param species species on which the merging applies
+// -----------------------------------------------------------------------------
+Merging::Merging( Params &params, Species *species )
+{
+    min_particles_per_cell_ = species->merge_min_particles_per_cell;
+    min_packet_size_        = species->merge_min_packet_size;
+    max_packet_size_        = species->merge_max_packet_size;
+}
+
+// -----------------------------------------------------------------------------
+//! Destructor for Merging
+// -----------------------------------------------------------------------------
+Merging::~Merging()
+{
+}
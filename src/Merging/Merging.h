@@ -0,0 +1,62 @@
+// ----------------------------------------------------------------------------
+//! \file Merging.h
+//
+//! \brief This file contains the header for the generic class Merging
+//   for the reduction of the number of macro-particles.
+//
+// ----------------------------------------------------------------------------
+
+#ifndef MERGING_H
+#define MERGING_H
+
+#include <vector>
+
+#include "Params.h"
+#include "Particles.h"
+#include "Species.h"
+
+//  ----------------------------------------------------------------------------
+//! Class Merging
+//  ----------------------------------------------------------------------------
+class Merging
+{
+
+public:
+    //! Creator for Merging
+    Merging( Params &params, Species *species );
+    virtual ~Merging();
+    
+    //! Overloading of () operator: merge the particles of the cell `icell`
+    //! \param mass       particle mass (0 for photons)
+    //! \param particles  particle object containing the particle properties
+    //! \param icell      index (cell key) of the cell
+    //! \param istart     index of the first particle of the cell
+    //! \param iend       index of the last particle of the cell (excluded)
+    //! \param count      number of particles in the cell, decreased by the number of removed particles
+    //! \param nmerged    incremented by the number of removed particles
+    //! Removed particles get a zero weight and a cell key equal to -1 so that the next sort drops them.
+    virtual void operator()(
+        double mass,
+        Particles &particles,
+        int icell,
+        int istart,
+        int iend,
+        int &count,
+        double &nmerged ) = 0;
+        
+protected:
+
+    //! Minimum number of particles in a cell to consider it for merging
+    unsigned int min_particles_per_cell_;
+    
+    //! Minimum number of particles merged together
+    unsigned int min_packet_size_;
+    
+    //! Maximum number of particles merged together
+    unsigned int max_packet_size_;
+    
+private:
+
+};//END class
+
+#endif
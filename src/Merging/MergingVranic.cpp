@@ -0,0 +1,212 @@
+// ----------------------------------------------------------------------------
+//! \file MergingVranic.cpp
+//
+//! \brief Merging of the macro-particles with the method of M. Vranic et al.,
+//  CPC 191 65-73 (2015): weight, momentum and energy are conserved.
+//
+// ----------------------------------------------------------------------------
+
+#include "MergingVranic.h"
+
+#include <cmath>
+#include <algorithm>
+
+// -----------------------------------------------------------------------------
+//! Constructor for MergingVranic
+//! \param params simulation parameters
+//! \param species species on which the merging applies
+// -----------------------------------------------------------------------------
+MergingVranic::MergingVranic( Params &params, Species *species ) :
+    Merging( params, species )
+{
+    for( unsigned int idim = 0 ; idim < 3 ; idim++ ) {
+        dimensions_[idim] = species->merge_momentum_cell_size[idim];
+    }
+}
+
+// -----------------------------------------------------------------------------
+//! Destructor for MergingVranic
+// -----------------------------------------------------------------------------
+MergingVranic::~MergingVranic()
+{
+}
+
+// -----------------------------------------------------------------------------
+//! Merge the particles of the cell `icell`
+//! \param mass       particle mass (0 for photons)
+//! \param particles  particle object containing the particle properties
+//! \param icell      index (cell key) of the cell
+//! \param istart     index of the first particle of the cell
+//! \param iend       index of the last particle of the cell (excluded)
+//! \param count      number of particles in the cell
+//! \param nmerged    number of removed particles
+// -----------------------------------------------------------------------------
+void MergingVranic::operator()(
+    double mass,
+    Particles &particles,
+    int icell,
+    int istart,
+    int iend,
+    int &count,
+    double &nmerged )
+{
+    // Particles which are still in the cell after the push
+    indexes_.clear();
+    for( int ip = istart ; ip < iend ; ip++ ) {
+        if( particles.cell_keys[ip] == icell ) {
+            indexes_.push_back( ip );
+        }
+    }
+    
+    unsigned int npart = indexes_.size();
+    if( npart < min_particles_per_cell_ ) {
+        return;
+    }
+    
+    // Momentum-space extent of the cell
+    double pmin[3], pmax[3], inv_dp[3];
+    for( unsigned int idim = 0 ; idim < 3 ; idim++ ) {
+        pmin[idim] = particles.momentum( idim, indexes_[0] );
+        pmax[idim] = pmin[idim];
+        for( unsigned int i = 1 ; i < npart ; i++ ) {
+            double p = particles.momentum( idim, indexes_[i] );
+            pmin[idim] = std::min( pmin[idim], p );
+            pmax[idim] = std::max( pmax[idim], p );
+        }
+        inv_dp[idim] = ( pmax[idim] > pmin[idim] ) ? dimensions_[idim] / ( pmax[idim] - pmin[idim] ) : 0.;
+    }
+    
+    // Momentum cell of each particle, the upper bound belongs to the last cell
+    unsigned int nmomentum_cells = dimensions_[0] * dimensions_[1] * dimensions_[2];
+    momentum_cell_.resize( npart );
+    momentum_cell_index_.assign( nmomentum_cells+1, 0 );
+    for( unsigned int i = 0 ; i < npart ; i++ ) {
+        int key = 0;
+        for( unsigned int idim = 0 ; idim < 3 ; idim++ ) {
+            unsigned int im = ( unsigned int )( ( particles.momentum( idim, indexes_[i] ) - pmin[idim] ) * inv_dp[idim] );
+            key = key * dimensions_[idim] + std::min( im, dimensions_[idim]-1 );
+        }
+        momentum_cell_[i] = key;
+        momentum_cell_index_[key+1]++;
+    }
+    
+    // Count sort of the particles by momentum cell
+    for( unsigned int k = 1 ; k <= nmomentum_cells ; k++ ) {
+        momentum_cell_index_[k] += momentum_cell_index_[k-1];
+    }
+    sorted_indexes_.resize( npart );
+    for( unsigned int i = 0 ; i < npart ; i++ ) {
+        sorted_indexes_[momentum_cell_index_[momentum_cell_[i]]++] = indexes_[i];
+    }
+    // momentum_cell_index_[k] is now the end of the momentum cell k
+    
+    // Merge the momentum cells by packets
+    unsigned int nremoved = 0;
+    unsigned int start = 0;
+    for( unsigned int k = 0 ; k < nmomentum_cells ; k++ ) {
+        unsigned int end = momentum_cell_index_[k];
+        while( end - start >= min_packet_size_ ) {
+            unsigned int npacket = std::min( max_packet_size_, end - start );
+            nremoved += mergePacket( mass, particles, &sorted_indexes_[start], npacket );
+            start += npacket;
+        }
+        start = end;
+    }
+    
+    count   -= nremoved;
+    nmerged += nremoved;
+}
+
+// -----------------------------------------------------------------------------
+//! Merge a packet of particles into the first two of them.
+//! Both get half of the total weight and the energy per unit weight of the
+//! packet; their momenta are symmetric with respect to the total momentum.
+//! \param mass      particle mass (0 for photons)
+//! \param particles particle object containing the particle properties
+//! \param packet    indexes of the particles of the packet
+//! \param npacket   number of particles in the packet
+// -----------------------------------------------------------------------------
+unsigned int MergingVranic::mergePacket( double mass, Particles &particles, int *packet, unsigned int npacket )
+{
+    // Charge would not be conserved if particles of different charge were merged
+    for( unsigned int i = 1 ; i < npacket ; i++ ) {
+        if( particles.charge( packet[i] ) != particles.charge( packet[0] ) ) {
+            return 0;
+        }
+    }
+    
+    // Total weight, momentum and energy of the packet
+    double w_tot = 0.;
+    double e_tot = 0.;
+    double p_tot[3] = {0., 0., 0.};
+    for( unsigned int i = 0 ; i < npacket ; i++ ) {
+        double w  = particles.weight( packet[i] );
+        double p2 = 0.;
+        for( unsigned int idim = 0 ; idim < 3 ; idim++ ) {
+            double p = particles.momentum( idim, packet[i] );
+            p_tot[idim] += w * p;
+            p2 += p * p;
+        }
+        w_tot += w;
+        e_tot += w * ( mass > 0. ? sqrt( 1. + p2 ) : sqrt( p2 ) );
+    }
+    if( w_tot <= 0. ) {
+        return 0;
+    }
+    
+    // Momentum norm of the two new particles
+    double e_new = e_tot / w_tot;
+    double p_new = ( mass > 0. ) ? sqrt( std::max( 0., e_new*e_new - 1. ) ) : e_new;
+    
+    // Unit vector along the total momentum
+    double p_tot_norm = sqrt( p_tot[0]*p_tot[0] + p_tot[1]*p_tot[1] + p_tot[2]*p_tot[2] );
+    double u1[3] = {1., 0., 0.};
+    if( p_tot_norm > 0. ) {
+        for( unsigned int idim = 0 ; idim < 3 ; idim++ ) {
+            u1[idim] = p_tot[idim] / p_tot_norm;
+        }
+    }
+    
+    // Unit vector orthogonal to u1, in the plane of the momentum of the first particle if possible
+    double u2[3], proj = 0.;
+    for( unsigned int idim = 0 ; idim < 3 ; idim++ ) {
+        u2[idim] = particles.momentum( idim, packet[0] );
+        proj += u2[idim] * u1[idim];
+    }
+    for( unsigned int idim = 0 ; idim < 3 ; idim++ ) {
+        u2[idim] -= proj * u1[idim];
+    }
+    double u2_norm = sqrt( u2[0]*u2[0] + u2[1]*u2[1] + u2[2]*u2[2] );
+    if( u2_norm < 1.e-10 * std::max( p_new, 1.e-10 ) ) {
+        // Cross product of u1 with the axis the least aligned with it
+        unsigned int iaxis = ( fabs( u1[0] ) < 0.5 ) ? 0 : 1;
+        double axis[3] = {0., 0., 0.};
+        axis[iaxis] = 1.;
+        u2[0] = u1[1]*axis[2] - u1[2]*axis[1];
+        u2[1] = u1[2]*axis[0] - u1[0]*axis[2];
+        u2[2] = u1[0]*axis[1] - u1[1]*axis[0];
+        u2_norm = sqrt( u2[0]*u2[0] + u2[1]*u2[1] + u2[2]*u2[2] );
+    }
+    for( unsigned int idim = 0 ; idim < 3 ; idim++ ) {
+        u2[idim] /= u2_norm;
+    }
+    
+    // Opening angle giving the total momentum
+    double cos_theta = ( p_new > 0. ) ? std::min( 1., p_tot_norm / ( w_tot * p_new ) ) : 1.;
+    double sin_theta = sqrt( 1. - cos_theta*cos_theta );
+    
+    for( unsigned int idim = 0 ; idim < 3 ; idim++ ) {
+        particles.momentum( idim, packet[0] ) = p_new * ( cos_theta * u1[idim] + sin_theta * u2[idim] );
+        particles.momentum( idim, packet[1] ) = p_new * ( cos_theta * u1[idim] - sin_theta * u2[idim] );
+    }
+    particles.weight( packet[0] ) = 0.5 * w_tot;
+    particles.weight( packet[1] ) = 0.5 * w_tot;
+    
+    // The other particles are removed at the next sort
+    for( unsigned int i = 2 ; i < npacket ; i++ ) {
+        particles.weight( packet[i] ) = 0.;
+        particles.cell_keys[packet[i]] = -1;
+    }
+    
+    return npacket - 2;
+}
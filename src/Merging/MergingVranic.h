@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------
+//! \file MergingVranic.h
+//
+//! \brief Header for the class MergingVranic:
+//  particles of a cell are grouped in momentum-space cells and each packet
+//  of a momentum cell is replaced by two particles with the same total
+//  weight, momentum and energy (M. Vranic et al., CPC 191 65-73, 2015).
+//
+// ----------------------------------------------------------------------------
+
+#ifndef MERGINGVRANIC_H
+#define MERGINGVRANIC_H
+
+#include <vector>
+
+#include "Merging.h"
+
+//  ----------------------------------------------------------------------------
+//! Class MergingVranic
+//  ----------------------------------------------------------------------------
+class MergingVranic : public Merging
+{
+
+public:
+
+    //! Creator for MergingVranic
+    MergingVranic( Params &params, Species *species );
+    
+    //! Destructor for MergingVranic
+    ~MergingVranic();
+    
+    //! Merge the particles of the cell `icell`
+    void operator()(
+        double mass,
+        Particles &particles,
+        int icell,
+        int istart,
+        int iend,
+        int &count,
+        double &nmerged ) override;
+        
+private:
+
+    //! Merge a packet of particles with the same momentum cell into the first two of them
+    //! \return the number of removed particles
+    unsigned int mergePacket( double mass, Particles &particles, int *packet, unsigned int npacket );
+    
+    //! Number of momentum-space cells in each direction
+    unsigned int dimensions_[3];
+    
+    //! Particles of the current cell
+    std::vector<int> indexes_;
+    
+    //! Particles of the current cell sorted by momentum cell
+    std::vector<int> sorted_indexes_;
+    
+    //! Momentum cell of each particle of the current cell
+    std::vector<int> momentum_cell_;
+    
+    //! Boundaries of the momentum cells in sorted_indexes_
+    std::vector<int> momentum_cell_index_;
+    
+};
+
+#endif
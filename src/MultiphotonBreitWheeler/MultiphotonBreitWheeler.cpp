@@ -74,13 +74,13 @@ void MultiphotonBreitWheeler::compute_thread_chiph( Particles &particles,
     double gamma;
     
     // Momentum shortcut
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, 0 ) );
     }
     
     // Optical depth for the Monte-Carlo process
-    double *chi = &( particles.chi( 0 ) );
+    pdouble *chi = &( particles.chi( 0 ) );
     
     // _______________________________________________________________
     // Computation
@@ -151,7 +151,7 @@ void MultiphotonBreitWheeler::operator()( Particles &particles,
     double event_time;
     
     // Momentum shortcut
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, 0 ) );
     }
@@ -168,10 +168,10 @@ void MultiphotonBreitWheeler::operator()( Particles &particles,
     // double* weight = &( particles.weight(0) );
     
     // Optical depth for the Monte-Carlo process
-    double *tau = &( particles.tau( 0 ) );
+    pdouble *tau = &( particles.tau( 0 ) );
     
     // Quantum parameter
-    double *photon_chi = &( particles.chi( 0 ) );
+    pdouble *photon_chi = &( particles.chi( 0 ) );
     
     // Photon id
     // uint64_t * id = &( particles.id(0));
@@ -386,8 +386,12 @@ void MultiphotonBreitWheeler::decayed_photon_cleaning(
     std::vector<double> *Epart = &( smpi->dynamics_Epart[ithread] );
     std::vector<double> *Bpart = &( smpi->dynamics_Bpart[ithread] );
     std::vector<double> *gamma = &( smpi->dynamics_invgf[ithread] );
-    std::vector<int> *iold = &( smpi->dynamics_iold[ithread] );
-    std::vector<double> *deltaold = &( smpi->dynamics_deltaold[ithread] );
+    std::vector<int> *iold = NULL;
+    std::vector<double> *deltaold = NULL;
+    if ( smpi->dynamics_iold.size() ) {
+        iold = &( smpi->dynamics_iold[ithread] );
+        deltaold = &( smpi->dynamics_deltaold[ithread] );
+    }
 
     std::vector<double> *thetaold = NULL;
     if ( smpi->dynamics_thetaold.size() )
@@ -398,7 +402,7 @@ void MultiphotonBreitWheeler::decayed_photon_cleaning(
 
     if( bmax[ibin] > bmin[ibin] ) {
         // Weight shortcut
-        double *weight = &( particles.weight( 0 ) );
+        pdouble *weight = &( particles.weight( 0 ) );
         
         // Index of the last existing photon (weight > 0)
         int last_photon_index;
@@ -432,9 +436,11 @@ void MultiphotonBreitWheeler::decayed_photon_cleaning(
                         (*Epart)[iDim*nparts+ipart] = (*Epart)[iDim*nparts+last_photon_index];
                         (*Bpart)[iDim*nparts+ipart] = (*Bpart)[iDim*nparts+last_photon_index];
                     }
-                    for ( int iDim=n_dimensions_-1 ; iDim>=0 ; iDim-- ) {
-                        (*iold)[iDim*nparts+ipart] = (*iold)[iDim*nparts+last_photon_index];
-                        (*deltaold)[iDim*nparts+ipart] = (*deltaold)[iDim*nparts+last_photon_index];
+                    if (iold) {
+                        for ( int iDim=n_dimensions_-1 ; iDim>=0 ; iDim-- ) {
+                            (*iold)[iDim*nparts+ipart] = (*iold)[iDim*nparts+last_photon_index];
+                            (*deltaold)[iDim*nparts+ipart] = (*deltaold)[iDim*nparts+last_photon_index];
+                        }
                     }
                     (*gamma)[0*nparts+ipart] = (*gamma)[0*nparts+last_photon_index];
 
@@ -459,9 +465,11 @@ void MultiphotonBreitWheeler::decayed_photon_cleaning(
                 Epart->erase(Epart->begin()+iDim*nparts+last_photon_index+1,Epart->begin()+iDim*nparts+last_photon_index+1+nb_deleted_photon);
                 Bpart->erase(Bpart->begin()+iDim*nparts+last_photon_index+1,Bpart->begin()+iDim*nparts+last_photon_index+1+nb_deleted_photon);
             }
-            for ( int iDim=n_dimensions_-1 ; iDim>=0 ; iDim-- ) {
-                iold->erase(iold->begin()+iDim*nparts+last_photon_index+1,iold->begin()+iDim*nparts+last_photon_index+1+nb_deleted_photon);
-                deltaold->erase(deltaold->begin()+iDim*nparts+last_photon_index+1,deltaold->begin()+iDim*nparts+last_photon_index+1+nb_deleted_photon);
+            if (iold) {
+                for ( int iDim=n_dimensions_-1 ; iDim>=0 ; iDim-- ) {
+                    iold->erase(iold->begin()+iDim*nparts+last_photon_index+1,iold->begin()+iDim*nparts+last_photon_index+1+nb_deleted_photon);
+                    deltaold->erase(deltaold->begin()+iDim*nparts+last_photon_index+1,deltaold->begin()+iDim*nparts+last_photon_index+1+nb_deleted_photon);
+                }
             }
             gamma->erase(gamma->begin()+0*nparts+last_photon_index+1,gamma->begin()+0*nparts+last_photon_index+1+nb_deleted_photon);
 
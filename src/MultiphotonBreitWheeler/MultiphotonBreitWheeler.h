@@ -58,7 +58,7 @@ public:
     //! \param By y component of the particle magnetic field
     //! \param Bz z component of the particle magnetic field
     //#pragma omp declare simd
-    double inline compute_chiph( double &kx, double &ky, double &kz,
+    double inline compute_chiph( double kx, double ky, double kz,
                                  double &gamma,
                                  double &Ex, double &Ey, double &Ez,
                                  double &Bx, double &By, double &Bz )
@@ -100,6 +100,8 @@ public:
                         MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables );
                         
     //! Clean photons that decayed into pairs (weight <= 0)
+    //! Only for species sorted by bins: species sorted per cell leave
+    //! the decayed photons in place and the cell sort drops them
     //! \param particles   particle object containing the particle
     //!                    properties of the current species
     //! \param istart      Index of the first particle
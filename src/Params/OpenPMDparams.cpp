@@ -110,10 +110,16 @@ OpenPMDparams::OpenPMDparams( Params &p ):
     // Other parameters
     currentSmoothing = "none";
     currentSmoothingParameters = "";
-    if( params->currentFilter_passes > 0 ) {
+    if( params->hasCurrentFilter() ) {
         currentSmoothing = "Binomial";
         ostringstream t( "" );
-        t << "numPasses="<<params->currentFilter_passes;
+        t << "numPasses=";
+        for( unsigned int i=0 ; i<params->currentFilter_passes.size() ; i++ ) {
+            t << ( i>0 ? "," : "" ) << params->currentFilter_passes[i];
+        }
+        if( params->currentFilter_compensation ) {
+            t << ";compensator=true";
+        }
         currentSmoothingParameters = t.str();
     }
 }
@@ -432,9 +432,48 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     if( maxwell_sol == "Lehe" ) {
         full_B_exchange=true;
     }
+    maxwell_tile_size = 0;
+    PyTools::extract( "maxwell_tile_size", maxwell_tile_size, "Main" );
+    if( maxwell_tile_size > 0 ) {
+        if( geometry!="3Dcartesian" || maxwell_sol!="Yee" ) {
+            ERROR( "Main.maxwell_tile_size only available with the Yee solver in 3Dcartesian geometry" );
+        }
+        if( is_pxr ) {
+            ERROR( "Main.maxwell_tile_size is not compatible with the PICSAR solvers" );
+        }
+    }
+    field_padding = false;
+    PyTools::extract( "field_padding", field_padding, "Main" );
+    if( field_padding ) {
+        if( geometry!="2Dcartesian" && geometry!="3Dcartesian" ) {
+            ERROR( "Main.field_padding only available in 2Dcartesian and 3Dcartesian geometries" );
+        }
+        if( is_pxr ) {
+            ERROR( "Main.field_padding is not compatible with the PICSAR solvers" );
+        }
+    }
+    aggregate_field_exchanges = false;
+    PyTools::extract( "aggregate_field_exchanges", aggregate_field_exchanges, "Main" );
+    if( aggregate_field_exchanges && geometry=="AMcylindrical" ) {
+        ERROR( "Main.aggregate_field_exchanges not available in AMcylindrical geometry" );
+    }
+    if( is_spectral && !is_pxr ) {
+        if( geometry!="2Dcartesian" && geometry!="3Dcartesian" ) {
+            ERROR( "The spectral solver is only available in 2Dcartesian and 3Dcartesian geometries" );
+        }
+        for( unsigned int iDim = 0 ; iDim < nDim_field ; iDim++ ) {
+            if( EM_BCs[iDim][0] != "periodic" ) {
+                ERROR( "The spectral solver requires periodic EM_boundary_conditions" );
+            }
+        }
+        if( maxwell_tile_size > 0 ) {
+            ERROR( "Main.maxwell_tile_size is not compatible with the spectral solver" );
+        }
+    }
     
     // Current filter properties
-    currentFilter_passes = 0;
+    currentFilter_passes.assign( nDim_field, 0 );
+    currentFilter_compensation = false;
     int nCurrentFilter = PyTools::nComponents( "CurrentFilter" );
     for( int ifilt = 0; ifilt < nCurrentFilter; ifilt++ ) {
         string model;
@@ -442,7 +481,21 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
         if( model != "binomial" ) {
             ERROR( "Currently, only the `binomial` model is available in CurrentFilter()" );
         }
-        PyTools::extract( "passes", currentFilter_passes, "CurrentFilter", ifilt );
+        // passes : same number along all dimensions, or one number per dimension
+        PyObject *py_passes = PyTools::extract_py( "passes", "CurrentFilter", ifilt );
+        if( PyList_Check( py_passes ) ) {
+            if( !PyTools::convert( py_passes, currentFilter_passes ) || currentFilter_passes.size() != nDim_field ) {
+                ERROR( "CurrentFilter.passes should be an integer or a list of "<< nDim_field << " integers" );
+            }
+        } else {
+            unsigned int passes;
+            if( !PyTools::convert( py_passes, passes ) ) {
+                ERROR( "CurrentFilter.passes should be an integer or a list of "<< nDim_field << " integers" );
+            }
+            currentFilter_passes.assign( nDim_field, passes );
+        }
+        Py_DECREF( py_passes );
+        PyTools::extract( "compensation", currentFilter_compensation, "CurrentFilter", ifilt );
     }
     
     // Field filter properties
@@ -479,7 +532,7 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
         res_space2 += ( ( nmodes-1 )*( nmodes-1 )-1 )*res_space[1]*res_space[1];
     }
     dtCFL=1.0/sqrt( res_space2 );
-    if( timestep>dtCFL ) {
+    if( timestep>dtCFL && !is_spectral ) {
         WARNING( "CFL problem: timestep=" << timestep << " should be smaller than " << dtCFL );
     }
     
@@ -562,6 +615,9 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     if( has_load_balancing && patch_arrangement != "hilbertian" ) {
         ERROR( "Dynamic load balancing is only available for Hilbert decomposition" );
     }
+    if( has_load_balancing && is_spectral && !is_pxr ) {
+        ERROR( "Dynamic load balancing is not compatible with the spectral solver" );
+    }
     if( has_load_balancing && total_number_of_hilbert_patches < 2*smpi->getSize() ) {
         ERROR( "Dynamic load balancing requires to use at least 2 patches per MPI process." );
     }
@@ -584,6 +640,10 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     vectorization_mode = "off";
     has_adaptive_vectorization = false;
     adaptive_vecto_time_selection = nullptr;
+    incremental_sort_threshold = 0.3;
+    fused_kernel = false;
+    simd_instruction_set = SimdDispatch::detect();
+    std::string instruction_set = "auto";
     
     if( PyTools::nComponents( "Vectorization" )>0 ) {
         // Extraction of the vectorization mode
@@ -609,6 +669,57 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
             adaptive_vecto_time_selection = new TimeSelection(
                 PyTools::extract_py( "reconfigure_every", "Vectorization" ), "Adaptive vectorization"
             );
+            
+        // Fraction of moved particles above which the cell sort starts from scratch
+        PyTools::extract( "incremental_sort_threshold", incremental_sort_threshold, "Vectorization" );
+        if( incremental_sort_threshold < 0. || incremental_sort_threshold > 1. ) {
+            ERROR( "In block `Vectorization`, parameter `incremental_sort_threshold` must be between 0 and 1" );
+        }
+        
+        // Instruction set of the vectorized kernels
+        PyTools::extract( "instruction_set", instruction_set, "Vectorization" );
+        if( instruction_set != "auto" ) {
+            SimdDispatch::InstructionSet requested;
+            if( ! SimdDispatch::fromName( instruction_set, requested ) ) {
+                ERROR( "In block `Vectorization`, parameter `instruction_set` must be `auto`, `generic`, `avx2` or `avx512`" );
+            }
+            if( requested > simd_instruction_set ) {
+                ERROR( "In block `Vectorization`, instruction_set `" << instruction_set << "` is not supported on this processor (or by this build)" );
+            }
+            simd_instruction_set = requested;
+        }
+        
+        // Interpolation, push, boundary conditions and projection fused per cell
+        PyTools::extract( "fused_kernel", fused_kernel, "Vectorization" );
+        if( fused_kernel ) {
+            if( vectorization_mode == "off" ) {
+                ERROR( "In block `Vectorization`, `fused_kernel` requires the vectorized operators" );
+            }
+            if( geometry!="2Dcartesian" && geometry!="3Dcartesian" ) {
+                ERROR( "In block `Vectorization`, `fused_kernel` only available in 2Dcartesian and 3Dcartesian geometries" );
+            }
+            if( interpolation_order != 2 ) {
+                ERROR( "In block `Vectorization`, `fused_kernel` only available with interpolation_order = 2" );
+            }
+        }
+    }
+    
+    // Former particle positions recomputed by the projectors
+    reconstruct_old_positions = false;
+    PyTools::extract( "reconstruct_old_positions", reconstruct_old_positions, "Main" );
+    if( reconstruct_old_positions ) {
+        if( geometry!="2Dcartesian" && geometry!="3Dcartesian" ) {
+            ERROR( "Main.reconstruct_old_positions only available in 2Dcartesian and 3Dcartesian geometries" );
+        }
+        if( interpolation_order != 2 ) {
+            ERROR( "Main.reconstruct_old_positions only available with interpolation_order = 2" );
+        }
+        if( Laser_Envelope_model ) {
+            ERROR( "Main.reconstruct_old_positions is not compatible with the laser envelope model" );
+        }
+        if( PyTools::nComponents( "PartWall" ) > 0 ) {
+            ERROR( "Main.reconstruct_old_positions is not compatible with PartWall" );
+        }
     }
     
     // In case of collisions, ensure particle sort per cell
@@ -879,6 +990,12 @@ void Params::compute()
         if( n_space_global[i]%number_of_patches[i] !=0 ) {
             ERROR( "ERROR in dimension " << i <<". Number of patches = " << number_of_patches[i] << " must divide n_space_global = " << n_space_global[i] );
         }
+        // Each pass of the current filter invalidates one ghost cell : the ghost cells are widened, if the patches
+        // are large enough, so that all the passes are applied before a single exchange
+        unsigned int filter_width = currentFilter_passes[i] + ( currentFilter_compensation && currentFilter_passes[i]>0 ? 1 : 0 );
+        if( filter_width > oversize[i] && n_space[i] > 2*filter_width+1 ) {
+            oversize[i] = filter_width;
+        }
         if( n_space[i] <= 2*oversize[i]+1 ) {
             ERROR( "ERROR in dimension " << i <<". Patches length = "<<n_space[i] << " cells must be at least " << 2*oversize[i] +2 << " cells long. Increase number of cells or reduce number of patches in this direction. " );
         }
@@ -886,6 +1003,35 @@ void Params::compute()
         n_cell_per_patch *= n_space[i];
     }
     
+    // Rounds of the current filter : at most oversize passes (including the compensation) along each dimension
+    currentFilter_round_passes.resize( 0 );
+    currentFilter_round_compensated.resize( 0 );
+    vector<unsigned int> remaining_passes = currentFilter_passes;
+    vector<bool> remaining_compensation( nDim_field, false );
+    for( unsigned int i=0; i<nDim_field; i++ ) {
+        remaining_compensation[i] = currentFilter_compensation && currentFilter_passes[i]>0;
+    }
+    bool remaining = hasCurrentFilter();
+    while( remaining ) {
+        vector<unsigned int> passes( nDim_field ), compensated( nDim_field, 0 );
+        for( unsigned int i=0; i<nDim_field; i++ ) {
+            passes[i] = min( remaining_passes[i], oversize[i] );
+            remaining_passes[i] -= passes[i];
+            if( remaining_passes[i] == 0 && remaining_compensation[i] && passes[i] < oversize[i] ) {
+                compensated[i] = currentFilter_passes[i];
+                remaining_compensation[i] = false;
+            }
+        }
+        currentFilter_round_passes.push_back( passes );
+        currentFilter_round_compensated.push_back( compensated );
+        remaining = false;
+        for( unsigned int i=0; i<nDim_field; i++ ) {
+            if( remaining_passes[i] > 0 || remaining_compensation[i] ) {
+                remaining = true;
+            }
+        }
+    }
+    
     // Set clrw if not set by the user
     if( clrw == -1 ) {
     
@@ -937,15 +1083,6 @@ void Params::check_consistency()
 {
     if( vectorization_mode != "off" ) {
     
-        if( ( geometry=="1Dcartesian" ) || ( geometry=="AMcylindrical" ) ) {
-            ERROR( "Vectorized algorithms not implemented for this geometry" );
-        }
-        
-        if( ( geometry=="2Dcartesian" ) && ( interpolation_order==4 ) ) {
-            ERROR( "4th order vectorized algorithms not implemented in 2D" );
-        }
-        
-        
         if( hasMultiphotonBreitWheeler ) {
             WARNING( "Performances of advanced physical processes which generates new particles could be degraded for the moment !" );
             WARNING( "\t The improvment of their integration in vectorized algorithm is in progress." );
@@ -987,7 +1124,17 @@ void Params::print_init()
 {
     TITLE( "Geometry: " << geometry );
     MESSAGE( 1, "Interpolation order : " <<  interpolation_order );
-    MESSAGE( 1, "Maxwell solver : " <<  maxwell_sol );
+    if( is_spectral && !is_pxr ) {
+        MESSAGE( 1, "Maxwell solver : spectral (PSATD) on the Domain grid" );
+    } else {
+        MESSAGE( 1, "Maxwell solver : " <<  maxwell_sol );
+    }
+    if( maxwell_tile_size > 0 ) {
+        MESSAGE( 1, "Maxwell solver fused by tiles of " << maxwell_tile_size << " cells along y" );
+    }
+    if( field_padding ) {
+        MESSAGE( 1, "Rows of the electromagnetic fields padded to " << SMILEI_ALIGNMENT << " bytes" );
+    }
     MESSAGE( 1, "(Time resolution, Total simulation time) : (" << res_time << ", " << simulation_time << ")" );
     MESSAGE( 1, "(Total number of iterations,   timestep) : (" << n_time << ", " << timestep << ")" );
     MESSAGE( 1, "           timestep  = " << timestep/dtCFL << " * CFL" );
@@ -1010,8 +1157,15 @@ void Params::print_init()
         }
     }
     
-    if( currentFilter_passes > 0 ) {
-        MESSAGE( 1, "Binomial current filtering : "<< currentFilter_passes << " passes" );
+    if( hasCurrentFilter() ) {
+        ostringstream passes( "" );
+        for( unsigned int i=0 ; i<nDim_field ; i++ ) {
+            passes << ( i>0 ? ", " : "" ) << currentFilter_passes[i];
+        }
+        MESSAGE( 1, "Binomial current filtering : "<< passes.str() << " passes" << ( currentFilter_compensation ? ", with compensation" : "" ) );
+        if( currentFilter_round_passes.size() > 1 ) {
+            MESSAGE( 2, "Applied in " << currentFilter_round_passes.size() << " rounds : the patches are too small to widen the ghost cells" );
+        }
     }
     if( Friedman_filter ) {
         MESSAGE( 1, "Friedman field filtering : theta = " << Friedman_theta );
@@ -1019,6 +1173,9 @@ void Params::print_init()
     if( full_B_exchange ) {
         MESSAGE( 1, "All components of B are exchanged at synchronization" );
     }
+    if( aggregate_field_exchanges ) {
+        MESSAGE( 1, "MPI messages of the field synchronizations aggregated per MPI process" );
+    }
     
     if( has_load_balancing ) {
         TITLE( "Load Balancing: " );
@@ -1034,6 +1191,11 @@ void Params::print_init()
     
     TITLE( "Vectorization: " );
     MESSAGE( 1, "Mode: " << vectorization_mode );
+    if( vectorization_mode != "off" ) {
+        MESSAGE( 1, "Incremental sort threshold: " << incremental_sort_threshold );
+        MESSAGE( 1, "Fused kernel: " << ( fused_kernel ? "on" : "off" ) );
+        MESSAGE( 1, "Instruction set of the vectorized kernels: " << SimdDispatch::name( simd_instruction_set ) );
+    }
     if( vectorization_mode == "adaptive_mixed_sort" || vectorization_mode == "adaptive" ) {
         MESSAGE( 1, "Default mode: " << adaptive_default_mode );
         MESSAGE( 1, "Time selection: " << adaptive_vecto_time_selection->info() );
@@ -13,6 +13,7 @@
 
 #include "Timer.h"
 #include "codeConstants.h"
+#include "SimdDispatch.h"
 
 #include <vector>
 #include <string>
@@ -84,6 +85,17 @@ public:
         return ( current_timestep % print_every == 0 );
     }
     
+    //! Tells whether the current filter is applied (at least one pass along one dimension)
+    bool hasCurrentFilter()
+    {
+        for( unsigned int i=0 ; i<currentFilter_passes.size() ; i++ ) {
+            if( currentFilter_passes[i] > 0 ) {
+                return true;
+            }
+        }
+        return false;
+    }
+    
     //! sets nDim_particle and nDim_field based on the geometry
     void setDimensions();
     
@@ -160,8 +172,26 @@ public:
     //! Maxwell Solver (default='Yee')
     std::string maxwell_sol;
     
-    //! Current spatial filter: number of binomial passes
-    unsigned int currentFilter_passes;
+    //! Number of cells along y in the tiles of the fused 3D Yee solver (0 = separate sweeps)
+    unsigned int maxwell_tile_size;
+    
+    //! Pad the rows of the electromagnetic fields to aligned lengths (2D and 3D cartesian)
+    bool field_padding;
+    
+    //! Aggregate the MPI messages of the field synchronizations in one message per neighboring MPI process
+    bool aggregate_field_exchanges;
+    
+    //! Current spatial filter: number of binomial passes along each dimension
+    std::vector<unsigned int> currentFilter_passes;
+    
+    //! Current spatial filter: compensation pass after the binomial passes
+    bool currentFilter_compensation;
+    
+    //! Current spatial filter: the passes are applied by rounds, each followed by an exchange (a single round
+    //! if the ghost cells are wide enough). Binomial passes along each dimension in each round, and number of
+    //! binomial passes compensated at the end of the round (0 if none)
+    std::vector<std::vector<unsigned int> > currentFilter_round_passes;
+    std::vector<std::vector<unsigned int> > currentFilter_round_compensated;
     
     //! is Friedman filter applied [Greenwood et al., J. Comp. Phys. 201, 665 (2004)]
     bool Friedman_filter;
@@ -223,6 +253,11 @@ public:
     //! frequency to apply shrink_to_fit on particles structure
     int every_clean_particles_overhead;
     
+    //! If true, the projectors recompute the former particle position from
+    //! the new position and momentum instead of reading it from the buffers
+    //! filled by the interpolators (dynamics_iold, dynamics_deltaold)
+    bool reconstruct_old_positions;
+    
     //! Total number of patches
     unsigned int tot_number_of_patches;
     //! Number of patches per direction
@@ -252,6 +287,14 @@ public:
     std::string vectorization_mode;
     //! Initial state of the patches in adaptive mode
     std::string adaptive_default_mode;
+    //! Fraction of particles changing cell above which the cell sort
+    //! is a complete count sort instead of relocating the moved particles only
+    double incremental_sort_threshold;
+    //! Process each cell from interpolation to projection in a single pass
+    //! (2nd order, 2D and 3D cartesian vectorized operators)
+    bool fused_kernel;
+    //! Instruction set of the vectorized kernels, detected at startup unless set in the namelist
+    SimdDispatch::InstructionSet simd_instruction_set;
     
     //! Tells whether there is a moving window
     bool hasWindow;
@@ -80,6 +80,18 @@ void Domain::build( Params &params, SmileiMPI *smpi, VectorPatch &vecPatches, Op
     
     if( params.is_pxr ) {
         vecPatch_( 0 )->EMfields->MaxwellAmpereSolver_->coupling( params, vecPatch_( 0 )->EMfields );
+    } else if( params.is_spectral ) {
+        vecPatch_( 0 )->EMfields->MaxwellAmpereSolver_->setDomain( params, patch_ );
+        // The native spectral solver starts from the fields of the patches (initial or restarted fields)
+        for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+            ElectroMagn *EMfields = vecPatches( ipatch )->EMfields;
+            EMfields->Ex_->put( patch_->EMfields->Ex_, params, smpi, vecPatches( ipatch ), patch_ );
+            EMfields->Ey_->put( patch_->EMfields->Ey_, params, smpi, vecPatches( ipatch ), patch_ );
+            EMfields->Ez_->put( patch_->EMfields->Ez_, params, smpi, vecPatches( ipatch ), patch_ );
+            EMfields->Bx_->put( patch_->EMfields->Bx_, params, smpi, vecPatches( ipatch ), patch_ );
+            EMfields->By_->put( patch_->EMfields->By_, params, smpi, vecPatches( ipatch ), patch_ );
+            EMfields->Bz_->put( patch_->EMfields->Bz_, params, smpi, vecPatches( ipatch ), patch_ );
+        }
     }
 }
 
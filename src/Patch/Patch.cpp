@@ -734,6 +734,8 @@ void Patch::cornersParticles( SmileiMPI *smpi, int ispec, Params &params, int iD
         
             // Treat diagonalParticles
             if( iDim < ndim-1 ) { // No need to treat diag particles at last dimension.
+                // Particles leaving the receive buffer are flagged, then removed all at once
+                std::vector<bool> dead( n_part_recv, false );
                 if( params.geometry != "AMcylindrical" ) {
                     for( int iPart=n_part_recv-1 ; iPart>=0; iPart-- ) {
                         check = 0;
@@ -752,7 +754,7 @@ void Patch::cornersParticles( SmileiMPI *smpi, int ispec, Params &params, int iD
                                     vecSpecies[ispec]->addPartInExchList( cuParticles.size()-1 );
                                 }
                                 //Remove it from receive buffer.
-                                ( vecSpecies[ispec]->MPIbuff.partRecv[iDim][( iNeighbor+1 )%2] ).erase_particle( iPart );
+                                dead[iPart] = true;
                                 vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][( iNeighbor+1 )%2]--;
                                 check = 1;
                             }
@@ -765,7 +767,7 @@ void Patch::cornersParticles( SmileiMPI *smpi, int ispec, Params &params, int iD
                                     vecSpecies[ispec]->MPIbuff.part_index_send[idim][1].push_back( cuParticles.size()-1 );
                                     vecSpecies[ispec]->addPartInExchList( cuParticles.size()-1 );
                                 }
-                                ( vecSpecies[ispec]->MPIbuff.partRecv[iDim][( iNeighbor+1 )%2] ).erase_particle( iPart );
+                                dead[iPart] = true;
                                 vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][( iNeighbor+1 )%2]--;
                                 check = 1;
                             }
@@ -791,7 +793,7 @@ void Patch::cornersParticles( SmileiMPI *smpi, int ispec, Params &params, int iD
                                 vecSpecies[ispec]->addPartInExchList( cuParticles.size()-1 );
                             }
                             //Remove it from receive buffer.
-                            ( vecSpecies[ispec]->MPIbuff.partRecv[0][( iNeighbor+1 )%2] ).erase_particle( iPart );
+                            dead[iPart] = true;
                             vecSpecies[ispec]->MPIbuff.part_index_recv_sz[0][( iNeighbor+1 )%2]--;
                         }
                         //Other side of idim
@@ -804,11 +806,12 @@ void Patch::cornersParticles( SmileiMPI *smpi, int ispec, Params &params, int iD
                                 vecSpecies[ispec]->MPIbuff.part_index_send[1][1].push_back( cuParticles.size()-1 );
                                 vecSpecies[ispec]->addPartInExchList( cuParticles.size()-1 );
                             }
-                            ( vecSpecies[ispec]->MPIbuff.partRecv[0][( iNeighbor+1 )%2] ).erase_particle( iPart );
+                            dead[iPart] = true;
                             vecSpecies[ispec]->MPIbuff.part_index_recv_sz[0][( iNeighbor+1 )%2]--;
                         }
                     }
                 }
+                ( vecSpecies[ispec]->MPIbuff.partRecv[iDim][( iNeighbor+1 )%2] ).erase_particles( dead );
             }//If not last dim for diagonal particles.
         } //If received something
     } //loop i Neighbor
@@ -849,6 +852,12 @@ void Patch::cleanParticlesOverhead( Params &params )
         }
         
         cuParticles.shrink_to_fit( ndim );
+        
+        // Spare buffer of the complete count sort
+        Particles &spareParticles = vecSpecies[ispec]->particles_sorted[ vecSpecies[ispec]->particles == &vecSpecies[ispec]->particles_sorted[0] ];
+        spareParticles.clear();
+        spareParticles.shrink_to_fit( ndim );
+        ParticleProperty<int>().swap( spareParticles.cell_keys );
     }
     
 }
@@ -29,6 +29,7 @@ class Patch
     friend class SimWindow;
     friend class SyncVectorPatch;
     friend class AsyncMPIbuffers;
+    friend class AggregatedMPIbuffers;
 public:
     //! Constructor for Patch
     Patch( Params &params, SmileiMPI *smpi, DomainDecomposition *domain_decomposition, unsigned int ipatch, unsigned int n_moved );
@@ -150,7 +150,7 @@ void Patch1D::initSumField( Field *field, int iDim, SmileiMPI *smpi )
         if( is_a_MPI_neighbor( iDim, ( iNeighbor+1 )%2 ) ) {
             int tmp_elem = f1D->MPIbuff.buf[iDim][( iNeighbor+1 )%2].size();
             int tag = f1D->MPIbuff.recv_tags_[iDim][iNeighbor];
-            MPI_Irecv( &( f1D->MPIbuff.buf[iDim][( iNeighbor+1 )%2][0] ), tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag, MPI_COMM_WORLD, &( f1D->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+            MPI_Irecv( &( f1D->MPIbuff.buf[iDim][( iNeighbor+1 )%2][0] ), tmp_elem, MPI_FDOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag, MPI_COMM_WORLD, &( f1D->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
         } // END of Recv
         
     } // END for iNeighbor
@@ -403,17 +403,17 @@ void Patch1D::createType2( Params &params )
     
         // Standard Type
         ntype_[0][ix_isPrim] = MPI_DATATYPE_NULL;
-        MPI_Type_contiguous( ny, MPI_DOUBLE, &( ntype_[0][ix_isPrim] ) ); //line
+        MPI_Type_contiguous( ny, MPI_FDOUBLE, &( ntype_[0][ix_isPrim] ) ); //line
         MPI_Type_commit( &( ntype_[0][ix_isPrim] ) );
         
         ntype_[1][ix_isPrim] = MPI_DATATYPE_NULL;
-        MPI_Type_contiguous( clrw, MPI_DOUBLE, &( ntype_[1][ix_isPrim] ) ); //clrw lines
+        MPI_Type_contiguous( clrw, MPI_FDOUBLE, &( ntype_[1][ix_isPrim] ) ); //clrw lines
         MPI_Type_commit( &( ntype_[1][ix_isPrim] ) );
         
         ntypeSum_[0][ix_isPrim] = MPI_DATATYPE_NULL;
         
         MPI_Datatype tmpType = MPI_DATATYPE_NULL;
-        MPI_Type_contiguous( 1, MPI_DOUBLE, &( tmpType ) ); //line
+        MPI_Type_contiguous( 1, MPI_FDOUBLE, &( tmpType ) ); //line
         MPI_Type_commit( &( tmpType ) );
         
         
@@ -442,17 +442,17 @@ void Patch1D::createType( Params &params )
     
         // Standard Type
         ntype_[0][ix_isPrim] = MPI_DATATYPE_NULL;
-        MPI_Type_contiguous( ny, MPI_DOUBLE, &( ntype_[0][ix_isPrim] ) ); //line
+        MPI_Type_contiguous( ny, MPI_FDOUBLE, &( ntype_[0][ix_isPrim] ) ); //line
         MPI_Type_commit( &( ntype_[0][ix_isPrim] ) );
         
         ntype_[1][ix_isPrim] = MPI_DATATYPE_NULL;
-        MPI_Type_contiguous( clrw, MPI_DOUBLE, &( ntype_[1][ix_isPrim] ) ); //clrw lines
+        MPI_Type_contiguous( clrw, MPI_FDOUBLE, &( ntype_[1][ix_isPrim] ) ); //clrw lines
         MPI_Type_commit( &( ntype_[1][ix_isPrim] ) );
         
         ntypeSum_[0][ix_isPrim] = MPI_DATATYPE_NULL;
         
         MPI_Datatype tmpType = MPI_DATATYPE_NULL;
-        MPI_Type_contiguous( 1, MPI_DOUBLE, &( tmpType ) ); //line
+        MPI_Type_contiguous( 1, MPI_FDOUBLE, &( tmpType ) ); //line
         MPI_Type_commit( &( tmpType ) );
         
         
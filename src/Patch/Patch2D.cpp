@@ -31,6 +31,8 @@ Patch2D::Patch2D( Params &params, SmileiMPI *smpi, DomainDecomposition *domain_d
                 ntype_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
                 ntype_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
                 ntype_[2][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
+                ntypePadded_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
+                ntypePadded_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
                 ntypeSum_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
                 ntypeSum_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
                 
@@ -104,6 +106,8 @@ void Patch2D::initStep2( Params &params, DomainDecomposition *domain_decompositi
             ntype_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
             ntype_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
             ntype_[2][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
+            ntypePadded_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
+            ntypePadded_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
             ntypeSum_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
             ntypeSum_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
         }
@@ -193,7 +197,7 @@ void Patch2D::initSumField( Field *field, int iDim, SmileiMPI *smpi )
             int tmp_elem = f2D->MPIbuff.buf[iDim][( iNeighbor+1 )%2].size();
             int tag = f2D->MPIbuff.recv_tags_[iDim][iNeighbor];
             //cout << hindex << " recv from " << neighbor_[iDim][(iNeighbor+1)%2] << " ; n_elements = " << tmp_elem << endl;
-            MPI_Irecv( &( f2D->MPIbuff.buf[iDim][( iNeighbor+1 )%2][0] ), tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag, MPI_COMM_WORLD, &( f2D->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+            MPI_Irecv( &( f2D->MPIbuff.buf[iDim][( iNeighbor+1 )%2][0] ), tmp_elem, MPI_FDOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag, MPI_COMM_WORLD, &( f2D->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
             
         } // END of Recv
         
@@ -347,7 +351,7 @@ void Patch2D::initExchange( Field *field, int iDim, SmileiMPI *smpi )
     
     int istart, ix, iy;
     
-    MPI_Datatype ntype = ntype_[iDim][isDual[0]][isDual[1]];
+    MPI_Datatype ntype = field->padded_ ? ntypePadded_[iDim][isDual[0]][isDual[1]] : ntype_[iDim][isDual[0]][isDual[1]];
     for( int iNeighbor=0 ; iNeighbor<patch_nbNeighbors_ ; iNeighbor++ ) {
     
         if( is_a_MPI_neighbor( iDim, iNeighbor ) ) {
@@ -515,23 +519,35 @@ void Patch2D::createType( Params &params )
             
             // Standard Type
             ntype_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
-            MPI_Type_contiguous( params.oversize[0]*ny, MPI_DOUBLE, &( ntype_[0][ix_isPrim][iy_isPrim] ) ); //line
+            MPI_Type_contiguous( params.oversize[0]*ny, MPI_FDOUBLE, &( ntype_[0][ix_isPrim][iy_isPrim] ) ); //line
             MPI_Type_commit( &( ntype_[0][ix_isPrim][iy_isPrim] ) );
             ntype_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
-            MPI_Type_vector( nx, params.oversize[1], ny, MPI_DOUBLE, &( ntype_[1][ix_isPrim][iy_isPrim] ) ); // column
+            MPI_Type_vector( nx, params.oversize[1], ny, MPI_FDOUBLE, &( ntype_[1][ix_isPrim][iy_isPrim] ) ); // column
             MPI_Type_commit( &( ntype_[1][ix_isPrim][iy_isPrim] ) );
             
             // Still used ???
             ntype_[2][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
-            MPI_Type_contiguous( ny*clrw, MPI_DOUBLE, &( ntype_[2][ix_isPrim][iy_isPrim] ) ); //clrw lines
+            MPI_Type_contiguous( ny*clrw, MPI_FDOUBLE, &( ntype_[2][ix_isPrim][iy_isPrim] ) ); //clrw lines
             MPI_Type_commit( &( ntype_[2][ix_isPrim][iy_isPrim] ) );
             
+            // Padded Type : the padding of the rows is skipped
+            if( params.field_padding ) {
+                int sizes[2] = { nx, ( int )Field::paddedSize( ny ) };
+                int starts[2] = { 0, 0 };
+                for( int iDim=0 ; iDim<2 ; iDim++ ) {
+                    int subsizes[2] = { nx, ny };
+                    subsizes[iDim] = params.oversize[iDim];
+                    MPI_Type_create_subarray( 2, sizes, subsizes, starts, MPI_ORDER_C, MPI_FDOUBLE, &( ntypePadded_[iDim][ix_isPrim][iy_isPrim] ) );
+                    MPI_Type_commit( &( ntypePadded_[iDim][ix_isPrim][iy_isPrim] ) );
+                }
+            }
+            
             ntypeSum_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
             nline = 1 + 2*params.oversize[0] + ix_isPrim;
             //MPI_Type_contiguous(nline, ntype_[0][ix_isPrim][iy_isPrim], &(ntypeSum_[0][ix_isPrim][iy_isPrim]));    //line
             
             MPI_Datatype tmpType = MPI_DATATYPE_NULL;
-            MPI_Type_contiguous( ny, MPI_DOUBLE, &( tmpType ) ); //line
+            MPI_Type_contiguous( ny, MPI_FDOUBLE, &( tmpType ) ); //line
             MPI_Type_commit( &( tmpType ) );
             
             MPI_Type_contiguous( nline, tmpType, &( ntypeSum_[0][ix_isPrim][iy_isPrim] ) ); //line
@@ -541,7 +557,7 @@ void Patch2D::createType( Params &params )
             
             ntypeSum_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
             ncol  = 1 + 2*params.oversize[1] + iy_isPrim;
-            MPI_Type_vector( nx, ncol, ny, MPI_DOUBLE, &( ntypeSum_[1][ix_isPrim][iy_isPrim] ) ); // column
+            MPI_Type_vector( nx, ncol, ny, MPI_FDOUBLE, &( ntypeSum_[1][ix_isPrim][iy_isPrim] ) ); // column
             MPI_Type_commit( &( ntypeSum_[1][ix_isPrim][iy_isPrim] ) );
             
             
@@ -559,12 +575,12 @@ void Patch2D::createType( Params &params )
             
             ntypeSum_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
             MPI_Type_contiguous( nx_sum*ny,
-                                 MPI_DOUBLE, &( ntypeSum_[0][ix_isPrim][iy_isPrim] ) );
+                                 MPI_FDOUBLE, &( ntypeSum_[0][ix_isPrim][iy_isPrim] ) );
             MPI_Type_commit( &( ntypeSum_[0][ix_isPrim][iy_isPrim] ) );
             
             ntypeSum_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
             MPI_Type_vector( nx, ny_sum, ny,
-                             MPI_DOUBLE, &( ntypeSum_[1][ix_isPrim][iy_isPrim] ) );
+                             MPI_FDOUBLE, &( ntypeSum_[1][ix_isPrim][iy_isPrim] ) );
             MPI_Type_commit( &( ntypeSum_[1][ix_isPrim][iy_isPrim] ) );
             
             // Complex sum
@@ -600,23 +616,35 @@ void Patch2D::createType2( Params &params )
             
             // Standard Type
             ntype_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
-            MPI_Type_contiguous( params.oversize[0]*ny, MPI_DOUBLE, &( ntype_[0][ix_isPrim][iy_isPrim] ) ); //line
+            MPI_Type_contiguous( params.oversize[0]*ny, MPI_FDOUBLE, &( ntype_[0][ix_isPrim][iy_isPrim] ) ); //line
             MPI_Type_commit( &( ntype_[0][ix_isPrim][iy_isPrim] ) );
             ntype_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
-            MPI_Type_vector( nx, params.oversize[1], ny, MPI_DOUBLE, &( ntype_[1][ix_isPrim][iy_isPrim] ) ); // column
+            MPI_Type_vector( nx, params.oversize[1], ny, MPI_FDOUBLE, &( ntype_[1][ix_isPrim][iy_isPrim] ) ); // column
             MPI_Type_commit( &( ntype_[1][ix_isPrim][iy_isPrim] ) );
             
             // Still used ???
             ntype_[2][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
-            MPI_Type_contiguous( ny*clrw, MPI_DOUBLE, &( ntype_[2][ix_isPrim][iy_isPrim] ) ); //clrw lines
+            MPI_Type_contiguous( ny*clrw, MPI_FDOUBLE, &( ntype_[2][ix_isPrim][iy_isPrim] ) ); //clrw lines
             MPI_Type_commit( &( ntype_[2][ix_isPrim][iy_isPrim] ) );
             
+            // Padded Type : the padding of the rows is skipped
+            if( params.field_padding ) {
+                int sizes[2] = { nx, ( int )Field::paddedSize( ny ) };
+                int starts[2] = { 0, 0 };
+                for( int iDim=0 ; iDim<2 ; iDim++ ) {
+                    int subsizes[2] = { nx, ny };
+                    subsizes[iDim] = params.oversize[iDim];
+                    MPI_Type_create_subarray( 2, sizes, subsizes, starts, MPI_ORDER_C, MPI_FDOUBLE, &( ntypePadded_[iDim][ix_isPrim][iy_isPrim] ) );
+                    MPI_Type_commit( &( ntypePadded_[iDim][ix_isPrim][iy_isPrim] ) );
+                }
+            }
+            
             ntypeSum_[0][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
             nline = 1 + 2*params.oversize[0] + ix_isPrim;
             //MPI_Type_contiguous(nline, ntype_[0][ix_isPrim][iy_isPrim], &(ntypeSum_[0][ix_isPrim][iy_isPrim]));    //line
             
             MPI_Datatype tmpType = MPI_DATATYPE_NULL;
-            MPI_Type_contiguous( ny, MPI_DOUBLE, &( tmpType ) ); //line
+            MPI_Type_contiguous( ny, MPI_FDOUBLE, &( tmpType ) ); //line
             MPI_Type_commit( &( tmpType ) );
             
             MPI_Type_contiguous( nline, tmpType, &( ntypeSum_[0][ix_isPrim][iy_isPrim] ) ); //line
@@ -626,7 +654,7 @@ void Patch2D::createType2( Params &params )
             
             ntypeSum_[1][ix_isPrim][iy_isPrim] = MPI_DATATYPE_NULL;
             ncol  = 1 + 2*params.oversize[1] + iy_isPrim;
-            MPI_Type_vector( nx, ncol, ny, MPI_DOUBLE, &( ntypeSum_[1][ix_isPrim][iy_isPrim] ) ); // column
+            MPI_Type_vector( nx, ncol, ny, MPI_FDOUBLE, &( ntypeSum_[1][ix_isPrim][iy_isPrim] ) ); // column
             MPI_Type_commit( &( ntypeSum_[1][ix_isPrim][iy_isPrim] ) );
             
         }
@@ -645,6 +673,11 @@ void Patch2D::cleanType()
             MPI_Type_free( &( ntype_[0][ix_isPrim][iy_isPrim] ) );
             MPI_Type_free( &( ntype_[1][ix_isPrim][iy_isPrim] ) );
             MPI_Type_free( &( ntype_[2][ix_isPrim][iy_isPrim] ) );
+            for( int iDim=0 ; iDim<2 ; iDim++ ) {
+                if( ntypePadded_[iDim][ix_isPrim][iy_isPrim] != MPI_DATATYPE_NULL ) {
+                    MPI_Type_free( &( ntypePadded_[iDim][ix_isPrim][iy_isPrim] ) );
+                }
+            }
             MPI_Type_free( &( ntypeSum_[0][ix_isPrim][iy_isPrim] ) );
             MPI_Type_free( &( ntypeSum_[1][ix_isPrim][iy_isPrim] ) );
             
@@ -67,6 +67,8 @@ public:
     //! MPI_Datatype to exchange [ndims_+1][iDim=0 prim/dial][iDim=1 prim/dial]
     //!   - +1 : an additional type to exchange clrw lines
     MPI_Datatype ntype_[3][2][2];
+    //! MPI_Datatype to exchange the fields with padded rows (Main.field_padding), without the padding
+    MPI_Datatype ntypePadded_[2][2][2];
     
     //! MPI_Datatype to sum [ndims_][iDim=0 prim/dial][iDim=1 prim/dial]
     MPI_Datatype ntypeSum_complex_[2][2][2];
@@ -32,6 +32,9 @@ Patch3D::Patch3D( Params &params, SmileiMPI *smpi, DomainDecomposition *domain_d
                     ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                     ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                     ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
+                    ntypePadded_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
+                    ntypePadded_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
+                    ntypePadded_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                     ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                     ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                     ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
@@ -131,6 +134,9 @@ void Patch3D::initStep2( Params &params, DomainDecomposition *domain_decompositi
                 ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
+                ntypePadded_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
+                ntypePadded_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
+                ntypePadded_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
@@ -227,7 +233,7 @@ void Patch3D::initSumField( Field *field, int iDim, SmileiMPI *smpi )
         if( is_a_MPI_neighbor( iDim, ( iNeighbor+1 )%2 ) ) {
             int tmp_elem = f3D->MPIbuff.buf[iDim][( iNeighbor+1 )%2].size();
             int tag = f3D->MPIbuff.recv_tags_[iDim][iNeighbor];
-            MPI_Irecv( &( f3D->MPIbuff.buf[iDim][( iNeighbor+1 )%2][0] ), tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag,
+            MPI_Irecv( &( f3D->MPIbuff.buf[iDim][( iNeighbor+1 )%2][0] ), tmp_elem, MPI_FDOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag,
                        MPI_COMM_WORLD, &( f3D->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
         } // END of Recv
         
@@ -450,7 +456,7 @@ void Patch3D::initExchange( Field *field, int iDim, SmileiMPI *smpi )
     
     int istart, ix, iy, iz;
     
-    MPI_Datatype ntype = ntype_[iDim][isDual[0]][isDual[1]][isDual[2]];
+    MPI_Datatype ntype = field->padded_ ? ntypePadded_[iDim][isDual[0]][isDual[1]][isDual[2]] : ntype_[iDim][isDual[0]][isDual[1]][isDual[2]];
     for( int iNeighbor=0 ; iNeighbor<patch_nbNeighbors_ ; iNeighbor++ ) {
     
         if( is_a_MPI_neighbor( iDim, iNeighbor ) ) {
@@ -617,19 +623,32 @@ void Patch3D::createType2( Params &params )
                 // Standard Type
                 ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_contiguous( params.oversize[0]*ny*nz,
-                                     MPI_DOUBLE, &( ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                                     MPI_FDOUBLE, &( ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_commit( &( ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 
                 ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector( nx, params.oversize[1]*nz, ny*nz,
-                                 MPI_DOUBLE, &( ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                                 MPI_FDOUBLE, &( ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_commit( &( ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 
                 ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector( nx*ny, params.oversize[2], nz,
-                                 MPI_DOUBLE, &( ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                                 MPI_FDOUBLE, &( ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_commit( &( ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 
+                // Padded Type : the padding of the rows is skipped
+                if( params.field_padding ) {
+                    int sizes[3] = { nx, ny, ( int )Field::paddedSize( nz ) };
+                    int starts[3] = { 0, 0, 0 };
+                    for( int iDim=0 ; iDim<3 ; iDim++ ) {
+                        int subsizes[3] = { nx, ny, nz };
+                        subsizes[iDim] = params.oversize[iDim];
+                        MPI_Type_create_subarray( 3, sizes, subsizes, starts, MPI_ORDER_C,
+                                                  MPI_FDOUBLE, &( ntypePadded_[iDim][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                        MPI_Type_commit( &( ntypePadded_[iDim][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                    }
+                }
+                
                 
                 nx_sum = 1 + 2*params.oversize[0] + ix_isPrim;
                 ny_sum = 1 + 2*params.oversize[1] + iy_isPrim;
@@ -637,17 +656,17 @@ void Patch3D::createType2( Params &params )
                 
                 ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_contiguous( nx_sum*ny*nz,
-                                     MPI_DOUBLE, &( ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                                     MPI_FDOUBLE, &( ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_commit( &( ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 
                 ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector( nx, ny_sum*nz, ny*nz,
-                                 MPI_DOUBLE, &( ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                                 MPI_FDOUBLE, &( ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_commit( &( ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 
                 ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector( nx*ny, nz_sum, nz,
-                                 MPI_DOUBLE, &( ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                                 MPI_FDOUBLE, &( ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_commit( &( ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 
             }
@@ -680,19 +699,32 @@ void Patch3D::createType( Params &params )
                 // Standard Type
                 ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_contiguous( params.oversize[0]*ny*nz,
-                                     MPI_DOUBLE, &( ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                                     MPI_FDOUBLE, &( ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_commit( &( ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 
                 ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector( nx, params.oversize[1]*nz, ny*nz,
-                                 MPI_DOUBLE, &( ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                                 MPI_FDOUBLE, &( ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_commit( &( ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 
                 ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector( nx*ny, params.oversize[2], nz,
-                                 MPI_DOUBLE, &( ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                                 MPI_FDOUBLE, &( ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_commit( &( ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 
+                // Padded Type : the padding of the rows is skipped
+                if( params.field_padding ) {
+                    int sizes[3] = { nx, ny, ( int )Field::paddedSize( nz ) };
+                    int starts[3] = { 0, 0, 0 };
+                    for( int iDim=0 ; iDim<3 ; iDim++ ) {
+                        int subsizes[3] = { nx, ny, nz };
+                        subsizes[iDim] = params.oversize[iDim];
+                        MPI_Type_create_subarray( 3, sizes, subsizes, starts, MPI_ORDER_C,
+                                                  MPI_FDOUBLE, &( ntypePadded_[iDim][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                        MPI_Type_commit( &( ntypePadded_[iDim][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                    }
+                }
+                
                 //// Complex Type V0
                 //ntype_complex_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 //MPI_Type_contiguous(params.oversize[0]*ny*nz,
@@ -732,17 +764,17 @@ void Patch3D::createType( Params &params )
                 // Standard sum
                 ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_contiguous( nx_sum*ny*nz,
-                                     MPI_DOUBLE, &( ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                                     MPI_FDOUBLE, &( ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_commit( &( ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 
                 ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector( nx, ny_sum*nz, ny*nz,
-                                 MPI_DOUBLE, &( ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                                 MPI_FDOUBLE, &( ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_commit( &( ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 
                 ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] = MPI_DATATYPE_NULL;
                 MPI_Type_vector( nx*ny, nz_sum, nz,
-                                 MPI_DOUBLE, &( ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                                 MPI_FDOUBLE, &( ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_commit( &( ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 
                 // Complex sum
@@ -768,6 +800,11 @@ void Patch3D::cleanType()
                 MPI_Type_free( &( ntype_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_free( &( ntype_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_free( &( ntype_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                for( int iDim=0 ; iDim<3 ; iDim++ ) {
+                    if( ntypePadded_[iDim][ix_isPrim][iy_isPrim][iz_isPrim] != MPI_DATATYPE_NULL ) {
+                        MPI_Type_free( &( ntypePadded_[iDim][ix_isPrim][iy_isPrim][iz_isPrim] ) );
+                    }
+                }
                 MPI_Type_free( &( ntypeSum_[0][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_free( &( ntypeSum_[1][ix_isPrim][iy_isPrim][iz_isPrim] ) );
                 MPI_Type_free( &( ntypeSum_[2][ix_isPrim][iy_isPrim][iz_isPrim] ) );
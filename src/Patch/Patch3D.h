@@ -66,6 +66,8 @@ public:
     MPI_Datatype ntypeSum_[3][2][2][2];
     //! MPI_Datatype to exchange [ndims_+1][iDim=0 prim/dial][iDim=1 prim/dial]
     MPI_Datatype ntype_[3][2][2][2];
+    //! MPI_Datatype to exchange the fields with padded rows (Main.field_padding), without the padding
+    MPI_Datatype ntypePadded_[3][2][2][2];
     
     //! MPI_Datatype to sum [ndims_][iDim=0 prim/dial][iDim=1 prim/dial]
     MPI_Datatype ntypeSum_complex_[3][2][2][2];
@@ -48,6 +48,13 @@ void SyncCartesianPatch::cartesianToPatches( Domain &domain, VectorPatch &vecPat
         vecPatches( ipatch )->EMfields->By_m->get( domain.patch_->EMfields->By_m, params, smpi, domain.patch_, vecPatches( ipatch ) );
         vecPatches( ipatch )->EMfields->Bz_m->get( domain.patch_->EMfields->Bz_m, params, smpi, domain.patch_, vecPatches( ipatch ) );
         
+        if( !params.is_pxr ) {
+            // B_m is a copy of B, which is only up to date on the Domain
+            vecPatches( ipatch )->EMfields->Bx_->get( domain.patch_->EMfields->Bx_, params, smpi, domain.patch_, vecPatches( ipatch ) );
+            vecPatches( ipatch )->EMfields->By_->get( domain.patch_->EMfields->By_, params, smpi, domain.patch_, vecPatches( ipatch ) );
+            vecPatches( ipatch )->EMfields->Bz_->get( domain.patch_->EMfields->Bz_, params, smpi, domain.patch_, vecPatches( ipatch ) );
+        }
+        
 //        vecPatches(ipatch)->EMfields->Bx_->get( domain.patch_->EMfields->Bx_, params, smpi, domain.patch_, vecPatches(ipatch) );
 //        vecPatches(ipatch)->EMfields->By_->get( domain.patch_->EMfields->By_, params, smpi, domain.patch_, vecPatches(ipatch) );
 //        vecPatches(ipatch)->EMfields->Bz_->get( domain.patch_->EMfields->Bz_, params, smpi, domain.patch_, vecPatches(ipatch) );
@@ -6,6 +6,7 @@
 #include "VectorPatch.h"
 #include "Params.h"
 #include "SmileiMPI.h"
+#include "AggregatedMPIbuffers.h"
 
 using namespace std;
 
@@ -213,7 +214,7 @@ void SyncVectorPatch::sumRhoJs( Params &params, VectorPatch &vecPatches, int imo
 void SyncVectorPatch::sum( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi, Timers &timers, int itime )
 {
     unsigned int nx_, ny_, nz_, h0, oversize[3], n_space[3], gsp[3];
-    double *pt1, *pt2;
+    fdouble *pt1, *pt2;
     h0 = vecPatches( 0 )->hindex;
     
     int nPatches( vecPatches.size() );
@@ -232,25 +233,29 @@ void SyncVectorPatch::sum( std::vector<Field *> fields, VectorPatch &vecPatches,
     // Sum per direction :
     
     // iDim = 0, initialize comms : Isend/Irecv
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::initAggregated( fields, vecPatches, 0, true );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
-        unsigned int ipatch = ifield%nPatches;
-        vecPatches( ipatch )->initSumField( fields[ifield], 0, smpi );
+        for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+            unsigned int ipatch = ifield%nPatches;
+            vecPatches( ipatch )->initSumField( fields[ifield], 0, smpi );
+        }
     }
     
     // iDim = 0, local
     for( unsigned int icomp=0 ; icomp<nComp ; icomp++ ) {
-        nx_ = fields[icomp*nPatches]->dims_[0];
+        nx_ = fields[icomp*nPatches]->paddedDims_[0];
         ny_ = 1;
         nz_ = 1;
         if( fields[icomp*nPatches]->dims_.size()>1 ) {
-            ny_ = fields[icomp*nPatches]->dims_[1];
+            ny_ = fields[icomp*nPatches]->paddedDims_[1];
             if( fields[icomp*nPatches]->dims_.size()>2 ) {
-                nz_ = fields[icomp*nPatches]->dims_[2];
+                nz_ = fields[icomp*nPatches]->paddedDims_[2];
             }
         }
         gsp[0] = 1+2*oversize[0]+fields[icomp*nPatches]->isDual_[0]; //Ghost size primal
@@ -266,20 +271,24 @@ void SyncVectorPatch::sum( std::vector<Field *> fields, VectorPatch &vecPatches,
                     pt1[i] += pt2[i];
                 }
                 //Copy back the results to 2
-                memcpy( pt2, pt1, gsp[0]*ny_*nz_*sizeof( double ) );
+                memcpy( pt2, pt1, gsp[0]*ny_*nz_*sizeof( fdouble ) );
             }
         }
     }
     
     // iDim = 0, finalize (waitall)
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::finalizeAggregated( fields, vecPatches, 0, true );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
-        unsigned int ipatch = ifield%nPatches;
-        vecPatches( ipatch )->finalizeSumField( fields[ifield], 0 );
+        for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+            unsigned int ipatch = ifield%nPatches;
+            vecPatches( ipatch )->finalizeSumField( fields[ifield], 0 );
+        }
     }
     // END iDim = 0 sync
     // -----------------
@@ -289,25 +298,29 @@ void SyncVectorPatch::sum( std::vector<Field *> fields, VectorPatch &vecPatches,
         // Sum per direction :
         
         // iDim = 1, initialize comms : Isend/Irecv
+        if( vecPatches.aggregate_field_exchanges_ ) {
+            SyncVectorPatch::initAggregated( fields, vecPatches, 1, true );
+        } else {
 #ifndef _NO_MPI_TM
-        #pragma omp for schedule(static)
+            #pragma omp for schedule(static)
 #else
-        #pragma omp single
+            #pragma omp single
 #endif
-        for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
-            unsigned int ipatch = ifield%nPatches;
-            vecPatches( ipatch )->initSumField( fields[ifield], 1, smpi );
+            for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+                unsigned int ipatch = ifield%nPatches;
+                vecPatches( ipatch )->initSumField( fields[ifield], 1, smpi );
+            }
         }
         
         // iDim = 1, local
         for( unsigned int icomp=0 ; icomp<nComp ; icomp++ ) {
-            nx_ = fields[icomp*nPatches]->dims_[0];
+            nx_ = fields[icomp*nPatches]->paddedDims_[0];
             ny_ = 1;
             nz_ = 1;
             if( fields[icomp*nPatches]->dims_.size()>1 ) {
-                ny_ = fields[icomp*nPatches]->dims_[1];
+                ny_ = fields[icomp*nPatches]->paddedDims_[1];
                 if( fields[icomp*nPatches]->dims_.size()>2 ) {
-                    nz_ = fields[icomp*nPatches]->dims_[2];
+                    nz_ = fields[icomp*nPatches]->paddedDims_[2];
                 }
             }
             gsp[0] = 1+2*oversize[0]+fields[icomp*nPatches]->isDual_[0]; //Ghost size primal
@@ -324,7 +337,7 @@ void SyncVectorPatch::sum( std::vector<Field *> fields, VectorPatch &vecPatches,
                         for( unsigned int i = 0; i < gsp[1]*nz_ ; i++ ) {
                             pt1[i] += pt2[i];
                         }
-                        memcpy( pt2, pt1, gsp[1]*nz_*sizeof( double ) );
+                        memcpy( pt2, pt1, gsp[1]*nz_*sizeof( fdouble ) );
                         pt1 += ny_*nz_;
                         pt2 += ny_*nz_;
                     }
@@ -333,14 +346,18 @@ void SyncVectorPatch::sum( std::vector<Field *> fields, VectorPatch &vecPatches,
         }
         
         // iDim = 1, finalize (waitall)
+        if( vecPatches.aggregate_field_exchanges_ ) {
+            SyncVectorPatch::finalizeAggregated( fields, vecPatches, 1, true );
+        } else {
 #ifndef _NO_MPI_TM
-        #pragma omp for schedule(static)
+            #pragma omp for schedule(static)
 #else
-        #pragma omp single
+            #pragma omp single
 #endif
-        for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
-            unsigned int ipatch = ifield%nPatches;
-            vecPatches( ipatch )->finalizeSumField( fields[ifield], 1 );
+            for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+                unsigned int ipatch = ifield%nPatches;
+                vecPatches( ipatch )->finalizeSumField( fields[ifield], 1 );
+            }
         }
         // END iDim = 1 sync
         // -----------------
@@ -350,25 +367,29 @@ void SyncVectorPatch::sum( std::vector<Field *> fields, VectorPatch &vecPatches,
             // Sum per direction :
             
             // iDim = 2, initialize comms : Isend/Irecv
+            if( vecPatches.aggregate_field_exchanges_ ) {
+                SyncVectorPatch::initAggregated( fields, vecPatches, 2, true );
+            } else {
 #ifndef _NO_MPI_TM
-            #pragma omp for schedule(static)
+                #pragma omp for schedule(static)
 #else
-            #pragma omp single
+                #pragma omp single
 #endif
-            for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
-                unsigned int ipatch = ifield%nPatches;
-                vecPatches( ipatch )->initSumField( fields[ifield], 2, smpi );
+                for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+                    unsigned int ipatch = ifield%nPatches;
+                    vecPatches( ipatch )->initSumField( fields[ifield], 2, smpi );
+                }
             }
             
             // iDim = 2 local
             for( unsigned int icomp=0 ; icomp<nComp ; icomp++ ) {
-                nx_ = fields[icomp*nPatches]->dims_[0];
+                nx_ = fields[icomp*nPatches]->paddedDims_[0];
                 ny_ = 1;
                 nz_ = 1;
                 if( fields[icomp*nPatches]->dims_.size()>1 ) {
-                    ny_ = fields[icomp*nPatches]->dims_[1];
+                    ny_ = fields[icomp*nPatches]->paddedDims_[1];
                     if( fields[icomp*nPatches]->dims_.size()>2 ) {
-                        nz_ = fields[icomp*nPatches]->dims_[2];
+                        nz_ = fields[icomp*nPatches]->paddedDims_[2];
                     }
                 }
                 gsp[0] = 1+2*oversize[0]+fields[icomp*nPatches]->isDual_[0]; //Ghost size primal
@@ -394,14 +415,18 @@ void SyncVectorPatch::sum( std::vector<Field *> fields, VectorPatch &vecPatches,
             }
             
             // iDim = 2, complete non local sync through MPIfinalize (waitall)
+            if( vecPatches.aggregate_field_exchanges_ ) {
+                SyncVectorPatch::finalizeAggregated( fields, vecPatches, 2, true );
+            } else {
 #ifndef _NO_MPI_TM
-            #pragma omp for schedule(static)
+                #pragma omp for schedule(static)
 #else
-            #pragma omp single
+                #pragma omp single
 #endif
-            for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
-                unsigned int ipatch = ifield%nPatches;
-                vecPatches( ipatch )->finalizeSumField( fields[ifield], 2 );
+                for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+                    unsigned int ipatch = ifield%nPatches;
+                    vecPatches( ipatch )->finalizeSumField( fields[ifield], 2 );
+                }
             }
             // END iDim = 2 sync
             // -----------------
@@ -448,13 +473,13 @@ void SyncVectorPatch::sumComplex( std::vector<Field *> fields, VectorPatch &vecP
     
     // iDim = 0, local
     for( unsigned int icomp=0 ; icomp<nComp ; icomp++ ) {
-        nx_ = fields[icomp*nPatches]->dims_[0];
+        nx_ = fields[icomp*nPatches]->paddedDims_[0];
         ny_ = 1;
         nz_ = 1;
         if( fields[icomp*nPatches]->dims_.size()>1 ) {
-            ny_ = fields[icomp*nPatches]->dims_[1];
+            ny_ = fields[icomp*nPatches]->paddedDims_[1];
             if( fields[icomp*nPatches]->dims_.size()>2 ) {
-                nz_ = fields[icomp*nPatches]->dims_[2];
+                nz_ = fields[icomp*nPatches]->paddedDims_[2];
             }
         }
         gsp[0] = 1+2*oversize[0]+fields[icomp*nPatches]->isDual_[0]; //Ghost size primal
@@ -507,13 +532,13 @@ void SyncVectorPatch::sumComplex( std::vector<Field *> fields, VectorPatch &vecP
         
         // iDim = 1, local
         for( unsigned int icomp=0 ; icomp<nComp ; icomp++ ) {
-            nx_ = fields[icomp*nPatches]->dims_[0];
+            nx_ = fields[icomp*nPatches]->paddedDims_[0];
             ny_ = 1;
             nz_ = 1;
             if( fields[icomp*nPatches]->dims_.size()>1 ) {
-                ny_ = fields[icomp*nPatches]->dims_[1];
+                ny_ = fields[icomp*nPatches]->paddedDims_[1];
                 if( fields[icomp*nPatches]->dims_.size()>2 ) {
-                    nz_ = fields[icomp*nPatches]->dims_[2];
+                    nz_ = fields[icomp*nPatches]->paddedDims_[2];
                 }
             }
             gsp[0] = 1+2*oversize[0]+fields[icomp*nPatches]->isDual_[0]; //Ghost size primal
@@ -570,13 +595,13 @@ void SyncVectorPatch::sumComplex( std::vector<Field *> fields, VectorPatch &vecP
             
             // iDim = 2 local
             for( unsigned int icomp=0 ; icomp<nComp ; icomp++ ) {
-                nx_ = fields[icomp*nPatches]->dims_[0];
+                nx_ = fields[icomp*nPatches]->paddedDims_[0];
                 ny_ = 1;
                 nz_ = 1;
                 if( fields[icomp*nPatches]->dims_.size()>1 ) {
-                    ny_ = fields[icomp*nPatches]->dims_[1];
+                    ny_ = fields[icomp*nPatches]->paddedDims_[1];
                     if( fields[icomp*nPatches]->dims_.size()>2 ) {
-                        nz_ = fields[icomp*nPatches]->dims_[2];
+                        nz_ = fields[icomp*nPatches]->paddedDims_[2];
                     }
                 }
                 gsp[0] = 1+2*oversize[0]+fields[icomp*nPatches]->isDual_[0]; //Ghost size primal
@@ -635,7 +660,7 @@ void SyncVectorPatch::sumComplex( std::vector<Field *> fields, VectorPatch &vecP
 void SyncVectorPatch::sum_all_components( std::vector<Field *> &fields, VectorPatch &vecPatches, SmileiMPI *smpi, Timers &timers, int itime )
 {
     unsigned int h0, oversize[3], n_space[3];
-    double *pt1, *pt2;
+    fdouble *pt1, *pt2;
     h0 = vecPatches( 0 )->hindex;
     
     int nPatches( vecPatches.size() );
@@ -655,16 +680,20 @@ void SyncVectorPatch::sum_all_components( std::vector<Field *> &fields, VectorPa
     
     // iDim = 0, initialize comms : Isend/Irecv
     unsigned int nPatchMPIx = vecPatches.MPIxIdx.size();
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::initAggregated( fields, vecPatches, 0, true );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++ ) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield             ], 0, smpi ); // Jx
-        vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield+  nPatchMPIx], 0, smpi ); // Jy
-        vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0, smpi ); // Jz
+        for( unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++ ) {
+            unsigned int ipatch = vecPatches.MPIxIdx[ifield];
+            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield             ], 0, smpi ); // Jx
+            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield+  nPatchMPIx], 0, smpi ); // Jy
+            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0, smpi ); // Jz
+        }
     }
     // iDim = 0, local
     int nFieldLocalx = vecPatches.densitiesLocalx.size()/3;
@@ -678,9 +707,9 @@ void SyncVectorPatch::sum_all_components( std::vector<Field *> &fields, VectorPa
         unsigned int ny_ = 1;
         unsigned int nz_ = 1;
         if( nDim>1 ) {
-            ny_ = vecPatches.densitiesLocalx[icomp*nFieldLocalx]->dims_[1];
+            ny_ = vecPatches.densitiesLocalx[icomp*nFieldLocalx]->paddedDims_[1];
             if( nDim>2 ) {
-                nz_ = vecPatches.densitiesLocalx[icomp*nFieldLocalx]->dims_[2];
+                nz_ = vecPatches.densitiesLocalx[icomp*nFieldLocalx]->paddedDims_[2];
             }
         }
         gsp[0] = 1+2*oversize[0]+vecPatches.densitiesLocalx[icomp*nFieldLocalx]->isDual_[0]; //Ghost size primal
@@ -698,22 +727,26 @@ void SyncVectorPatch::sum_all_components( std::vector<Field *> &fields, VectorPa
                     pt1[i] += pt2[i];
                 }
                 //Copy back the results to 2
-                memcpy( pt2, pt1, gsp[0]*ny_*nz_*sizeof( double ) );
+                memcpy( pt2, pt1, gsp[0]*ny_*nz_*sizeof( fdouble ) );
             }
         }
     }
     
     // iDim = 0, finalize (waitall)
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::finalizeAggregated( fields, vecPatches, 0, true );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++ ) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield             ], 0 ); // Jx
-        vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield+nPatchMPIx  ], 0 ); // Jy
-        vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0 ); // Jz
+        for( unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++ ) {
+            unsigned int ipatch = vecPatches.MPIxIdx[ifield];
+            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield             ], 0 ); // Jx
+            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield+nPatchMPIx  ], 0 ); // Jy
+            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0 ); // Jz
+        }
     }
     // END iDim = 0 sync
     // -----------------
@@ -724,16 +757,20 @@ void SyncVectorPatch::sum_all_components( std::vector<Field *> &fields, VectorPa
         
         // iDim = 1, initialize comms : Isend/Irecv
         unsigned int nPatchMPIy = vecPatches.MPIyIdx.size();
+        if( vecPatches.aggregate_field_exchanges_ ) {
+            SyncVectorPatch::initAggregated( fields, vecPatches, 1, true );
+        } else {
 #ifndef _NO_MPI_TM
-        #pragma omp for schedule(static)
+            #pragma omp for schedule(static)
 #else
-        #pragma omp single
+            #pragma omp single
 #endif
-        for( unsigned int ifield=0 ; ifield<nPatchMPIy ; ifield++ ) {
-            unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield             ], 1, smpi ); // Jx
-            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1, smpi ); // Jy
-            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1, smpi ); // Jz
+            for( unsigned int ifield=0 ; ifield<nPatchMPIy ; ifield++ ) {
+                unsigned int ipatch = vecPatches.MPIyIdx[ifield];
+                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield             ], 1, smpi ); // Jx
+                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1, smpi ); // Jy
+                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1, smpi ); // Jz
+            }
         }
         
         // iDim = 1,
@@ -744,13 +781,13 @@ void SyncVectorPatch::sum_all_components( std::vector<Field *> &fields, VectorPa
             }
             
             unsigned int gsp[3];
-            unsigned int nx_ =  vecPatches.densitiesLocaly[icomp*nFieldLocaly]->dims_[0];
+            unsigned int nx_ =  vecPatches.densitiesLocaly[icomp*nFieldLocaly]->paddedDims_[0];
             unsigned int ny_ = 1;
             unsigned int nz_ = 1;
             if( nDim>1 ) {
-                ny_ = vecPatches.densitiesLocaly[icomp*nFieldLocaly]->dims_[1];
+                ny_ = vecPatches.densitiesLocaly[icomp*nFieldLocaly]->paddedDims_[1];
                 if( nDim>2 ) {
-                    nz_ = vecPatches.densitiesLocaly[icomp*nFieldLocaly]->dims_[2];
+                    nz_ = vecPatches.densitiesLocaly[icomp*nFieldLocaly]->paddedDims_[2];
                 }
             }
             gsp[0] = 1+2*oversize[0]+vecPatches.densitiesLocaly[icomp*nFieldLocaly]->isDual_[0]; //Ghost size primal
@@ -769,7 +806,7 @@ void SyncVectorPatch::sum_all_components( std::vector<Field *> &fields, VectorPa
                         for( unsigned int i = 0; i < gsp[1]*nz_ ; i++ ) {
                             pt1[i] += pt2[i];
                         }
-                        memcpy( pt2, pt1, gsp[1]*nz_*sizeof( double ) );
+                        memcpy( pt2, pt1, gsp[1]*nz_*sizeof( fdouble ) );
                         pt1 += ny_*nz_;
                         pt2 += ny_*nz_;
                     }
@@ -778,16 +815,20 @@ void SyncVectorPatch::sum_all_components( std::vector<Field *> &fields, VectorPa
         }
         
         // iDim = 1, finalize (waitall)
+        if( vecPatches.aggregate_field_exchanges_ ) {
+            SyncVectorPatch::finalizeAggregated( fields, vecPatches, 1, true );
+        } else {
 #ifndef _NO_MPI_TM
-        #pragma omp for schedule(static)
+            #pragma omp for schedule(static)
 #else
-        #pragma omp single
+            #pragma omp single
 #endif
-        for( unsigned int ifield=0 ; ifield<nPatchMPIy ; ifield=ifield+1 ) {
-            unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield             ], 1 ); // Jx
-            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1 ); // Jy
-            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1 ); // Jz
+            for( unsigned int ifield=0 ; ifield<nPatchMPIy ; ifield=ifield+1 ) {
+                unsigned int ipatch = vecPatches.MPIyIdx[ifield];
+                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield             ], 1 ); // Jx
+                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1 ); // Jy
+                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1 ); // Jz
+            }
         }
         // END iDim = 1 sync
         // -----------------
@@ -798,16 +839,20 @@ void SyncVectorPatch::sum_all_components( std::vector<Field *> &fields, VectorPa
             
             // iDim = 2, initialize comms : Isend/Irecv
             unsigned int nPatchMPIz = vecPatches.MPIzIdx.size();
+            if( vecPatches.aggregate_field_exchanges_ ) {
+                SyncVectorPatch::initAggregated( fields, vecPatches, 2, true );
+            } else {
 #ifndef _NO_MPI_TM
-            #pragma omp for schedule(static)
+                #pragma omp for schedule(static)
 #else
-            #pragma omp single
+                #pragma omp single
 #endif
-            for( unsigned int ifield=0 ; ifield<nPatchMPIz ; ifield++ ) {
-                unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield             ], 2, smpi ); // Jx
-                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2, smpi ); // Jy
-                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2, smpi ); // Jz
+                for( unsigned int ifield=0 ; ifield<nPatchMPIz ; ifield++ ) {
+                    unsigned int ipatch = vecPatches.MPIzIdx[ifield];
+                    vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield             ], 2, smpi ); // Jx
+                    vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2, smpi ); // Jy
+                    vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2, smpi ); // Jz
+                }
             }
             
             // iDim = 2 local
@@ -818,13 +863,13 @@ void SyncVectorPatch::sum_all_components( std::vector<Field *> &fields, VectorPa
                 }
                 
                 unsigned int gsp[3];
-                unsigned int nx_ =  vecPatches.densitiesLocalz[icomp*nFieldLocalz]->dims_[0];
+                unsigned int nx_ =  vecPatches.densitiesLocalz[icomp*nFieldLocalz]->paddedDims_[0];
                 unsigned int ny_ = 1;
                 unsigned int nz_ = 1;
                 if( nDim>1 ) {
-                    ny_ = vecPatches.densitiesLocalz[icomp*nFieldLocalz]->dims_[1];
+                    ny_ = vecPatches.densitiesLocalz[icomp*nFieldLocalz]->paddedDims_[1];
                     if( nDim>2 ) {
-                        nz_ = vecPatches.densitiesLocalz[icomp*nFieldLocalz]->dims_[2];
+                        nz_ = vecPatches.densitiesLocalz[icomp*nFieldLocalz]->paddedDims_[2];
                     }
                 }
                 gsp[0] = 1+2*oversize[0]+vecPatches.densitiesLocalz[icomp*nFieldLocalz]->isDual_[0]; //Ghost size primal
@@ -853,16 +898,20 @@ void SyncVectorPatch::sum_all_components( std::vector<Field *> &fields, VectorPa
             }
             
             // iDim = 2, complete non local sync through MPIfinalize (waitall)
+            if( vecPatches.aggregate_field_exchanges_ ) {
+                SyncVectorPatch::finalizeAggregated( fields, vecPatches, 2, true );
+            } else {
 #ifndef _NO_MPI_TM
-            #pragma omp for schedule(static)
+                #pragma omp for schedule(static)
 #else
-            #pragma omp single
+                #pragma omp single
 #endif
-            for( unsigned int ifield=0 ; ifield<nPatchMPIz ; ifield=ifield+1 ) {
-                unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield             ], 2 ); // Jx
-                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2 ); // Jy
-                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2 ); // Jz
+                for( unsigned int ifield=0 ; ifield<nPatchMPIz ; ifield=ifield+1 ) {
+                    unsigned int ipatch = vecPatches.MPIzIdx[ifield];
+                    vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield             ], 2 ); // Jx
+                    vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2 ); // Jy
+                    vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2 ); // Jz
+                }
             }
             // END iDim = 2 sync
             // -----------------
@@ -1101,20 +1150,24 @@ void SyncVectorPatch::exchangeEnvChi( Params &params, VectorPatch &vecPatches, S
 // timers and itime were here introduced for debugging
 void SyncVectorPatch::exchange_along_all_directions( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi )
 {
-    for( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::initAggregated( fields, vecPatches, -1, false );
+    } else {
+        for( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
 #ifndef _NO_MPI_TM
-        #pragma omp for schedule(static)
+            #pragma omp for schedule(static)
 #else
-        #pragma omp single
+            #pragma omp single
 #endif
-        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-            vecPatches( ipatch )->initExchange( fields[ipatch], iDim, smpi );
-        }
-    } // End for iDim
+            for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
+                vecPatches( ipatch )->initExchange( fields[ipatch], iDim, smpi );
+            }
+        } // End for iDim
+    }
     
     
     unsigned int nx_, ny_( 1 ), nz_( 1 ), h0, oversize[3], n_space[3], gsp[3];
-    double *pt1, *pt2;
+    fdouble *pt1, *pt2;
     h0 = vecPatches( 0 )->hindex;
     
     oversize[0] = vecPatches( 0 )->EMfields->oversize[0];
@@ -1125,11 +1178,11 @@ void SyncVectorPatch::exchange_along_all_directions( std::vector<Field *> fields
     n_space[1] = vecPatches( 0 )->EMfields->n_space[1];
     n_space[2] = vecPatches( 0 )->EMfields->n_space[2];
     
-    nx_ = fields[0]->dims_[0];
+    nx_ = fields[0]->paddedDims_[0];
     if( fields[0]->dims_.size()>1 ) {
-        ny_ = fields[0]->dims_[1];
+        ny_ = fields[0]->paddedDims_[1];
         if( fields[0]->dims_.size()>2 ) {
-            nz_ = fields[0]->dims_[2];
+            nz_ = fields[0]->paddedDims_[2];
         }
     }
     
@@ -1142,8 +1195,8 @@ void SyncVectorPatch::exchange_along_all_directions( std::vector<Field *> fields
         if( vecPatches( ipatch )->MPI_me_ == vecPatches( ipatch )->MPI_neighbor_[0][0] ) {
             pt1 = &( *fields[vecPatches( ipatch )->neighbor_[0][0]-h0] )( ( n_space[0] )*ny_*nz_ );
             pt2 = &( *fields[ipatch] )( 0 );
-            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof( double ) );
-            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof( double ) );
+            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof( fdouble ) );
+            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof( fdouble ) );
         } // End if ( MPI_me_ == MPI_neighbor_[0][0] )
         
         if( fields[0]->dims_.size()>1 ) {
@@ -1183,6 +1236,11 @@ void SyncVectorPatch::exchange_along_all_directions( std::vector<Field *> fields
 // MPI_Wait for all communications initialised in exchange_along_all_directions
 void SyncVectorPatch::finalize_exchange_along_all_directions( std::vector<Field *> fields, VectorPatch &vecPatches )
 {
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::finalizeAggregated( fields, vecPatches, -1, false );
+        return;
+    }
+    
     for( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
 #ifndef _NO_MPI_TM
         #pragma omp for schedule(static)
@@ -1222,11 +1280,11 @@ void SyncVectorPatch::exchangeComplex( std::vector<Field *> fields, VectorPatch
     n_space[1] = vecPatches( 0 )->EMfields->n_space[1];
     n_space[2] = vecPatches( 0 )->EMfields->n_space[2];
     
-    nx_ = fields[0]->dims_[0];
+    nx_ = fields[0]->paddedDims_[0];
     if( fields[0]->dims_.size()>1 ) {
-        ny_ = fields[0]->dims_[1];
+        ny_ = fields[0]->paddedDims_[1];
         if( fields[0]->dims_.size()>2 ) {
-            nz_ = fields[0]->dims_[2];
+            nz_ = fields[0]->paddedDims_[2];
         }
     }
     
@@ -1288,15 +1346,19 @@ void SyncVectorPatch::exchangeComplex( std::vector<Field *> fields, VectorPatch
 // timers and itime were here introduced for debugging
 void SyncVectorPatch::exchange_along_all_directions_noomp( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi )
 {
-    for( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
-        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-            vecPatches( ipatch )->initExchange( fields[ipatch], iDim, smpi );
-        }
-    } // End for iDim
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        vecPatches.aggregatedBuffers( fields, -1, false, true )->init();
+    } else {
+        for( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
+            for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
+                vecPatches( ipatch )->initExchange( fields[ipatch], iDim, smpi );
+            }
+        } // End for iDim
+    }
     
     
     unsigned int nx_, ny_( 1 ), nz_( 1 ), h0, oversize[3], n_space[3], gsp[3];
-    double *pt1, *pt2;
+    fdouble *pt1, *pt2;
     h0 = vecPatches( 0 )->hindex;
     
     oversize[0] = vecPatches( 0 )->EMfields->oversize[0];
@@ -1307,11 +1369,11 @@ void SyncVectorPatch::exchange_along_all_directions_noomp( std::vector<Field *>
     n_space[1] = vecPatches( 0 )->EMfields->n_space[1];
     n_space[2] = vecPatches( 0 )->EMfields->n_space[2];
     
-    nx_ = fields[0]->dims_[0];
+    nx_ = fields[0]->paddedDims_[0];
     if( fields[0]->dims_.size()>1 ) {
-        ny_ = fields[0]->dims_[1];
+        ny_ = fields[0]->paddedDims_[1];
         if( fields[0]->dims_.size()>2 ) {
-            nz_ = fields[0]->dims_[2];
+            nz_ = fields[0]->paddedDims_[2];
         }
     }
     
@@ -1323,8 +1385,8 @@ void SyncVectorPatch::exchange_along_all_directions_noomp( std::vector<Field *>
         if( vecPatches( ipatch )->MPI_me_ == vecPatches( ipatch )->MPI_neighbor_[0][0] ) {
             pt1 = &( *fields[vecPatches( ipatch )->neighbor_[0][0]-h0] )( ( n_space[0] )*ny_*nz_ );
             pt2 = &( *fields[ipatch] )( 0 );
-            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof( double ) );
-            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof( double ) );
+            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof( fdouble ) );
+            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof( fdouble ) );
         } // End if ( MPI_me_ == MPI_neighbor_[0][0] )
         
         if( fields[0]->dims_.size()>1 ) {
@@ -1382,11 +1444,11 @@ void SyncVectorPatch::exchange_along_all_directions_noompComplex( std::vector<cF
     n_space[1] = vecPatches( 0 )->EMfields->n_space[1];
     n_space[2] = vecPatches( 0 )->EMfields->n_space[2];
     
-    nx_ = fields[0]->dims_[0];
+    nx_ = fields[0]->paddedDims_[0];
     if( fields[0]->dims_.size()>1 ) {
-        ny_ = fields[0]->dims_[1];
+        ny_ = fields[0]->paddedDims_[1];
         if( fields[0]->dims_.size()>2 ) {
-            nz_ = fields[0]->dims_[2];
+            nz_ = fields[0]->paddedDims_[2];
         }
     }
     
@@ -1454,6 +1516,11 @@ void SyncVectorPatch::finalizeexchangeComplex( std::vector<Field *> fields, Vect
 // MPI_Wait for all communications initialised in exchange_along_all_directions
 void SyncVectorPatch::finalize_exchange_along_all_directions_noomp( std::vector<Field *> fields, VectorPatch &vecPatches )
 {
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        vecPatches.aggregatedBuffers( fields, -1, false, false )->finalize();
+        return;
+    }
+    
     for( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
         for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
             vecPatches( ipatch )->finalizeExchange( fields[ipatch], iDim );
@@ -1479,7 +1546,7 @@ void SyncVectorPatch::exchange_synchronized_per_direction( std::vector<Field *>
 {
 
     unsigned int nx_, ny_( 1 ), nz_( 1 ), h0, oversize[3], n_space[3], gsp[3];
-    double *pt1, *pt2;
+    fdouble *pt1, *pt2;
     h0 = vecPatches( 0 )->hindex;
     
     oversize[0] = vecPatches( 0 )->EMfields->oversize[0];
@@ -1490,33 +1557,41 @@ void SyncVectorPatch::exchange_synchronized_per_direction( std::vector<Field *>
     n_space[1] = vecPatches( 0 )->EMfields->n_space[1];
     n_space[2] = vecPatches( 0 )->EMfields->n_space[2];
     
-    nx_ = fields[0]->dims_[0];
+    nx_ = fields[0]->paddedDims_[0];
     if( fields[0]->dims_.size()>1 ) {
-        ny_ = fields[0]->dims_[1];
+        ny_ = fields[0]->paddedDims_[1];
         if( fields[0]->dims_.size()>2 ) {
-            nz_ = fields[0]->dims_[2];
+            nz_ = fields[0]->paddedDims_[2];
         }
     }
     
     if( fields[0]->dims_.size()>2 ) {
     
         // Dimension 2
+        if( vecPatches.aggregate_field_exchanges_ ) {
+            SyncVectorPatch::initAggregated( fields, vecPatches, 2, false );
+        } else {
 #ifndef _NO_MPI_TM
-        #pragma omp for schedule(static)
+            #pragma omp for schedule(static)
 #else
-        #pragma omp single
+            #pragma omp single
 #endif
-        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-            vecPatches( ipatch )->initExchange( fields[ipatch], 2, smpi );
+            for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
+                vecPatches( ipatch )->initExchange( fields[ipatch], 2, smpi );
+            }
         }
         
+        if( vecPatches.aggregate_field_exchanges_ ) {
+            SyncVectorPatch::finalizeAggregated( fields, vecPatches, 2, false );
+        } else {
 #ifndef _NO_MPI_TM
-        #pragma omp for schedule(static)
+            #pragma omp for schedule(static)
 #else
-        #pragma omp single
+            #pragma omp single
 #endif
-        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-            vecPatches( ipatch )->finalizeExchange( fields[ipatch], 2 );
+            for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
+                vecPatches( ipatch )->finalizeExchange( fields[ipatch], 2 );
+            }
         }
         
         #pragma omp for schedule(static) private(pt1,pt2)
@@ -1544,22 +1619,30 @@ void SyncVectorPatch::exchange_synchronized_per_direction( std::vector<Field *>
     }
     
     // Dimension 1
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::initAggregated( fields, vecPatches, 1, false );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-        vecPatches( ipatch )->initExchange( fields[ipatch], 1, smpi );
+        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
+            vecPatches( ipatch )->initExchange( fields[ipatch], 1, smpi );
+        }
     }
     
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::finalizeAggregated( fields, vecPatches, 1, false );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-        vecPatches( ipatch )->finalizeExchange( fields[ipatch], 1 );
+        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
+            vecPatches( ipatch )->finalizeExchange( fields[ipatch], 1 );
+        }
     }
     
     #pragma omp for schedule(static) private(pt1,pt2)
@@ -1583,22 +1666,30 @@ void SyncVectorPatch::exchange_synchronized_per_direction( std::vector<Field *>
     } // End for( ipatch )
     
     // Dimension 0
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::initAggregated( fields, vecPatches, 0, false );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-        vecPatches( ipatch )->initExchange( fields[ipatch], 0, smpi );
+        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
+            vecPatches( ipatch )->initExchange( fields[ipatch], 0, smpi );
+        }
     }
     
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::finalizeAggregated( fields, vecPatches, 0, false );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-        vecPatches( ipatch )->finalizeExchange( fields[ipatch], 0 );
+        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
+            vecPatches( ipatch )->finalizeExchange( fields[ipatch], 0 );
+        }
     }
     
     
@@ -1611,8 +1702,8 @@ void SyncVectorPatch::exchange_synchronized_per_direction( std::vector<Field *>
         if( vecPatches( ipatch )->MPI_me_ == vecPatches( ipatch )->MPI_neighbor_[0][0] ) {
             pt1 = &( *fields[vecPatches( ipatch )->neighbor_[0][0]-h0] )( ( n_space[0] )*ny_*nz_ );
             pt2 = &( *fields[ipatch] )( 0 );
-            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof( double ) );
-            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof( double ) );
+            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof( fdouble ) );
+            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof( fdouble ) );
         } // End if ( MPI_me_ == MPI_neighbor_[0][0] )
         
     } // End for( ipatch )
@@ -1630,20 +1721,24 @@ void SyncVectorPatch::exchange_synchronized_per_direction( std::vector<Field *>
 void SyncVectorPatch::exchange_all_components_along_X( std::vector<Field *> &fields, VectorPatch &vecPatches, SmileiMPI *smpi )
 {
     unsigned int nMPIx = vecPatches.MPIxIdx.size();
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::initAggregated( fields, vecPatches, 0, false );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ifield=0 ; ifield<nMPIx ; ifield++ ) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield      ], 0, smpi ); // By
-        vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield+nMPIx], 0, smpi ); // Bz
+        for( unsigned int ifield=0 ; ifield<nMPIx ; ifield++ ) {
+            unsigned int ipatch = vecPatches.MPIxIdx[ifield];
+            vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield      ], 0, smpi ); // By
+            vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield+nMPIx], 0, smpi ); // Bz
+        }
     }
     
     
     unsigned int h0, oversize, n_space;
-    double *pt1, *pt2;
+    fdouble *pt1, *pt2;
     h0 = vecPatches( 0 )->hindex;
     
     oversize = vecPatches( 0 )->EMfields->oversize[0];
@@ -1661,9 +1756,9 @@ void SyncVectorPatch::exchange_all_components_along_X( std::vector<Field *> &fie
         
         unsigned int ny_( 1 ), nz_( 1 ), gsp;
         if( nDim>1 ) {
-            ny_ = vecPatches.B_localx[icomp*nFieldLocalx]->dims_[1];
+            ny_ = vecPatches.B_localx[icomp*nFieldLocalx]->paddedDims_[1];
             if( nDim>2 ) {
-                nz_ = vecPatches.B_localx[icomp*nFieldLocalx]->dims_[2];
+                nz_ = vecPatches.B_localx[icomp*nFieldLocalx]->paddedDims_[2];
             }
         }
         gsp = ( oversize + 1 + vecPatches.B_localx[icomp*nFieldLocalx]->isDual_[0] ); //Ghost size primal
@@ -1678,8 +1773,8 @@ void SyncVectorPatch::exchange_all_components_along_X( std::vector<Field *> &fie
                 pt1 = &( fields[vecPatches( ipatch )->neighbor_[0][0]-h0+icomp*nPatches]->data_[n_space*ny_*nz_] );
                 pt2 = &( vecPatches.B_localx[ifield]->data_[0] );
                 //for filter
-                memcpy( pt2, pt1, oversize*ny_*nz_*sizeof( double ) );
-                memcpy( pt1+gsp*ny_*nz_, pt2+gsp*ny_*nz_, oversize*ny_*nz_*sizeof( double ) );
+                memcpy( pt2, pt1, oversize*ny_*nz_*sizeof( fdouble ) );
+                memcpy( pt1+gsp*ny_*nz_, pt2+gsp*ny_*nz_, oversize*ny_*nz_*sizeof( fdouble ) );
             } // End if ( MPI_me_ == MPI_neighbor_[0][0] )
             
         } // End for( ipatch )
@@ -1691,15 +1786,19 @@ void SyncVectorPatch::exchange_all_components_along_X( std::vector<Field *> &fie
 void SyncVectorPatch::finalize_exchange_all_components_along_X( std::vector<Field *> &fields, VectorPatch &vecPatches )
 {
     unsigned int nMPIx = vecPatches.MPIxIdx.size();
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::finalizeAggregated( fields, vecPatches, 0, false );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ifield=0 ; ifield<nMPIx ; ifield++ ) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B_MPIx[ifield      ], 0 ); // By
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B_MPIx[ifield+nMPIx], 0 ); // Bz
+        for( unsigned int ifield=0 ; ifield<nMPIx ; ifield++ ) {
+            unsigned int ipatch = vecPatches.MPIxIdx[ifield];
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B_MPIx[ifield      ], 0 ); // By
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B_MPIx[ifield+nMPIx], 0 ); // Bz
+        }
     }
 }
 
@@ -1714,19 +1813,23 @@ void SyncVectorPatch::finalize_exchange_all_components_along_X( std::vector<Fiel
 void SyncVectorPatch::exchange_all_components_along_Y( std::vector<Field *> &fields, VectorPatch &vecPatches, SmileiMPI *smpi )
 {
     unsigned int nMPIy = vecPatches.MPIyIdx.size();
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::initAggregated( fields, vecPatches, 1, false );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ifield=0 ; ifield<nMPIy ; ifield++ ) {
-        unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-        vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield      ], 1, smpi ); // Bx
-        vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1, smpi ); // Bz
+        for( unsigned int ifield=0 ; ifield<nMPIy ; ifield++ ) {
+            unsigned int ipatch = vecPatches.MPIyIdx[ifield];
+            vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield      ], 1, smpi ); // Bx
+            vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1, smpi ); // Bz
+        }
     }
     
     unsigned int h0, oversize, n_space;
-    double *pt1, *pt2;
+    fdouble *pt1, *pt2;
     h0 = vecPatches( 0 )->hindex;
     
     oversize = vecPatches( 0 )->EMfields->oversize[1];
@@ -1742,10 +1845,10 @@ void SyncVectorPatch::exchange_all_components_along_Y( std::vector<Field *> &fie
         }
         
         unsigned int nx_, ny_, nz_( 1 ), gsp;
-        nx_ = vecPatches.B1_localy[icomp*nFieldLocaly]->dims_[0];
-        ny_ = vecPatches.B1_localy[icomp*nFieldLocaly]->dims_[1];
+        nx_ = vecPatches.B1_localy[icomp*nFieldLocaly]->paddedDims_[0];
+        ny_ = vecPatches.B1_localy[icomp*nFieldLocaly]->paddedDims_[1];
         if( nDim>2 ) {
-            nz_ = vecPatches.B1_localy[icomp*nFieldLocaly]->dims_[2];
+            nz_ = vecPatches.B1_localy[icomp*nFieldLocaly]->paddedDims_[2];
         }
         //for filter
         gsp = ( oversize + 1 + vecPatches.B1_localy[icomp*nFieldLocaly]->isDual_[1] ); //Ghost size primal
@@ -1777,15 +1880,19 @@ void SyncVectorPatch::exchange_all_components_along_Y( std::vector<Field *> &fie
 void SyncVectorPatch::finalize_exchange_all_components_along_Y( std::vector<Field *> &fields, VectorPatch &vecPatches )
 {
     unsigned int nMPIy = vecPatches.MPIyIdx.size();
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::finalizeAggregated( fields, vecPatches, 1, false );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ifield=0 ; ifield<nMPIy ; ifield++ ) {
-        unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B1_MPIy[ifield      ], 1 ); // By
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1 ); // Bz
+        for( unsigned int ifield=0 ; ifield<nMPIy ; ifield++ ) {
+            unsigned int ipatch = vecPatches.MPIyIdx[ifield];
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B1_MPIy[ifield      ], 1 ); // By
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1 ); // Bz
+        }
     }
     
     
@@ -1802,19 +1909,23 @@ void SyncVectorPatch::finalize_exchange_all_components_along_Y( std::vector<Fiel
 void SyncVectorPatch::exchange_all_components_along_Z( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi )
 {
     unsigned int nMPIz = vecPatches.MPIzIdx.size();
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::initAggregated( fields, vecPatches, 2, false );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ifield=0 ; ifield<nMPIz ; ifield++ ) {
-        unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-        vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield],       2, smpi ); // Bx
-        vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2, smpi ); // By
+        for( unsigned int ifield=0 ; ifield<nMPIz ; ifield++ ) {
+            unsigned int ipatch = vecPatches.MPIzIdx[ifield];
+            vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield],       2, smpi ); // Bx
+            vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2, smpi ); // By
+        }
     }
     
     unsigned int h0, oversize, n_space;
-    double *pt1, *pt2;
+    fdouble *pt1, *pt2;
     h0 = vecPatches( 0 )->hindex;
     
     oversize = vecPatches( 0 )->EMfields->oversize[2];
@@ -1829,9 +1940,9 @@ void SyncVectorPatch::exchange_all_components_along_Z( std::vector<Field *> fiel
         }
         
         unsigned int nx_, ny_, nz_, gsp;
-        nx_ = vecPatches.B2_localz[icomp*nFieldLocalz]->dims_[0];
-        ny_ = vecPatches.B2_localz[icomp*nFieldLocalz]->dims_[1];
-        nz_ = vecPatches.B2_localz[icomp*nFieldLocalz]->dims_[2];
+        nx_ = vecPatches.B2_localz[icomp*nFieldLocalz]->paddedDims_[0];
+        ny_ = vecPatches.B2_localz[icomp*nFieldLocalz]->paddedDims_[1];
+        nz_ = vecPatches.B2_localz[icomp*nFieldLocalz]->paddedDims_[2];
         //for filter
         gsp = ( oversize + 1 + vecPatches.B2_localz[icomp*nFieldLocalz]->isDual_[2] ); //Ghost size primal
         
@@ -1862,20 +1973,67 @@ void SyncVectorPatch::exchange_all_components_along_Z( std::vector<Field *> fiel
 void SyncVectorPatch::finalize_exchange_all_components_along_Z( std::vector<Field *> fields, VectorPatch &vecPatches )
 {
     unsigned int nMPIz = vecPatches.MPIzIdx.size();
+    if( vecPatches.aggregate_field_exchanges_ ) {
+        SyncVectorPatch::finalizeAggregated( fields, vecPatches, 2, false );
+    } else {
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ifield=0 ; ifield<nMPIz ; ifield++ ) {
-        unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B2_MPIz[ifield      ], 2 ); // Bx
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2 ); // By
+        for( unsigned int ifield=0 ; ifield<nMPIz ; ifield++ ) {
+            unsigned int ipatch = vecPatches.MPIzIdx[ifield];
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B2_MPIz[ifield      ], 2 ); // Bx
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2 ); // By
+        }
     }
     
 }
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Aggregated exchanges (Main.aggregate_field_exchanges) : one message per neighboring MPI process for all the
+// patches and components of fields, in direction iDim (all directions if iDim<0)
+// The receptions are started before the faces are packed, the sends once they are all packed
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::initAggregated( std::vector<Field *> &fields, VectorPatch &vecPatches, int iDim, bool sum )
+{
+    AggregatedMPIbuffers *buffers;
+    #pragma omp single copyprivate(buffers)
+    {
+        buffers = vecPatches.aggregatedBuffers( fields, iDim, sum, true );
+        buffers->startRecv();
+    }
+    
+    unsigned int nFaces = buffers->nSendFaces();
+    #pragma omp for schedule(static)
+    for( unsigned int iface=0 ; iface<nFaces ; iface++ ) {
+        buffers->pack( iface );
+    }
+    
+    #pragma omp single
+    buffers->startSend();
+}
+
+// MPI_Waitall for the messages started in initAggregated, then copy (or sum) the received faces
+// The faces received by a patch are unpacked by a single thread, in a fixed order
+void SyncVectorPatch::finalizeAggregated( std::vector<Field *> &fields, VectorPatch &vecPatches, int iDim, bool sum )
+{
+    AggregatedMPIbuffers *buffers;
+    #pragma omp single copyprivate(buffers)
+    {
+        buffers = vecPatches.aggregatedBuffers( fields, iDim, sum, false );
+        buffers->waitAll();
+    }
+    
+    unsigned int nGroups = buffers->nRecvGroups();
+    #pragma omp for schedule(static)
+    for( unsigned int igroup=0 ; igroup<nGroups ; igroup++ ) {
+        buffers->unpack( igroup );
+    }
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // ---------------------------------------------------------------------------------------------------------------------
 // -------------------------------------------  DEPRECATED FIELD FUNCTIONS  --------------------------------------------
@@ -1894,7 +2052,7 @@ void SyncVectorPatch::exchange_along_X( std::vector<Field *> fields, VectorPatch
     }
     
     unsigned int ny_( 1 ), nz_( 1 ), h0, oversize, n_space, gsp;
-    double *pt1, *pt2;
+    fdouble *pt1, *pt2;
     h0 = vecPatches( 0 )->hindex;
     
     oversize = vecPatches( 0 )->EMfields->oversize[0];
@@ -1902,9 +2060,9 @@ void SyncVectorPatch::exchange_along_X( std::vector<Field *> fields, VectorPatch
     n_space = vecPatches( 0 )->EMfields->n_space[0];
     
     if( fields[0]->dims_.size()>1 ) {
-        ny_ = fields[0]->dims_[1];
+        ny_ = fields[0]->paddedDims_[1];
         if( fields[0]->dims_.size()>2 ) {
-            nz_ = fields[0]->dims_[2];
+            nz_ = fields[0]->paddedDims_[2];
         }
     }
     
@@ -1921,8 +2079,8 @@ void SyncVectorPatch::exchange_along_X( std::vector<Field *> fields, VectorPatch
             //memcpy( pt2, pt1, ny_*sizeof(double));
             //memcpy( pt1+gsp[0]*ny_, pt2+gsp[0]*ny_, ny_*sizeof(double));
             //for filter
-            memcpy( pt2, pt1, oversize*ny_*nz_*sizeof( double ) );
-            memcpy( pt1+gsp*ny_*nz_, pt2+gsp*ny_*nz_, oversize*ny_*nz_*sizeof( double ) );
+            memcpy( pt2, pt1, oversize*ny_*nz_*sizeof( fdouble ) );
+            memcpy( pt1+gsp*ny_*nz_, pt2+gsp*ny_*nz_, oversize*ny_*nz_*sizeof( fdouble ) );
         } // End if ( MPI_me_ == MPI_neighbor_[0][0] )
         
         
@@ -1955,16 +2113,16 @@ void SyncVectorPatch::exchange_along_Y( std::vector<Field *> fields, VectorPatch
     }
     
     unsigned int nx_, ny_, nz_( 1 ), h0, oversize, n_space, gsp;
-    double *pt1, *pt2;
+    fdouble *pt1, *pt2;
     h0 = vecPatches( 0 )->hindex;
     
     oversize = vecPatches( 0 )->EMfields->oversize[1];
     n_space = vecPatches( 0 )->EMfields->n_space[1];
     
-    nx_ = fields[0]->dims_[0];
-    ny_ = fields[0]->dims_[1];
+    nx_ = fields[0]->paddedDims_[0];
+    ny_ = fields[0]->paddedDims_[1];
     if( fields[0]->dims_.size()>2 ) {
-        nz_ = fields[0]->dims_[2];
+        nz_ = fields[0]->paddedDims_[2];
     }
     
     //gsp = 2*oversize[1]+fields[0]->isDual_[1]; //Ghost size primal
@@ -2015,15 +2173,15 @@ void SyncVectorPatch::exchange_along_Z( std::vector<Field *> fields, VectorPatch
     }
     
     unsigned int nx_, ny_, nz_, h0, oversize, n_space, gsp;
-    double *pt1, *pt2;
+    fdouble *pt1, *pt2;
     h0 = vecPatches( 0 )->hindex;
     
     oversize = vecPatches( 0 )->EMfields->oversize[2];
     n_space = vecPatches( 0 )->EMfields->n_space[2];
     
-    nx_ = fields[0]->dims_[0];
-    ny_ = fields[0]->dims_[1];
-    nz_ = fields[0]->dims_[2];
+    nx_ = fields[0]->paddedDims_[0];
+    ny_ = fields[0]->paddedDims_[1];
+    nz_ = fields[0]->paddedDims_[2];
     
     //gsp = 2*oversize[1]+fields[0]->isDual_[1]; //Ghost size primal
     //for filter
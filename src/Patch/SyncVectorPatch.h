@@ -70,6 +70,11 @@ public :
     
     static void exchange_synchronized_per_direction( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi );
     
+    //! Aggregated MPI exchanges (Main.aggregate_field_exchanges) of fields in direction iDim (all directions if iDim<0)
+    //! The ghost cells are summed if sum is true, copied otherwise
+    static void initAggregated( std::vector<Field *> &fields, VectorPatch &vecPatches, int iDim, bool sum );
+    static void finalizeAggregated( std::vector<Field *> &fields, VectorPatch &vecPatches, int iDim, bool sum );
+    
     static void exchange_all_components_along_X( std::vector<Field *> &fields, VectorPatch &vecPatches, SmileiMPI *smpi );
     static void finalize_exchange_all_components_along_X( std::vector<Field *> &fields, VectorPatch &vecPatches );
     static void exchange_all_components_along_Y( std::vector<Field *> &fields, VectorPatch &vecPatches, SmileiMPI *smpi );
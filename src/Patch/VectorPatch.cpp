@@ -20,6 +20,7 @@
 #include "LaserEnvelope.h"
 
 #include "SyncVectorPatch.h"
+#include "AggregatedMPIbuffers.h"
 #include "interface.h"
 #include "Timers.h"
 
@@ -29,12 +30,18 @@ using namespace std;
 VectorPatch::VectorPatch()
 {
     domain_decomposition_ = NULL ;
+    aggregate_field_exchanges_ = false;
 }
 
 
 VectorPatch::VectorPatch( Params &params )
 {
     domain_decomposition_ = DomainDecompositionFactory::create( params );
+    
+    aggregate_field_exchanges_ = params.aggregate_field_exchanges;
+    if( aggregate_field_exchanges_ ) {
+        MPI_Comm_dup( MPI_COMM_WORLD, &aggregated_comm_ );
+    }
 }
 
 
@@ -43,6 +50,32 @@ VectorPatch::~VectorPatch()
     if( domain_decomposition_ != NULL ) {
         delete domain_decomposition_;
     }
+    
+    for( unsigned int i=0 ; i<aggregatedBuffers_.size() ; i++ ) {
+        delete aggregatedBuffers_[i];
+    }
+    if( aggregate_field_exchanges_ ) {
+        MPI_Comm_free( &aggregated_comm_ );
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Aggregated buffers of an exchange phase, created at the first exchange of these fields in this direction
+// The exchanges are created in the same order by all MPI processes, their index is used as MPI tag
+// ---------------------------------------------------------------------------------------------------------------------
+AggregatedMPIbuffers *VectorPatch::aggregatedBuffers( std::vector<Field *> &fields, int iDim, bool sum, bool update )
+{
+    for( unsigned int i=0 ; i<aggregatedBuffers_.size() ; i++ ) {
+        if( aggregatedBuffers_[i]->isFor( fields, size(), iDim, sum ) ) {
+            if( update ) {
+                aggregatedBuffers_[i]->update( fields, *this );
+            }
+            return aggregatedBuffers_[i];
+        }
+    }
+    aggregatedBuffers_.push_back( new AggregatedMPIbuffers( fields, *this, iDim, sum, aggregatedBuffers_.size(), aggregated_comm_ ) );
+    return aggregatedBuffers_.back();
 }
 
 
@@ -333,6 +366,11 @@ void VectorPatch::dynamics( Params &params,
                                 localDiags );
                     }
                 } // end if condition on envelope dynamics
+                // Particle merging, on particles still sorted per cell
+                if( spec->Merge && spec->merging_time_selection->theTimeIsNow( itime )
+                        && ( spec->vectorized_operators || params.vectorization_mode == "adaptive" ) ) {
+                    spec->mergeParticles( time_dual );
+                }
             } // end if condition on species
         } // end loop on species
         //MESSAGE("species dynamics");
@@ -359,6 +397,15 @@ void VectorPatch::dynamics( Params &params,
     } // end loop on species
     //MESSAGE("exchange particles");
     timers.syncPart.update( params.printNow( itime ) );
+    #pragma omp master
+    {
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            for( unsigned int ispec=0 ; ispec<( *this )( ipatch )->vecSpecies.size() ; ispec++ ) {
+                timers.syncPart.addCount( species( ipatch, ispec )->nparts_moved_by_sort );
+                species( ipatch, ispec )->nparts_moved_by_sort = 0;
+            }
+        }
+    }
 #ifdef __DETAILED_TIMERS
     timers.sorting.update( *this, params.printNow( itime ) );
 #endif
@@ -617,24 +664,32 @@ void VectorPatch::solveMaxwell( Params &params, SimWindow *simWindow, int itime,
 {
     timers.maxwell.restart();
     
-    for( unsigned int ipassfilter=0 ; ipassfilter<params.currentFilter_passes ; ipassfilter++ ) {
+    // Current spatial filtering, by rounds of passes (a single round if the ghost cells are wide enough)
+    for( unsigned int iround=0 ; iround<params.currentFilter_round_passes.size() ; iround++ ) {
         #pragma omp for schedule(static)
         for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
-            // Current spatial filtering
-            ( *this )( ipatch )->EMfields->binomialCurrentFilter();
+            ( *this )( ipatch )->EMfields->binomialCurrentFilter( params.currentFilter_round_passes[iround], params.currentFilter_round_compensated[iround] );
+        }
+        // The passes invalidate the ghost cells on several layers, including the corners which are only
+        // restored by an exchange performed one dimension after the other
+        if( params.nDim_field > 1 ) {
+            SyncVectorPatch::exchange_synchronized_per_direction( listJx_, *this, smpi );
+            SyncVectorPatch::exchange_synchronized_per_direction( listJy_, *this, smpi );
+            SyncVectorPatch::exchange_synchronized_per_direction( listJz_, *this, smpi );
+        } else {
+            SyncVectorPatch::exchange_along_all_directions( listJx_, *this, smpi );
+            SyncVectorPatch::finalize_exchange_along_all_directions( listJx_, *this );
+            SyncVectorPatch::exchange_along_all_directions( listJy_, *this, smpi );
+            SyncVectorPatch::finalize_exchange_along_all_directions( listJy_, *this );
+            SyncVectorPatch::exchange_along_all_directions( listJz_, *this, smpi );
+            SyncVectorPatch::finalize_exchange_along_all_directions( listJz_, *this );
         }
-        SyncVectorPatch::exchange_along_all_directions( listJx_, *this, smpi );
-        SyncVectorPatch::finalize_exchange_along_all_directions( listJx_, *this );
-        SyncVectorPatch::exchange_along_all_directions( listJy_, *this, smpi );
-        SyncVectorPatch::finalize_exchange_along_all_directions( listJy_, *this );
-        SyncVectorPatch::exchange_along_all_directions( listJz_, *this, smpi );
-        SyncVectorPatch::finalize_exchange_along_all_directions( listJz_, *this );
     }
     #pragma omp for schedule(static)
     for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
-        if( !params.is_spectral ) {
+        if( !params.is_spectral && params.maxwell_tile_size == 0 ) {
             // Saving magnetic fields (to compute centered fields used in the particle pusher)
-            // Stores B at time n in B_m.
+            // Stores B at time n in B_m (done by the tiled solver itself otherwise).
             ( *this )( ipatch )->EMfields->saveMagneticFields( params.is_spectral );
         }
         // Computes Ex_, Ey_, Ez_ on all points.
@@ -665,9 +720,13 @@ void VectorPatch::solveMaxwell( Params &params, SimWindow *simWindow, int itime,
     timers.syncField.update( params.printNow( itime ) );
     
     
+    // With PICSAR, and with the native spectral solver, the fields are finalized here on the Domain grid
+    bool finalize_on_domain( params.is_spectral );
 #ifdef _PICSAR
+    finalize_on_domain = true;
+#endif
     //if ( (params.is_spectral) && (itime!=0) && ( time_dual > params.time_fields_frozen ) ) {
-    if( ( itime!=0 ) && ( time_dual > params.time_fields_frozen ) ) {
+    if( finalize_on_domain && ( itime!=0 ) && ( time_dual > params.time_fields_frozen ) ) {
         timers.syncField.restart();
         if( params.is_spectral ) {
             SyncVectorPatch::finalizeexchangeE( params, ( *this ) );
@@ -684,14 +743,14 @@ void VectorPatch::solveMaxwell( Params &params, SimWindow *simWindow, int itime,
             if( !params.is_spectral ) {
                 ( *this )( ipatch )->EMfields->centerMagneticFields();
             } else {
-                ( *this )( ipatch )->EMfields->saveMagneticFields( params.is_spectral );
+                // B_m points to B with PICSAR, it is a copy of B (including ghost cells) otherwise
+                ( *this )( ipatch )->EMfields->saveMagneticFields( params.is_pxr );
             }
         }
-        if( params.is_spectral ) {
+        if( params.is_spectral && params.is_pxr ) {
             save_old_rho( params );
         }
     }
-#endif
     
     
 } // END solveMaxwell
@@ -966,6 +1025,10 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI *smpi )
     
     // compute control parameter
     double ctrl = rnew_dot_rnew / ( double )( nx_p2_global );
+#ifdef __SINGLE_PRECISION_FIELDS
+    double ctrl_init = ctrl;
+    bool at_rounding_level = false;
+#endif
     
     // ---------------------------------------------------------
     // Starting iterative loop for the conjugate gradient method
@@ -1026,12 +1089,28 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI *smpi )
             DEBUG( "iteration " << iteration << " done, exiting with control parameter ctrl = " << ctrl );
         }
         
+#ifdef __SINGLE_PRECISION_FIELDS
+        // The residual cannot decrease below the rounding error of the single precision fields
+        // (e.g. the charge density of a neutral plasma): stop when it grows instead of diverging
+        if( ctrl > ctrl_init ) {
+            at_rounding_level = true;
+            break;
+        }
+#endif
+        
     }//End of the iterative loop
     
     
     // --------------------------------
     // Status of the solver convergence
     // --------------------------------
+#ifdef __SINGLE_PRECISION_FIELDS
+    if( at_rounding_level ) {
+        if( smpi->isMaster() )
+            WARNING( "Poisson solver stopped at iteration: " << iteration << ", residual at the rounding level of the single precision fields"
+                     << ", relative err is ctrl = " << 1.0e14*ctrl << " x 1e-14" );
+    } else
+#endif
     if( iteration_max>0 && iteration == iteration_max ) {
         if( smpi->isMaster() )
             WARNING( "Poisson solver did not converge: reached maximum iteration number: " << iteration
@@ -2913,7 +2992,7 @@ void VectorPatch::save_old_rho( Params &params )
         if( params.nDim_field ==3 ) {
             n*=( *this )( ipatch )->EMfields->rhoold_->dims_[2];
         }
-        std::memcpy( ( *this )( ipatch )->EMfields->rhoold_->data_, ( *this )( ipatch )->EMfields->rho_->data_, sizeof( double )*n );
+        std::memcpy( ( *this )( ipatch )->EMfields->rhoold_->data_, ( *this )( ipatch )->EMfields->rho_->data_, sizeof( fdouble )*n );
     }
 }
 
@@ -2979,7 +3058,7 @@ void VectorPatch::check_expected_disk_usage( SmileiMPI *smpi, Params &params, Ch
                 n_fields += EM->allFields_avg[idiag].size();
             }
             //     * Conclude the total field disk footprint
-            uint64_t checkpoint_fields_footprint = n_grid_points * ( uint64_t )( n_fields * sizeof( double ) );
+            uint64_t checkpoint_fields_footprint = n_grid_points * ( uint64_t )( n_fields * sizeof( fdouble ) );
             MESSAGE( 2, "For fields: " << Tools::printBytes( checkpoint_fields_footprint ) );
             
             // - Contribution from particles
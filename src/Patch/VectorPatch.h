@@ -21,6 +21,7 @@
 #include "RadiationTables.h"
 
 class Field;
+class AggregatedMPIbuffers;
 class Timer;
 class SimWindow;
 class DomainDecomposition;
@@ -284,6 +285,15 @@ public :
     std::vector<std::vector< Field *>> listBr_;
     std::vector<std::vector< Field *>> listBt_;
     
+    //! Aggregate the MPI messages of the field synchronizations per MPI process (Main.aggregate_field_exchanges)
+    bool aggregate_field_exchanges_;
+    //! Communicator of the aggregated messages, separated from the patch to patch messages
+    MPI_Comm aggregated_comm_;
+    //! Aggregated buffers of all the exchange phases, created at their first use (their index is their MPI tag)
+    std::vector<AggregatedMPIbuffers *> aggregatedBuffers_;
+    //! Aggregated buffers of an exchange phase of fields (see AggregatedMPIbuffers), updated if update is true
+    AggregatedMPIbuffers *aggregatedBuffers( std::vector<Field *> &fields, int iDim, bool sum, bool update );
+    
     
     //! True if any antennas
     unsigned int nAntennas;
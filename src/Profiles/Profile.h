@@ -54,7 +54,7 @@ public:
                 dims[idim] = (npy_intp) (coordinates[0]->dims()[idim]);
             // Expose arrays as numpy, and evaluate
             for( unsigned int ivar=0; ivar<nvar; ivar++ )
-                x[ivar] = (PyArrayObject*)PyArray_SimpleNewFromData(ndim, dims, NPY_DOUBLE, (double*)(coordinates[ivar]->data()));
+                x[ivar] = asNumpy(coordinates[ivar], ndim, dims);
             PyArrayObject* values = function->valueAt(x);
             for( unsigned int ivar=0; ivar<nvar; ivar++ )
                 Py_DECREF(x[ivar]);
@@ -90,7 +90,7 @@ public:
                 dims[idim] = (npy_intp) coordinates[0]->dims()[idim];
             // Expose arrays as numpy, and evaluate
             for( unsigned int ivar=0; ivar<nvar; ivar++ ){
-                x[ivar] = (PyArrayObject*)PyArray_SimpleNewFromData(ndim, dims, NPY_DOUBLE, (double*)(coordinates[ivar]->data()));}
+                x[ivar] = asNumpy(coordinates[ivar], ndim, dims);}
             PyArrayObject* values = function->complexValueAt(x);
             for( unsigned int ivar=0; ivar<nvar; ivar++ )
                 Py_DECREF(x[ivar]);
@@ -128,9 +128,9 @@ public:
                 dims[idim] = (npy_intp) coordinates[0]->dims()[idim];
             // Expose arrays as numpy, and evaluate
             for( unsigned int ivar=0; ivar<nvar; ivar++ ){
-                x[ivar] = (PyArrayObject*)PyArray_SimpleNewFromData(ndim, dims, NPY_DOUBLE, (double*)(coordinates[ivar]->data()));
+                x[ivar] = asNumpy(coordinates[ivar], ndim, dims);
             }    
-            t = (PyArrayObject*)PyArray_SimpleNewFromData(ndim, dims, NPY_DOUBLE, (double*)(time->data()));
+            t = asNumpy(time, ndim, dims);
             PyArrayObject* values = function->complexValueAt(x,t);
             for( unsigned int ivar=0; ivar<nvar; ivar++ )
                 Py_DECREF(x[ivar]);
@@ -177,6 +177,19 @@ private:
     //! Whether the profile is using numpy
     bool uses_numpy;
     
+#ifdef SMILEI_USE_NUMPY
+    //! Expose the values of a Field as a numpy array of doubles (copied if the fields are in single precision)
+    inline PyArrayObject* asNumpy(Field* field, int ndim, npy_intp* dims) {
+        if( sizeof(fdouble) == sizeof(double) )
+            return (PyArrayObject*)PyArray_SimpleNewFromData(ndim, dims, NPY_DOUBLE, (double*)(field->data()));
+        PyArrayObject* a = (PyArrayObject*)PyArray_SimpleNew(ndim, dims, NPY_DOUBLE);
+        double* values = (double*) PyArray_DATA(a);
+        for( unsigned int i=0; i<field->globalDims_; i++)
+            values[i] = (*field)(i);
+        return a;
+    };
+#endif
+    
 };//END class Profile
 
 
@@ -4,7 +4,8 @@
 #include "Patch.h"
 
 Projector::Projector( Params &params, Patch *patch )
-    : inv_cell_volume( 1. / params.cell_volume )
+    : inv_cell_volume( 1. / params.cell_volume ),
+      reconstruct_old_positions( params.reconstruct_old_positions )
 {
 }
 
@@ -28,7 +28,7 @@ public:
     virtual void setMvWinLimits( unsigned int shift ) = 0;
     
     //! Project global current charge (EMfields->rho_ , J), for initialization and diags
-    virtual void basic( double               *rhoj, Particles &particles, unsigned int ipart, unsigned int type ) {};
+    virtual void basic( fdouble              *rhoj, Particles &particles, unsigned int ipart, unsigned int type ) {};
     virtual void basicForComplex( std::complex<double> *rhoj, Particles &particles, unsigned int ipart, unsigned int type, int imode ) {};
     
     //! Project global current densities if Ionization in Species::dynamics,
@@ -44,6 +44,16 @@ public:
     
 protected:
     double inv_cell_volume;
+    
+    //! If true, the former particle position is recomputed from the new position and momentum
+    bool reconstruct_old_positions;
+    
+    //! Former position of particle ipart along idim, in cell units, recomputed
+    //! as the pushers advanced it: x_old = x - dt*p*invgf
+    inline double reconstructOldPosition( Particles &particles, int idim, int ipart, double dt, double invgf, double d_inv )
+    {
+        return ( particles.position( idim, ipart ) - dt*particles.momentum( idim, ipart )*invgf ) * d_inv;
+    }
 };
 
 #endif
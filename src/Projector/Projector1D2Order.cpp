@@ -37,7 +37,7 @@ Projector1D2Order::~Projector1D2Order()
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project current densities : main projector
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector1D2Order::currents( double *Jx, double *Jy, double *Jz, Particles &particles, unsigned int ipart, double invgf, int *iold, double *delta )
+void Projector1D2Order::currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int ipart, double invgf, int *iold, double *delta )
 {
     // Declare local variables
     int ipo, ip;
@@ -108,7 +108,7 @@ void Projector1D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
 // ---------------------------------------------------------------------------------------------------------------------
 //!  Project current densities & charge : diagFields timstep
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector1D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz, double *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *delta )
+void Projector1D2Order::currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *delta )
 {
     // Declare local variables
     int ipo, ip;
@@ -182,7 +182,7 @@ void Projector1D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project charge : frozen & diagFields timstep
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector1D2Order::basic( double *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
+void Projector1D2Order::basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
 {
 
     //Warning : this function is used for frozen species or initialization only and doesn't use the standard scheme.
@@ -336,10 +336,10 @@ void Projector1D2Order::currentsAndDensityWrapper( ElectroMagn *EMfields, Partic
         }
         // Otherwise, the projection may apply to the species-specific arrays
     } else {
-        double *b_Jxs  = EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
-        double *b_Jys  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
-        double *b_Jzs  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
-        double *b_rhos = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
+        fdouble *b_Jxs  = EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
+        fdouble *b_Jys  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
+        fdouble *b_Jzs  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
+        fdouble *b_rhos = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
         for( int ipart=istart ; ipart<iend; ipart++ ) {
             currentsAndDensity( b_Jxs, b_Jys, b_Jzs, b_rhos, particles,  ipart, ( *invgf )[ipart], &( *iold )[ipart], &( *delta )[ipart] );
         }
@@ -350,7 +350,7 @@ void Projector1D2Order::currentsAndDensityWrapper( ElectroMagn *EMfields, Partic
 void Projector1D2Order::susceptibility( ElectroMagn *EMfields, Particles &particles, double species_mass, SmileiMPI *smpi, int istart, int iend,  int ithread, int icell, int ipart_ref )
 
 {
-    double *Chi_envelope = &( *EMfields->Env_Chi_ )( 0 );
+    fdouble *Chi_envelope = &( *EMfields->Env_Chi_ )( 0 );
     
     std::vector<double> *Epart       = &( smpi->dynamics_Epart[ithread] );
     std::vector<double> *Phipart     = &( smpi->dynamics_PHIpart[ithread] );
@@ -0,0 +1,37 @@
+#ifndef PROJECTOR1D2ORDERV_H
+#define PROJECTOR1D2ORDERV_H
+
+#include "Projector1D.h"
+
+
+class Projector1D2OrderV : public Projector1D
+{
+public:
+    Projector1D2OrderV( Params &, Patch *patch );
+    ~Projector1D2OrderV();
+    
+    //! Project global current densities (EMfields->Jx_/Jy_/Jz_)
+    inline void currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref = 0 );
+    //! Project global current densities (EMfields->Jx_/Jy_/Jz_/rho), diagFields timestep
+    inline void currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold );
+    
+    //! Project global current charge (EMfields->rho_), frozen & diagFields timestep
+    void basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int type ) override final;
+    
+    //! Project global current densities if Ionization in Species::dynamics,
+    void ionizationCurrents( Field *Jx, Field *Jy, Field *Jz, Particles &particles, int ipart, LocalFields Jion ) override final;
+    
+    //!Wrapper
+    void currentsAndDensityWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int icell, int ipart_ref ) override final;
+    
+    // Project susceptibility
+    void susceptibility( ElectroMagn *EMfields, Particles &particles, double species_mass, SmileiMPI *smpi, int istart, int iend,  int ithread, int icell, int ipart_ref ) override final;
+    
+private:
+    double dx_ov_dt;
+    //! Number of ghost cells along x (the cell index of a bin is shifted by it on the grid)
+    int oversize;
+};
+
+#endif
+
@@ -36,7 +36,7 @@ Projector1D4Order::~Projector1D4Order()
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project current densities : main projector
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector1D4Order::currents( double *Jx, double *Jy, double *Jz, Particles &particles, unsigned int ipart, double invgf, int *iold, double *delta )
+void Projector1D4Order::currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int ipart, double invgf, int *iold, double *delta )
 {
     // Declare local variables
     int ipo, ip;
@@ -118,7 +118,7 @@ void Projector1D4Order::currents( double *Jx, double *Jy, double *Jz, Particles
 // ---------------------------------------------------------------------------------------------------------------------
 //!  Project current densities & charge : diagFields timstep
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector1D4Order::currentsAndDensity( double *Jx, double *Jy, double *Jz, double *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *delta )
+void Projector1D4Order::currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *delta )
 {
     // Declare local variables
     int ipo, ip;
@@ -201,7 +201,7 @@ void Projector1D4Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project charge : frozen & diagFields timstep
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector1D4Order::basic( double *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
+void Projector1D4Order::basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
 {
 
     //Warning : this function is used for frozen species or initialization only and doesn't use the standard scheme.
@@ -300,10 +300,10 @@ void Projector1D4Order::currentsAndDensityWrapper( ElectroMagn *EMfields, Partic
         }
         // Otherwise, the projection may apply to the species-specific arrays
     } else {
-        double *b_Jx  = EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
-        double *b_Jy  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
-        double *b_Jz  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
-        double *b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
+        fdouble *b_Jx  = EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
+        fdouble *b_Jy  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
+        fdouble *b_Jz  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
+        fdouble *b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
         for( int ipart=istart ; ipart<iend; ipart++ ) {
             currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  ipart, ( *invgf )[ipart], &( *iold )[ipart], &( *delta )[ipart] );
         }
@@ -10,12 +10,12 @@ public:
     ~Projector1D4Order();
     
     //! Project global current densities (EMfields->Jx_/Jy_/Jz_)
-    inline void currents( double *Jx, double *Jy, double *Jz, Particles &particles, unsigned int ipart, double invgf, int *iold, double *delta );
+    inline void currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int ipart, double invgf, int *iold, double *delta );
     //! Project global current densities (EMfields->Jx_/Jy_/Jz_/rho), diagFields timestep
-    inline void currentsAndDensity( double *Jx, double *Jy, double *Jz, double *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *delta );
+    inline void currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *delta );
     
     //! Project global current charge (EMfields->rho_ , J), for initialization and diags
-    void basic( double *rhoj, Particles &particles, unsigned int ipart, unsigned int type ) override final;
+    void basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int type ) override final;
     
     //! Project global current densities if Ionization in Species::dynamics,
     void ionizationCurrents( Field *Jx, Field *Jy, Field *Jz, Particles &particles, int ipart, LocalFields Jion ) override final;
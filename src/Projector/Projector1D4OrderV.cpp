@@ -0,0 +1,353 @@
+#include "Projector1D4OrderV.h"
+
+#include <cmath>
+#include <iostream>
+
+#include "ElectroMagn.h"
+#include "Field1D.h"
+#include "Particles.h"
+#include "Tools.h"
+#include "Patch.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for Projector1D4OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Projector1D4OrderV::Projector1D4OrderV( Params &params, Patch *patch ) : Projector1D( params, patch )
+{
+    dx_inv_  = 1.0/params.cell_length[0];
+    dx_ov_dt = params.cell_length[0] / params.timestep;
+    
+    index_domain_begin = patch->getCellStartingGlobalIndex( 0 );
+    
+    oversize = params.oversize[0];
+    
+    DEBUG( "cell_length "<< params.cell_length[0] );
+    
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor for Projector1D4OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Projector1D4OrderV::~Projector1D4OrderV()
+{
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project current densities : main projector vectorized
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector1D4OrderV::currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref )
+{
+    // -------------------------------------
+    // Variable declaration & initialization
+    // -------------------------------------
+    
+    int ipo = iold[0];
+    int ipom3 = ipo-3;
+    
+    int vecSize = 8;
+    int bsize = 7*vecSize;
+    
+    double bJx[bsize] __attribute__( ( aligned( 64 ) ) );
+    double bJy[bsize] __attribute__( ( aligned( 64 ) ) );
+    double bJz[bsize] __attribute__( ( aligned( 64 ) ) );
+    
+    double S0_buff_vect[56] __attribute__( ( aligned( 64 ) ) );
+    double S1_buff_vect[56] __attribute__( ( aligned( 64 ) ) );
+    double charge_weight[8] __attribute__( ( aligned( 64 ) ) );
+    double cry_p[8] __attribute__( ( aligned( 64 ) ) );
+    double crz_p[8] __attribute__( ( aligned( 64 ) ) );
+    
+    #pragma omp simd
+    for( int j=0; j<bsize; j++ ) {
+        bJx[j] = 0.;
+        bJy[j] = 0.;
+        bJz[j] = 0.;
+    }
+    
+    int cell_nparts( ( int )iend-( int )istart );
+    
+    for( int ivect=0 ; ivect < cell_nparts; ivect += vecSize ) {
+        
+        int np_computed = min( cell_nparts-ivect, vecSize );
+        
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            
+            // locate the particle on the primal grid at former time-step & calculate coeff. S0
+            double delta = deltaold[ivect+ipart-ipart_ref+istart];
+            double delta2 = delta*delta;
+            double delta3 = delta2*delta;
+            double delta4 = delta3*delta;
+            
+            S0_buff_vect[          ipart] = 0.;
+            S0_buff_vect[  vecSize+ipart] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+            S0_buff_vect[2*vecSize+ipart] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            S0_buff_vect[3*vecSize+ipart] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4  * delta4;
+            S0_buff_vect[4*vecSize+ipart] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            S0_buff_vect[5*vecSize+ipart] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+            S0_buff_vect[6*vecSize+ipart] = 0.;
+            
+            // locate the particle on the primal grid at current time-step & calculate coeff. S1
+            double pos = particles.position( 0, ivect+ipart+istart ) * dx_inv_;
+            int cell = round( pos );
+            int cell_shift = cell-ipo-index_domain_begin;
+            delta  = pos - ( double )cell;
+            delta2 = delta*delta;
+            delta3 = delta2*delta;
+            delta4 = delta3*delta;
+            double S0 = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+            double S1 = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            double S2 = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4  * delta4;
+            double S3 = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            double S4 = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+            double m1 = ( cell_shift == -1 );
+            double c0 = ( cell_shift ==  0 );
+            double p1 = ( cell_shift ==  1 );
+            S1_buff_vect[          ipart] = m1 * S0                                    ;
+            S1_buff_vect[  vecSize+ipart] = c0 * S0 + m1 * S1                          ;
+            S1_buff_vect[2*vecSize+ipart] = p1 * S0 + c0 * S1 + m1* S2                 ;
+            S1_buff_vect[3*vecSize+ipart] =           p1 * S1 + c0* S2 + m1 * S3       ;
+            S1_buff_vect[4*vecSize+ipart] =                     p1* S2 + c0 * S3 + m1 * S4;
+            S1_buff_vect[5*vecSize+ipart] =                              p1 * S3 + c0 * S4;
+            S1_buff_vect[6*vecSize+ipart] =                                        p1 * S4;
+            
+            charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( ivect+istart+ipart ) )*particles.weight( ivect+istart+ipart );
+            cry_p[ipart] = charge_weight[ipart]*particles.momentum( 1, ivect+istart+ipart )*( *invgf )[ivect+istart+ipart-ipart_ref];
+            crz_p[ipart] = charge_weight[ipart]*particles.momentum( 2, ivect+istart+ipart )*( *invgf )[ivect+istart+ipart-ipart_ref];
+        }
+        
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            double crx_p = charge_weight[ipart]*dx_ov_dt;
+            
+            // Jx from the charge conservation equation, Jy and Jz with the time-centered shape
+            double sum = 0.;
+            for( unsigned int i=0 ; i<7 ; i++ ) {
+                bJx[i*vecSize+ipart] += sum;
+                sum += crx_p * ( S0_buff_vect[i*vecSize+ipart] - S1_buff_vect[i*vecSize+ipart] );
+                double Wt = 0.5 * ( S0_buff_vect[i*vecSize+ipart] + S1_buff_vect[i*vecSize+ipart] );
+                bJy[i*vecSize+ipart] += cry_p[ipart] * Wt;
+                bJz[i*vecSize+ipart] += crz_p[ipart] * Wt;
+            }
+        }
+        
+    }
+    
+    for( unsigned int i=0 ; i<7 ; i++ ) {
+        double tmpJx( 0. ), tmpJy( 0. ), tmpJz( 0. );
+        #pragma omp simd reduction(+:tmpJx,tmpJy,tmpJz)
+        for( int ipart=0 ; ipart<8; ipart++ ) {
+            tmpJx += bJx[i*vecSize+ipart];
+            tmpJy += bJy[i*vecSize+ipart];
+            tmpJz += bJz[i*vecSize+ipart];
+        }
+        Jx[ipom3+i] += tmpJx;
+        Jy[ipom3+i] += tmpJy;
+        Jz[ipom3+i] += tmpJz;
+    }
+    
+} // END Project vectorized
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//!  Project current densities & charge : diagFields timstep (not vectorized)
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector1D4OrderV::currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold )
+{
+    // Declare local variables
+    int ipo, ip;
+    int ip_m_ipo;
+    double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
+    double xjn, xj_m_xipo, xj_m_xipo2, xj_m_xipo3, xj_m_xipo4, xj_m_xip, xj_m_xip2, xj_m_xip3, xj_m_xip4;
+    double crx_p = charge_weight*dx_ov_dt;                // current density for particle moving in the x-direction
+    double cry_p = charge_weight*particles.momentum( 1, ipart )*invgf;  // current density in the y-direction of the macroparticle
+    double crz_p = charge_weight*particles.momentum( 2, ipart )*invgf;  // current density allow the y-direction of the macroparticle
+    double S0[7], S1[7], Wl[7], Wt[7], Jx_p[7];            // arrays used for the Esirkepov projection method
+    // Initialize variables
+    for( unsigned int i=0; i<7; i++ ) {
+        S0[i]=0.;
+        S1[i]=0.;
+        Wl[i]=0.;
+        Wt[i]=0.;
+        Jx_p[i]=0.;
+    }//i
+    
+    // Locate particle old position on the primal grid
+    xj_m_xipo  = *deltaold;                        // normalized distance to the nearest grid point
+    xj_m_xipo2 = xj_m_xipo  * xj_m_xipo;           // square of the normalized distance to the nearest grid point
+    xj_m_xipo3 = xj_m_xipo2 * xj_m_xipo;           // cube of the normalized distance to the nearest grid point
+    xj_m_xipo4 = xj_m_xipo3 * xj_m_xipo;           // 4th power of the normalized distance to the nearest grid point
+    
+    // Locate particle new position on the primal grid
+    xjn       = particles.position( 0, ipart ) * dx_inv_;
+    ip        = round( xjn );                      // index of the central node
+    xj_m_xip  = xjn - ( double )ip;                // normalized distance to the nearest grid point
+    xj_m_xip2 = xj_m_xip  * xj_m_xip;              // square of the normalized distance to the nearest grid point
+    xj_m_xip3 = xj_m_xip2 * xj_m_xip;              // cube of the normalized distance to the nearest grid point
+    xj_m_xip4 = xj_m_xip3 * xj_m_xip;              // 4th power of the normalized distance to the nearest grid point
+    
+    // coefficients 4th order interpolation on 5 nodes
+    S0[1] = dble_1_ov_384   - dble_1_ov_48  * xj_m_xipo  + dble_1_ov_16 * xj_m_xipo2 - dble_1_ov_12 * xj_m_xipo3 + dble_1_ov_24 * xj_m_xipo4;
+    S0[2] = dble_19_ov_96   - dble_11_ov_24 * xj_m_xipo  + dble_1_ov_4 * xj_m_xipo2  + dble_1_ov_6  * xj_m_xipo3 - dble_1_ov_6  * xj_m_xipo4;
+    S0[3] = dble_115_ov_192 - dble_5_ov_8   * xj_m_xipo2 + dble_1_ov_4 * xj_m_xipo4;
+    S0[4] = dble_19_ov_96   + dble_11_ov_24 * xj_m_xipo  + dble_1_ov_4 * xj_m_xipo2  - dble_1_ov_6  * xj_m_xipo3 - dble_1_ov_6  * xj_m_xipo4;
+    S0[5] = dble_1_ov_384   + dble_1_ov_48  * xj_m_xipo  + dble_1_ov_16 * xj_m_xipo2 + dble_1_ov_12 * xj_m_xipo3 + dble_1_ov_24 * xj_m_xipo4;
+    
+    // coefficients 4th order interpolation on 5 nodes
+    ipo      = *iold;                               // index of the central node
+    ip_m_ipo = ip-ipo-index_domain_begin;
+    
+    S1[ip_m_ipo+1] = dble_1_ov_384   - dble_1_ov_48  * xj_m_xip  + dble_1_ov_16 * xj_m_xip2 - dble_1_ov_12 * xj_m_xip3 + dble_1_ov_24 * xj_m_xip4;
+    S1[ip_m_ipo+2] = dble_19_ov_96   - dble_11_ov_24 * xj_m_xip  + dble_1_ov_4 * xj_m_xip2  + dble_1_ov_6  * xj_m_xip3 - dble_1_ov_6  * xj_m_xip4;
+    S1[ip_m_ipo+3] = dble_115_ov_192 - dble_5_ov_8   * xj_m_xip2 + dble_1_ov_4 * xj_m_xip4;
+    S1[ip_m_ipo+4] = dble_19_ov_96   + dble_11_ov_24 * xj_m_xip  + dble_1_ov_4 * xj_m_xip2  - dble_1_ov_6  * xj_m_xip3 - dble_1_ov_6  * xj_m_xip4;
+    S1[ip_m_ipo+5] = dble_1_ov_384   + dble_1_ov_48  * xj_m_xip  + dble_1_ov_16 * xj_m_xip2 + dble_1_ov_12 * xj_m_xip3 + dble_1_ov_24 * xj_m_xip4;
+    
+    // coefficients used in the Esirkepov method
+    for( unsigned int i=0; i<7; i++ ) {
+        Wl[i] = S0[i] - S1[i];           // for longitudinal current (x)
+        Wt[i] = 0.5 * ( S0[i] + S1[i] ); // for transverse currents (y,z)
+    }//i
+    
+    // local current created by the particle
+    // calculate using the charge conservation equation
+    for( unsigned int i=1; i<7; i++ ) {
+        Jx_p[i] = Jx_p[i-1] + crx_p * Wl[i-1];
+    }
+    
+    ipo -= 3;
+    
+    // 4th order projection for the total currents & charge density
+    // At the 4th order, oversize = 3.
+    for( unsigned int i=0; i<7; i++ ) {
+        Jx[i  + ipo ]  += Jx_p[i];
+        Jy[i  + ipo ]  += cry_p * Wt[i];
+        Jz[i  + ipo ]  += crz_p * Wt[i];
+        rho[i  + ipo ] += charge_weight * S1[i];
+    }//i
+    
+} // END Project local current densities at dag timestep.
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project charge : frozen & diagFields timstep (not vectorized)
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector1D4OrderV::basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
+{
+    
+    //Warning : this function is used for frozen species or initialization only and doesn't use the standard scheme.
+    //rho type = 0
+    //Jx type = 1
+    //Jy type = 2
+    //Jz type = 3
+    
+    // Declare local variables
+    int ip;
+    double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
+    double xjn, xj_m_xip, xj_m_xip2, xj_m_xip3, xj_m_xip4;
+    double S1[7];            // arrays used for the Esirkepov projection method
+    // Initialize variables
+    for( unsigned int i=0; i<7; i++ ) {
+        S1[i]=0.;
+    }//i
+    
+    if( type > 0 ) {
+        charge_weight *= 1./sqrt( 1.0 + particles.momentum( 0, ipart )*particles.momentum( 0, ipart )
+                                  + particles.momentum( 1, ipart )*particles.momentum( 1, ipart )
+                                  + particles.momentum( 2, ipart )*particles.momentum( 2, ipart ) );
+        
+        if( type == 1 ) {
+            charge_weight *= particles.momentum( 0, ipart );
+        } else if( type == 2 ) {
+            charge_weight *= particles.momentum( 1, ipart );
+        } else {
+            charge_weight *= particles.momentum( 2, ipart );
+        }
+    }
+    
+    // Locate particle new position on the primal grid
+    xjn       = particles.position( 0, ipart ) * dx_inv_;
+    ip        = round( xjn + 0.5 * ( type==1 ) );  // index of the central node
+    xj_m_xip  = xjn - ( double )ip;                // normalized distance to the nearest grid point
+    xj_m_xip2 = xj_m_xip  * xj_m_xip;              // square of the normalized distance to the nearest grid point
+    xj_m_xip3 = xj_m_xip2 * xj_m_xip;              // cube of the normalized distance to the nearest grid point
+    xj_m_xip4 = xj_m_xip3 * xj_m_xip;              // 4th power of the normalized distance to the nearest grid point
+    
+    // coefficients 4th order interpolation on 5 nodes
+    S1[1] = dble_1_ov_384   - dble_1_ov_48  * xj_m_xip  + dble_1_ov_16 * xj_m_xip2 - dble_1_ov_12 * xj_m_xip3 + dble_1_ov_24 * xj_m_xip4;
+    S1[2] = dble_19_ov_96   - dble_11_ov_24 * xj_m_xip  + dble_1_ov_4 * xj_m_xip2  + dble_1_ov_6  * xj_m_xip3 - dble_1_ov_6  * xj_m_xip4;
+    S1[3] = dble_115_ov_192 - dble_5_ov_8   * xj_m_xip2 + dble_1_ov_4 * xj_m_xip4;
+    S1[4] = dble_19_ov_96   + dble_11_ov_24 * xj_m_xip  + dble_1_ov_4 * xj_m_xip2  - dble_1_ov_6  * xj_m_xip3 - dble_1_ov_6  * xj_m_xip4;
+    S1[5] = dble_1_ov_384   + dble_1_ov_48  * xj_m_xip  + dble_1_ov_16 * xj_m_xip2 + dble_1_ov_12 * xj_m_xip3 + dble_1_ov_24 * xj_m_xip4;
+    
+    ip -= index_domain_begin + 3 ;
+    
+    // 4th order projection for the charge density
+    // At the 4th order, oversize = 3.
+    for( unsigned int i=0; i<7; i++ ) {
+        rhoj[i  + ip ] += charge_weight * S1[i];
+    }//i
+    
+} // END Project local current densities (sort)
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project global current densities : ionization
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector1D4OrderV::ionizationCurrents( Field *Jx, Field *Jy, Field *Jz, Particles &particles, int ipart, LocalFields Jion )
+{
+    WARNING( "Projection of ionization current not yet defined for 1D 4th order" );
+    
+} // END Project global current densities (ionize)
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Wrapper for projection
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector1D4OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int scell, int ipart_ref )
+{
+    if( istart == iend ) {
+        return;    //Don't treat empty cells.
+    }
+    
+    double *deltaold = smpi->dynamics_deltaold[ithread].data();
+    std::vector<double> *invgf = &( smpi->dynamics_invgf[ithread] );
+    
+    // Primal index of the cell, on the grid of the patch
+    int iold[1];
+    iold[0] = scell+oversize;
+    
+    // If no field diagnostics this timestep, then the projection is done directly on the total arrays
+    if( !diag_flag ) {
+        if( !is_spectral ) {
+            fdouble *b_Jx =  &( *EMfields->Jx_ )( 0 );
+            fdouble *b_Jy =  &( *EMfields->Jy_ )( 0 );
+            fdouble *b_Jz =  &( *EMfields->Jz_ )( 0 );
+            currents( b_Jx, b_Jy, b_Jz, particles,  istart, iend, invgf, iold, deltaold, ipart_ref );
+        } else {
+            ERROR( "TO DO with rho" );
+        }
+        
+        // Otherwise, the projection may apply to the species-specific arrays
+    } else {
+        fdouble *b_Jx  = EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
+        fdouble *b_Jy  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
+        fdouble *b_Jz  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
+        fdouble *b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
+        for( int ipart=istart ; ipart<iend; ipart++ ) {
+            currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  ipart, ( *invgf )[ipart-ipart_ref], iold, &deltaold[ipart-ipart_ref] );
+        }
+    }
+}
+
+
+// Project susceptibility
+void Projector1D4OrderV::susceptibility( ElectroMagn *EMfields, Particles &particles, double species_mass, SmileiMPI *smpi, int istart, int iend,  int ithread, int icell, int ipart_ref )
+{
+    ERROR( "Projection and interpolation for the envelope model are implemented only for interpolation_order = 2" );
+}
@@ -37,7 +37,7 @@ protected:
     int nprimy, nscelly;
     int oversize[2];
     double dq_inv[2];
-    double *Jx_, *Jy_, *Jz_, *rho_;
+    fdouble *Jx_, *Jy_, *Jz_, *rho_;
     static constexpr double one_third = 1./3.;
 };
 
@@ -45,10 +45,8 @@ Projector2D2Order::~Projector2D2Order()
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project current densities : main projector
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D2Order::currents( double *Jx, double *Jy, double *Jz, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold )
+void Projector2D2Order::currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold )
 {
-    int nparts = particles.size();
-    
     // -------------------------------------
     // Variable declaration & initialization
     // -------------------------------------
@@ -82,13 +80,13 @@ void Projector2D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
     // --------------------------------------------------------
     
     // locate the particle on the primal grid at former time-step & calculate coeff. S0
-    delta = deltaold[0*nparts];
+    delta = deltaold[0];
     delta2 = delta*delta;
     Sx0[1] = 0.5 * ( delta2-delta+0.25 );
     Sx0[2] = 0.75-delta2;
     Sx0[3] = 0.5 * ( delta2+delta+0.25 );
     
-    delta = deltaold[1*nparts];
+    delta = deltaold[1];
     delta2 = delta*delta;
     Sy0[1] = 0.5 * ( delta2-delta+0.25 );
     Sy0[2] = 0.75-delta2;
@@ -98,7 +96,7 @@ void Projector2D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
     // locate the particle on the primal grid at current time-step & calculate coeff. S1
     xpn = particles.position( 0, ipart ) * dx_inv_;
     int ip = round( xpn );
-    int ipo = iold[0*nparts];
+    int ipo = iold[0];
     int ip_m_ipo = ip-ipo-i_domain_begin;
     delta  = xpn - ( double )ip;
     delta2 = delta*delta;
@@ -108,7 +106,7 @@ void Projector2D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
     
     ypn = particles.position( 1, ipart ) * dy_inv_;
     int jp = round( ypn );
-    int jpo = iold[1*nparts];
+    int jpo = iold[1];
     int jp_m_jpo = jp-jpo-j_domain_begin;
     delta  = ypn - ( double )jp;
     delta2 = delta*delta;
@@ -172,10 +170,8 @@ void Projector2D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
 // ---------------------------------------------------------------------------------------------------------------------
 //!  Project current densities & charge : diagFields timstep
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz, double *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold )
+void Projector2D2Order::currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold )
 {
-    int nparts = particles.size();
-    
     // -------------------------------------
     // Variable declaration & initialization
     // -------------------------------------
@@ -210,13 +206,13 @@ void Projector2D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
     // --------------------------------------------------------
     
     // locate the particle on the primal grid at former time-step & calculate coeff. S0
-    delta = deltaold[0*nparts];
+    delta = deltaold[0];
     delta2 = delta*delta;
     Sx0[1] = 0.5 * ( delta2-delta+0.25 );
     Sx0[2] = 0.75-delta2;
     Sx0[3] = 0.5 * ( delta2+delta+0.25 );
     
-    delta = deltaold[1*nparts];
+    delta = deltaold[1];
     delta2 = delta*delta;
     Sy0[1] = 0.5 * ( delta2-delta+0.25 );
     Sy0[2] = 0.75-delta2;
@@ -226,7 +222,7 @@ void Projector2D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
     // locate the particle on the primal grid at current time-step & calculate coeff. S1
     xpn = particles.position( 0, ipart ) * dx_inv_;
     int ip = round( xpn );
-    int ipo = iold[0*nparts];
+    int ipo = iold[0];
     int ip_m_ipo = ip-ipo-i_domain_begin;
     delta  = xpn - ( double )ip;
     delta2 = delta*delta;
@@ -236,7 +232,7 @@ void Projector2D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
     
     ypn = particles.position( 1, ipart ) * dy_inv_;
     int jp = round( ypn );
-    int jpo = iold[1*nparts];
+    int jpo = iold[1];
     int jp_m_jpo = jp-jpo-j_domain_begin;
     delta  = ypn - ( double )jp;
     delta2 = delta*delta;
@@ -307,7 +303,7 @@ void Projector2D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project charge : frozen & diagFields timstep
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D2Order::basic( double *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
+void Projector2D2Order::basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
 {
     //Warning : this function is used for frozen species only. It is assumed that position = position_old !!!
     
@@ -467,14 +463,39 @@ void Projector2D2Order::ionizationCurrents( Field *Jx, Field *Jy, Field *Jz, Par
 } // END Project global current densities (ionize)
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! Former cell index and distance to the primal node of particle ipart
+// ---------------------------------------------------------------------------------------------------------------------
+inline void Projector2D2Order::oldPosition( Particles &particles, int ipart, double invgf, int *iold_buffer, double *delta_buffer, int *iold, double *deltaold )
+{
+    if( reconstruct_old_positions ) {
+        double d_inv[2] = { dx_inv_, dy_inv_ };
+        int domain_begin[2] = { i_domain_begin, j_domain_begin };
+        for( unsigned int i=0; i<2; i++ ) {
+            double pos = reconstructOldPosition( particles, i, ipart, dt, invgf, d_inv[i] );
+            int ip = round( pos );
+            iold[i]     = ip - domain_begin[i];
+            deltaold[i] = pos - ( double )ip;
+        }
+    } else {
+        int nparts = particles.size();
+        for( unsigned int i=0; i<2; i++ ) {
+            iold[i]     = iold_buffer [ipart+i*nparts];
+            deltaold[i] = delta_buffer[ipart+i*nparts];
+        }
+    }
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 //! Wrapper for projection
 // ---------------------------------------------------------------------------------------------------------------------
 void Projector2D2Order::currentsAndDensityWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int icell, int ipart_ref )
 {
-    std::vector<int> *iold = &( smpi->dynamics_iold[ithread] );
-    std::vector<double> *delta = &( smpi->dynamics_deltaold[ithread] );
+    int    *iold_buffer  = reconstruct_old_positions ? NULL : smpi->dynamics_iold[ithread].data();
+    double *delta_buffer = reconstruct_old_positions ? NULL : smpi->dynamics_deltaold[ithread].data();
     std::vector<double> *invgf = &( smpi->dynamics_invgf[ithread] );
+    int iold[2];
+    double deltaold[2];
     Jx_  =  &( *EMfields->Jx_ )( 0 );
     Jy_  =  &( *EMfields->Jy_ )( 0 );
     Jz_  =  &( *EMfields->Jz_ )( 0 );
@@ -484,21 +505,24 @@ void Projector2D2Order::currentsAndDensityWrapper( ElectroMagn *EMfields, Partic
     if( !diag_flag ) {
         if( !is_spectral ) {
             for( int ipart=istart ; ipart<iend; ipart++ ) {
-                currents( Jx_, Jy_, Jz_, particles,  ipart, ( *invgf )[ipart], &( *iold )[ipart], &( *delta )[ipart] );
+                oldPosition( particles, ipart, ( *invgf )[ipart], iold_buffer, delta_buffer, iold, deltaold );
+                currents( Jx_, Jy_, Jz_, particles,  ipart, ( *invgf )[ipart], iold, deltaold );
             }
         } else {
             for( int ipart=istart ; ipart<iend; ipart++ ) {
-                currentsAndDensity( Jx_, Jy_, Jz_, rho_, particles,  ipart, ( *invgf )[ipart], &( *iold )[ipart], &( *delta )[ipart] );
+                oldPosition( particles, ipart, ( *invgf )[ipart], iold_buffer, delta_buffer, iold, deltaold );
+                currentsAndDensity( Jx_, Jy_, Jz_, rho_, particles,  ipart, ( *invgf )[ipart], iold, deltaold );
             }
         }
         // Otherwise, the projection may apply to the species-specific arrays
     } else {
-        double *b_Jx  = EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
-        double *b_Jy  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
-        double *b_Jz  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
-        double *b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
+        fdouble *b_Jx  = EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
+        fdouble *b_Jy  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
+        fdouble *b_Jz  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
+        fdouble *b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
         for( int ipart=istart ; ipart<iend; ipart++ ) {
-            currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  ipart, ( *invgf )[ipart], &( *iold )[ipart], &( *delta )[ipart] );
+            oldPosition( particles, ipart, ( *invgf )[ipart], iold_buffer, delta_buffer, iold, deltaold );
+            currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  ipart, ( *invgf )[ipart], iold, deltaold );
         }
     }
 }
@@ -507,7 +531,7 @@ void Projector2D2Order::currentsAndDensityWrapper( ElectroMagn *EMfields, Partic
 void Projector2D2Order::susceptibility( ElectroMagn *EMfields, Particles &particles, double species_mass, SmileiMPI *smpi, int istart, int iend,  int ithread, int icell, int ipart_ref )
 
 {
-    double *Chi_envelope = &( *EMfields->Env_Chi_ )( 0 );
+    fdouble *Chi_envelope = &( *EMfields->Env_Chi_ )( 0 );
     
     std::vector<double> *Epart       = &( smpi->dynamics_Epart[ithread] );
     std::vector<double> *Phipart     = &( smpi->dynamics_PHIpart[ithread] );
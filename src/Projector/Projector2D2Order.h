@@ -11,12 +11,12 @@ public:
     ~Projector2D2Order();
     
     //! Project global current densities (EMfields->Jx_/Jy_/Jz_)
-    inline void currents( double *Jx, double *Jy, double *Jz, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold );
+    inline void currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold );
     //! Project global current densities (EMfields->Jx_/Jy_/Jz_/rho), diagFields timestep
-    inline void currentsAndDensity( double *Jx, double *Jy, double *Jz, double *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold );
+    inline void currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold );
     
     //! Project global current charge (EMfields->rho_ , J), for initialization and diags
-    void basic( double *rhoj, Particles &particles, unsigned int ipart, unsigned int type ) override final;
+    void basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int type ) override final;
     
     //! Project global current densities if Ionization in Species::dynamics,
     void ionizationCurrents( Field *Jx, Field *Jy, Field *Jz, Particles &particles, int ipart, LocalFields Jion ) override final;
@@ -29,6 +29,10 @@ public:
     
 private:
     double dt, dts2, dts4;
+    
+    //! Former cell index and distance to the primal node (iold, deltaold) of particle ipart,
+    //! read from the interpolator buffers or reconstructed from the new position
+    inline void oldPosition( Particles &particles, int ipart, double invgf, int *iold_buffer, double *delta_buffer, int *iold, double *deltaold );
 };
 
 #endif
@@ -21,6 +21,7 @@ Projector2D2OrderV::Projector2D2OrderV( Params &params, Patch *patch ) : Project
     dx_ov_dt  = params.cell_length[0] / params.timestep;
     dy_inv_   = 1.0/params.cell_length[1];
     dy_ov_dt  = params.cell_length[1] / params.timestep;
+    dt        = params.timestep;
     
     i_domain_begin = patch->getCellStartingGlobalIndex( 0 );
     j_domain_begin = patch->getCellStartingGlobalIndex( 1 );
@@ -48,7 +49,7 @@ Projector2D2OrderV::~Projector2D2OrderV()
 // ---------------------------------------------------------------------------------------------------------------------
 //!  Project current densities & charge : diagFields timstep (not vectorized)
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D2OrderV::currentsAndDensity( double *Jx, double *Jy, double *Jz, double *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold, int nparts )
+void Projector2D2OrderV::currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold, int nparts )
 {
 
     // -------------------------------------
@@ -183,7 +184,7 @@ void Projector2D2OrderV::currentsAndDensity( double *Jx, double *Jy, double *Jz,
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project charge : frozen & diagFields timstep (not vectorized)
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D2OrderV::basic( double *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
+void Projector2D2OrderV::basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
 {
 
     // -------------------------------------
@@ -345,7 +346,7 @@ void Projector2D2OrderV::ionizationCurrents( Field *Jx, Field *Jy, Field *Jz, Pa
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project current densities : main projector vectorized
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref )
+void Projector2D2OrderV::currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref )
 {
     // -------------------------------------
     // Variable declaration & initialization
@@ -406,7 +407,11 @@ void Projector2D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles
             Sx1_buff_vect[4*vecSize+ipart] =                           p1*deltap;
             // locate the particle on the primal grid at former time-step & calculate coeff. S0
             //                            X                                 //
-            delta = deltaold[ivect+ipart-ipart_ref+istart];
+            if( reconstruct_old_positions ) {
+                delta = reconstructOldPosition( particles, 0, ivect+ipart+istart, dt, ( *invgf )[ivect+ipart-ipart_ref+istart], dx_inv_ ) - ( double )( ipo+i_domain_begin );
+            } else {
+                delta = deltaold[ivect+ipart-ipart_ref+istart];
+            }
             delta2 = delta*delta;
             Sx0_buff_vect[          ipart] = 0;
             Sx0_buff_vect[  vecSize+ipart] = 0.5 * ( delta2-delta+0.25 );
@@ -436,7 +441,11 @@ void Projector2D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles
             Sy1_buff_vect[3*vecSize+ipart] =               p1*delta2 + c0*deltap;
             Sy1_buff_vect[4*vecSize+ipart] =                           p1*deltap;
             //                            Y                                 //
-            delta = deltaold[ivect+ipart-ipart_ref+istart+npart_total];
+            if( reconstruct_old_positions ) {
+                delta = reconstructOldPosition( particles, 1, ivect+ipart+istart, dt, ( *invgf )[ivect+ipart-ipart_ref+istart], dy_inv_ ) - ( double )( jpo+j_domain_begin );
+            } else {
+                delta = deltaold[ivect+ipart-ipart_ref+istart+npart_total];
+            }
             delta2 = delta*delta;
             Sy0_buff_vect[          ipart] = 0;
             Sy0_buff_vect[  vecSize+ipart] = 0.5 * ( delta2-delta+0.25 );
@@ -525,7 +534,11 @@ void Projector2D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles
             Sx1_buff_vect[4*vecSize+ipart] =                           p1*deltap;
             // locate the particle on the primal grid at former time-step & calculate coeff. S0
             //                            X                                 //
-            delta = deltaold[ivect+ipart-ipart_ref+istart];
+            if( reconstruct_old_positions ) {
+                delta = reconstructOldPosition( particles, 0, ivect+ipart+istart, dt, ( *invgf )[ivect+ipart-ipart_ref+istart], dx_inv_ ) - ( double )( ipo+i_domain_begin );
+            } else {
+                delta = deltaold[ivect+ipart-ipart_ref+istart];
+            }
             delta2 = delta*delta;
             Sx0_buff_vect[          ipart] = 0;
             Sx0_buff_vect[  vecSize+ipart] = 0.5 * ( delta2-delta+0.25 );
@@ -555,7 +568,11 @@ void Projector2D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles
             Sy1_buff_vect[3*vecSize+ipart] =               p1*delta2 + c0*deltap;
             Sy1_buff_vect[4*vecSize+ipart] =                           p1*deltap;
             //                            Y                                 //
-            delta = deltaold[ivect+ipart-ipart_ref+istart+npart_total];
+            if( reconstruct_old_positions ) {
+                delta = reconstructOldPosition( particles, 1, ivect+ipart+istart, dt, ( *invgf )[ivect+ipart-ipart_ref+istart], dy_inv_ ) - ( double )( jpo+j_domain_begin );
+            } else {
+                delta = deltaold[ivect+ipart-ipart_ref+istart+npart_total];
+            }
             delta2 = delta*delta;
             Sy0_buff_vect[          ipart] = 0;
             Sy0_buff_vect[  vecSize+ipart] = 0.5 * ( delta2-delta+0.25 );
@@ -643,7 +660,11 @@ void Projector2D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles
             Sx1_buff_vect[4*vecSize+ipart] =                           p1*deltap;
             // locate the particle on the primal grid at former time-step & calculate coeff. S0
             //                            X                                 //
-            delta = deltaold[ivect+ipart-ipart_ref+istart];
+            if( reconstruct_old_positions ) {
+                delta = reconstructOldPosition( particles, 0, ivect+ipart+istart, dt, ( *invgf )[ivect+ipart-ipart_ref+istart], dx_inv_ ) - ( double )( ipo+i_domain_begin );
+            } else {
+                delta = deltaold[ivect+ipart-ipart_ref+istart];
+            }
             delta2 = delta*delta;
             Sx0_buff_vect[          ipart] = 0;
             Sx0_buff_vect[  vecSize+ipart] = 0.5 * ( delta2-delta+0.25 );
@@ -673,7 +694,11 @@ void Projector2D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles
             Sy1_buff_vect[3*vecSize+ipart] =               p1*delta2 + c0*deltap;
             Sy1_buff_vect[4*vecSize+ipart] =                           p1*deltap;
             //                            Y                                 //
-            delta = deltaold[ivect+ipart-ipart_ref+istart+npart_total];
+            if( reconstruct_old_positions ) {
+                delta = reconstructOldPosition( particles, 1, ivect+ipart+istart, dt, ( *invgf )[ivect+ipart-ipart_ref+istart], dy_inv_ ) - ( double )( jpo+j_domain_begin );
+            } else {
+                delta = deltaold[ivect+ipart-ipart_ref+istart+npart_total];
+            }
             delta2 = delta*delta;
             Sy0_buff_vect[          ipart] = 0;
             Sy0_buff_vect[  vecSize+ipart] = 0.5 * ( delta2-delta+0.25 );
@@ -687,7 +712,7 @@ void Projector2D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles
                 DSy[i*vecSize+ipart] = Sy1_buff_vect[ i*vecSize+ipart] - Sy0_buff_vect[ i*vecSize+ipart];
             }
             charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( ivect+istart+ipart ) )*particles.weight( ivect+istart+ipart );
-            crz_p[ipart] = charge_weight[ipart]*one_third*particles.momentum( 2, ivect+istart+ipart )*( *invgf )[ivect+istart+ipart];
+            crz_p[ipart] = charge_weight[ipart]*one_third*particles.momentum( 2, ivect+istart+ipart )*( *invgf )[ivect+istart+ipart-ipart_ref];
         }
         
         #pragma omp simd
@@ -743,7 +768,7 @@ void Projector2D2OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields, Parti
     
     //Independent of cell. Should not be here
     //{
-    std::vector<double> *delta = &( smpi->dynamics_deltaold[ithread] );
+    double *deltaold = reconstruct_old_positions ? NULL : smpi->dynamics_deltaold[ithread].data();
     std::vector<double> *invgf = &( smpi->dynamics_invgf[ithread] );
     //}
     int iold[2];
@@ -752,27 +777,30 @@ void Projector2D2OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields, Parti
     
     
     // If no field diagnostics this timestep, then the projection is done directly on the total arrays
-    if( !diag_flag ) {
-        if( !is_spectral ) {
-            double *b_Jx =  &( *EMfields->Jx_ )( 0 );
-            double *b_Jy =  &( *EMfields->Jy_ )( 0 );
-            double *b_Jz =  &( *EMfields->Jz_ )( 0 );
-            currents( b_Jx, b_Jy, b_Jz, particles,  istart, iend, invgf, iold, &( *delta )[0], ipart_ref );
-        } else {
-            ERROR( "TO DO with rho" );
-        }
+    if( !diag_flag && !is_spectral ) {
+        fdouble *b_Jx =  &( *EMfields->Jx_ )( 0 );
+        fdouble *b_Jy =  &( *EMfields->Jy_ )( 0 );
+        fdouble *b_Jz =  &( *EMfields->Jz_ )( 0 );
+        currents( b_Jx, b_Jy, b_Jz, particles,  istart, iend, invgf, iold, deltaold, ipart_ref );
         
-        // Otherwise, the projection may apply to the species-specific arrays
+        // Otherwise, the projection may apply to the species-specific arrays, and includes the charge density
     } else {
-        double *b_Jx  = EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )(0) : &( *EMfields->Jx_  )(0) ;
-        double *b_Jy  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )(0) : &( *EMfields->Jy_  )(0) ;
-        double *b_Jz  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )(0) : &( *EMfields->Jz_  )(0) ;
-        double *b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )(0) : &( *EMfields->rho_ )(0) ;
+        fdouble *b_Jx  = diag_flag && EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )(0) : &( *EMfields->Jx_  )(0) ;
+        fdouble *b_Jy  = diag_flag && EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )(0) : &( *EMfields->Jy_  )(0) ;
+        fdouble *b_Jz  = diag_flag && EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )(0) : &( *EMfields->Jz_  )(0) ;
+        fdouble *b_rho = diag_flag && EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )(0) : &( *EMfields->rho_ )(0) ;
         for( int ipart=istart ; ipart<iend; ipart++ ) {
             //Do not use cells sorting for now : f(ipart) for now, f(istart) laterfor now,
             //(*iold)[ipart       ] = round( particles.position(0, ipart)* dx_inv_ - dt*particles.momentum(0, ipart)*(*invgf)[ipart] * dx_inv_ ) - i_domain_begin ;
             //(*iold)[ipart+nparts] = round( particles.position(1, ipart)* dy_inv_ - dt*particles.momentum(1, ipart)*(*invgf)[ipart] * dy_inv_ ) - j_domain_begin ;
-            currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  ipart, ( *invgf )[ipart-ipart_ref], iold, &( *delta )[ipart-ipart_ref], invgf->size() );
+            if( reconstruct_old_positions ) {
+                double delta[2];
+                delta[0] = reconstructOldPosition( particles, 0, ipart, dt, ( *invgf )[ipart-ipart_ref], dx_inv_ ) - ( double )( iold[0]+i_domain_begin );
+                delta[1] = reconstructOldPosition( particles, 1, ipart, dt, ( *invgf )[ipart-ipart_ref], dy_inv_ ) - ( double )( iold[1]+j_domain_begin );
+                currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  ipart, ( *invgf )[ipart-ipart_ref], iold, delta, 1 );
+            } else {
+                currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  ipart, ( *invgf )[ipart-ipart_ref], iold, &deltaold[ipart-ipart_ref], invgf->size() );
+            }
         }
     }
 }
@@ -11,12 +11,12 @@ public:
     ~Projector2D2OrderV();
     
     //! Project global current densities (EMfields->Jx_/Jy_/Jz_)
-    void currents( double *Jx, double *Jy, double *Jz, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref = 0 );
+    void currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref = 0 );
     //! Project global current densities (EMfields->Jx_/Jy_/Jz_/rho), diagFields timestep
-    inline void currentsAndDensity( double *Jx, double *Jy, double *Jz, double *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold, int nparts_in_buf );
+    inline void currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold, int nparts_in_buf );
     
     //! Project global current charge (EMfields->rho_), frozen & diagFields timestep
-    void basic( double *rhoj, Particles &particles, unsigned int ipart, unsigned int bin ) override final;
+    void basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int bin ) override final;
     
     //! Project global current densities if Ionization in Species::dynamics,
     void ionizationCurrents( Field *Jx, Field *Jy, Field *Jz, Particles &particles, int ipart, LocalFields Jion ) override final;
@@ -28,6 +28,7 @@ public:
     void susceptibility( ElectroMagn *EMfields, Particles &particles, double species_mass, SmileiMPI *smpi, int istart, int iend,  int ithread, int icell, int ipart_ref) override final;
     
 private:
+    double dt;
 };
 
 #endif
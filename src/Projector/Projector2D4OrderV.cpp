@@ -0,0 +1,571 @@
+#include "Projector2D4OrderV.h"
+
+#include <cmath>
+#include <iostream>
+
+#include "ElectroMagn.h"
+#include "Field2D.h"
+#include "Particles.h"
+#include "Tools.h"
+#include "Patch.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for Projector2D4OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Projector2D4OrderV::Projector2D4OrderV( Params &params, Patch *patch ) : Projector2D( params, patch )
+{
+    dx_inv_   = 1.0/params.cell_length[0];
+    dx_ov_dt  = params.cell_length[0] / params.timestep;
+    dy_inv_   = 1.0/params.cell_length[1];
+    dy_ov_dt  = params.cell_length[1] / params.timestep;
+    
+    i_domain_begin = patch->getCellStartingGlobalIndex( 0 );
+    j_domain_begin = patch->getCellStartingGlobalIndex( 1 );
+    
+    nscelly = params.n_space[1] + 1;
+    oversize[0] = params.oversize[0];
+    oversize[1] = params.oversize[1];
+    nprimy = nscelly + 2*oversize[1];
+    dq_inv[0] = dx_inv_;
+    dq_inv[1] = dy_inv_;
+    
+    
+    DEBUG( "cell_length "<< params.cell_length[0] );
+    
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor for Projector2D4OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Projector2D4OrderV::~Projector2D4OrderV()
+{
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+//!  Project current densities & charge : diagFields timstep (not vectorized)
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector2D4OrderV::currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold, int nparts )
+{
+    // -------------------------------------
+    // Variable declaration & initialization
+    // -------------------------------------
+    
+    int iloc;
+    // (x,y,z) components of the current density for the macro-particle
+    double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
+    double crx_p = charge_weight*dx_ov_dt;
+    double cry_p = charge_weight*dy_ov_dt;
+    double crz_p = charge_weight*one_third*particles.momentum( 2, ipart )*invgf;
+    
+    // variable declaration
+    double xpn, ypn;
+    double delta, delta2, delta3, delta4;
+    // arrays used for the Esirkepov projection method
+    double  Sx0[7], Sx1[7], Sy0[7], Sy1[7], DSx[7], DSy[7], tmpJx[7];
+    
+    for( unsigned int i=0; i<7; i++ ) {
+        Sx1[i] = 0.;
+        Sy1[i] = 0.;
+        tmpJx[i] = 0.;
+    }
+    Sx0[0] = 0.;
+    Sx0[6] = 0.;
+    Sy0[0] = 0.;
+    Sy0[6] = 0.;
+    
+    // --------------------------------------------------------
+    // Locate particles & Calculate Esirkepov coef. S, DS and W
+    // --------------------------------------------------------
+    
+    // locate the particle on the primal grid at former time-step & calculate coeff. S0
+    delta = deltaold[0];
+    delta2 = delta*delta;
+    delta3 = delta2*delta;
+    delta4 = delta3*delta;
+    
+    Sx0[1] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    Sx0[2] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    Sx0[3] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4  * delta4;
+    Sx0[4] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    Sx0[5] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    
+    delta = deltaold[nparts];
+    delta2 = delta*delta;
+    delta3 = delta2*delta;
+    delta4 = delta3*delta;
+    
+    Sy0[1] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    Sy0[2] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    Sy0[3] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4  * delta4;
+    Sy0[4] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    Sy0[5] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    
+    
+    // locate the particle on the primal grid at current time-step & calculate coeff. S1
+    xpn = particles.position( 0, ipart ) * dx_inv_;
+    int ip = round( xpn );
+    int ipo = iold[0];
+    int ip_m_ipo = ip-ipo-i_domain_begin;
+    delta  = xpn - ( double )ip;
+    delta2 = delta*delta;
+    delta3 = delta2*delta;
+    delta4 = delta3*delta;
+    
+    Sx1[ip_m_ipo+1] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    Sx1[ip_m_ipo+2] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    Sx1[ip_m_ipo+3] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4  * delta4;
+    Sx1[ip_m_ipo+4] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    Sx1[ip_m_ipo+5] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    
+    ypn = particles.position( 1, ipart ) * dy_inv_;
+    int jp = round( ypn );
+    int jpo = iold[1];
+    int jp_m_jpo = jp-jpo-j_domain_begin;
+    delta  = ypn - ( double )jp;
+    delta2 = delta*delta;
+    delta3 = delta2*delta;
+    delta4 = delta3*delta;
+    
+    Sy1[jp_m_jpo+1] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    Sy1[jp_m_jpo+2] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    Sy1[jp_m_jpo+3] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4  * delta4;
+    Sy1[jp_m_jpo+4] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    Sy1[jp_m_jpo+5] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    
+    for( unsigned int i=0; i < 7; i++ ) {
+        DSx[i] = Sx1[i] - Sx0[i];
+        DSy[i] = Sy1[i] - Sy0[i];
+    }
+    
+    // calculate Esirkepov coeff. Wx, Wy, Wz when used
+    double tmp, tmp2, tmp3, tmpY;
+    //Do not compute useless weights.
+    // ------------------------------------------------
+    // Local current created by the particle
+    // calculate using the charge conservation equation
+    // ------------------------------------------------
+    
+    // ---------------------------
+    // Calculate the total current
+    // ---------------------------
+    ipo -= 3; //This minus 3 come from the order 4 scheme, based on a 7 points stencil from -3 to +3.
+    jpo -= 3;
+    // i =0
+    {
+        iloc = ipo*nprimy+jpo;
+        tmp2 = 0.5*Sx1[0];
+        tmp3 =     Sx1[0];
+        Jz[iloc]  += crz_p * ( Sy1[0]*tmp3 );
+        rho[iloc] += charge_weight * Sx1[0]*Sy1[0];
+        tmp = 0;
+        tmpY = Sx0[0] + 0.5*DSx[0];
+        for( unsigned int j=1 ; j<7 ; j++ ) {
+            tmp -= cry_p * DSy[j-1] * tmpY;
+            Jy[iloc+j+ipo]  += tmp; //Because size of Jy in Y is nprimy+1.
+            Jz[iloc+j]  += crz_p * ( Sy0[j]*tmp2 + Sy1[j]*tmp3 );
+            rho[iloc+j] += charge_weight * Sx1[0]*Sy1[j];
+        }
+    }//i
+    
+    for( unsigned int i=1 ; i<7 ; i++ ) {
+        iloc = ( i+ipo )*nprimy+jpo;
+        tmpJx[0] -= crx_p *  DSx[i-1] * ( 0.5*DSy[0] );
+        Jx[iloc]  += tmpJx[0];
+        tmp2 = 0.5*Sx1[i] + Sx0[i];
+        tmp3 = 0.5*Sx0[i] + Sx1[i];
+        Jz[iloc]  += crz_p * ( Sy1[0]*tmp3 );
+        rho[iloc] += charge_weight * Sx1[i]*Sy1[0];
+        tmp = 0;
+        tmpY = Sx0[i] + 0.5*DSx[i];
+        for( unsigned int j=1 ; j<7 ; j++ ) {
+            tmpJx[j] -= crx_p * DSx[i-1] * ( Sy0[j] + 0.5*DSy[j] );
+            Jx[iloc+j]  += tmpJx[j];
+            tmp -= cry_p * DSy[j-1] * tmpY;
+            Jy[iloc+j+i+ipo]  += tmp; //Because size of Jy in Y is nprimy+1.
+            Jz[iloc+j]  += crz_p * ( Sy0[j]*tmp2 + Sy1[j]*tmp3 );
+            rho[iloc+j] += charge_weight * Sx1[i]*Sy1[j];
+        }
+    }//i
+    
+    
+} // END Project local current densities at dag timestep.
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project charge : frozen & diagFields timstep (not vectorized)
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector2D4OrderV::basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
+{
+    //Warning : this function is used for frozen species or initialization only and doesn't use the standard scheme.
+    //rho type = 0
+    //Jx type = 1
+    //Jy type = 2
+    //Jz type = 3
+    
+    int iloc;
+    int ny( nprimy );
+    // (x,y,z) components of the current density for the macro-particle
+    double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
+    
+    if( type > 0 ) {
+        charge_weight *= 1./sqrt( 1.0 + particles.momentum( 0, ipart )*particles.momentum( 0, ipart )
+                                  + particles.momentum( 1, ipart )*particles.momentum( 1, ipart )
+                                  + particles.momentum( 2, ipart )*particles.momentum( 2, ipart ) );
+        
+        if( type == 1 ) {
+            charge_weight *= particles.momentum( 0, ipart );
+        } else if( type == 2 ) {
+            charge_weight *= particles.momentum( 1, ipart );
+            ny ++;
+        } else {
+            charge_weight *= particles.momentum( 2, ipart );
+        }
+    }
+    
+    // variable declaration
+    double xpn, ypn;
+    double delta, delta2, delta3, delta4;
+    // arrays used for the Esirkepov projection method
+    double  Sx1[7], Sy1[7];
+    
+    for( unsigned int i=0; i<7; i++ ) {
+        Sx1[i] = 0.;
+        Sy1[i] = 0.;
+    }
+    
+    // --------------------------------------------------------
+    // Locate particles & Calculate Esirkepov coef. S, DS and W
+    // --------------------------------------------------------
+    // locate the particle on the primal grid at current time-step & calculate coeff. S1
+    xpn = particles.position( 0, ipart ) * dx_inv_;
+    int ip        = round( xpn + 0.5 * ( type==1 ) );                       // index of the central node
+    delta  = xpn - ( double )ip;
+    delta2 = delta*delta;
+    delta3 = delta2*delta;
+    delta4 = delta3*delta;
+    
+    Sx1[1] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    Sx1[2] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    Sx1[3] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4  * delta4;
+    Sx1[4] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    Sx1[5] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    
+    ypn = particles.position( 1, ipart ) * dy_inv_;
+    int jp = round( ypn + 0.5*( type==2 ) );
+    delta  = ypn - ( double )jp;
+    delta2 = delta*delta;
+    delta3 = delta2*delta;
+    delta4 = delta3*delta;
+    
+    Sy1[1] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    Sy1[2] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    Sy1[3] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4  * delta4;
+    Sy1[4] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+    Sy1[5] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+    
+    // ---------------------------
+    // Calculate the total current
+    // ---------------------------
+    ip -= i_domain_begin + 3;
+    jp -= j_domain_begin + 3;
+    
+    for( unsigned int i=0 ; i<7 ; i++ ) {
+        iloc = ( i+ip )*ny+jp;
+        for( unsigned int j=0 ; j<7 ; j++ ) {
+            rhoj[iloc+j] += charge_weight * Sx1[i]*Sy1[j];
+        }
+    }//i
+} // END Project local current densities (sort)
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project global current densities : ionization
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector2D4OrderV::ionizationCurrents( Field *Jx, Field *Jy, Field *Jz, Particles &particles, int ipart, LocalFields Jion )
+{
+    ERROR( "Projection of ionization current not yet defined for 2D 4th order" );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project current densities : main projector vectorized
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector2D4OrderV::currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref )
+{
+    // -------------------------------------
+    // Variable declaration & initialization
+    // -------------------------------------
+    
+    int npart_total = invgf->size();
+    int ipo = iold[0];
+    int jpo = iold[1];
+    int ipom3 = ipo-3;
+    int jpom3 = jpo-3;
+    
+    int vecSize = 8;
+    int bsize = 7*7*vecSize;
+    
+    // The shape factors of a vector of particles are computed once and projected on the 3 components
+    double bJx[bsize] __attribute__( ( aligned( 64 ) ) );
+    double bJy[bsize] __attribute__( ( aligned( 64 ) ) );
+    double bJz[bsize] __attribute__( ( aligned( 64 ) ) );
+    
+    double Sx0_buff_vect[56] __attribute__( ( aligned( 64 ) ) );
+    double Sy0_buff_vect[56] __attribute__( ( aligned( 64 ) ) );
+    double Sx1_buff_vect[56] __attribute__( ( aligned( 64 ) ) );
+    double Sy1_buff_vect[56] __attribute__( ( aligned( 64 ) ) );
+    double DSx[56] __attribute__( ( aligned( 64 ) ) );
+    double DSy[56] __attribute__( ( aligned( 64 ) ) );
+    double charge_weight[8] __attribute__( ( aligned( 64 ) ) );
+    double crz_p[8] __attribute__( ( aligned( 64 ) ) );
+    
+    #pragma omp simd
+    for( int j=0; j<bsize; j++ ) {
+        bJx[j] = 0.;
+        bJy[j] = 0.;
+        bJz[j] = 0.;
+    }
+    
+    int cell_nparts( ( int )iend-( int )istart );
+    
+    for( int ivect=0 ; ivect < cell_nparts; ivect += vecSize ) {
+        
+        int np_computed = min( cell_nparts-ivect, vecSize );
+        
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            
+            // locate the particle on the primal grid at former time-step & calculate coeff. S0
+            //                            X                                 //
+            double delta = deltaold[ivect+ipart-ipart_ref+istart];
+            double delta2 = delta*delta;
+            double delta3 = delta2*delta;
+            double delta4 = delta3*delta;
+            
+            Sx0_buff_vect[          ipart] = 0.;
+            Sx0_buff_vect[  vecSize+ipart] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+            Sx0_buff_vect[2*vecSize+ipart] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            Sx0_buff_vect[3*vecSize+ipart] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4  * delta4;
+            Sx0_buff_vect[4*vecSize+ipart] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            Sx0_buff_vect[5*vecSize+ipart] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+            Sx0_buff_vect[6*vecSize+ipart] = 0.;
+            
+            //                            Y                                 //
+            delta = deltaold[ivect+ipart-ipart_ref+istart+npart_total];
+            delta2 = delta*delta;
+            delta3 = delta2*delta;
+            delta4 = delta3*delta;
+            
+            Sy0_buff_vect[          ipart] = 0.;
+            Sy0_buff_vect[  vecSize+ipart] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+            Sy0_buff_vect[2*vecSize+ipart] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            Sy0_buff_vect[3*vecSize+ipart] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4  * delta4;
+            Sy0_buff_vect[4*vecSize+ipart] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            Sy0_buff_vect[5*vecSize+ipart] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+            Sy0_buff_vect[6*vecSize+ipart] = 0.;
+            
+            // locate the particle on the primal grid at current time-step & calculate coeff. S1
+            //                            X                                 //
+            double pos = particles.position( 0, ivect+ipart+istart ) * dx_inv_;
+            int cell = round( pos );
+            int cell_shift = cell-ipo-i_domain_begin;
+            delta  = pos - ( double )cell;
+            delta2 = delta*delta;
+            delta3 = delta2*delta;
+            delta4 = delta3*delta;
+            double S0 = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+            double S1 = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            double S2 = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4  * delta4;
+            double S3 = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            double S4 = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+            double m1 = ( cell_shift == -1 );
+            double c0 = ( cell_shift ==  0 );
+            double p1 = ( cell_shift ==  1 );
+            Sx1_buff_vect[          ipart] = m1 * S0                                    ;
+            Sx1_buff_vect[  vecSize+ipart] = c0 * S0 + m1 * S1                          ;
+            Sx1_buff_vect[2*vecSize+ipart] = p1 * S0 + c0 * S1 + m1* S2                 ;
+            Sx1_buff_vect[3*vecSize+ipart] =           p1 * S1 + c0* S2 + m1 * S3       ;
+            Sx1_buff_vect[4*vecSize+ipart] =                     p1* S2 + c0 * S3 + m1 * S4;
+            Sx1_buff_vect[5*vecSize+ipart] =                              p1 * S3 + c0 * S4;
+            Sx1_buff_vect[6*vecSize+ipart] =                                        p1 * S4;
+            //                            Y                                 //
+            pos = particles.position( 1, ivect+ipart+istart ) * dy_inv_;
+            cell = round( pos );
+            cell_shift = cell-jpo-j_domain_begin;
+            delta  = pos - ( double )cell;
+            delta2 = delta*delta;
+            delta3 = delta2*delta;
+            delta4 = delta3*delta;
+            S0 = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+            S1 = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            S2 = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4  * delta4;
+            S3 = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4  * delta2 - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            S4 = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_24 * delta4;
+            m1 = ( cell_shift == -1 );
+            c0 = ( cell_shift ==  0 );
+            p1 = ( cell_shift ==  1 );
+            Sy1_buff_vect[          ipart] = m1 * S0                                    ;
+            Sy1_buff_vect[  vecSize+ipart] = c0 * S0 + m1 * S1                          ;
+            Sy1_buff_vect[2*vecSize+ipart] = p1 * S0 + c0 * S1 + m1* S2                 ;
+            Sy1_buff_vect[3*vecSize+ipart] =           p1 * S1 + c0* S2 + m1 * S3       ;
+            Sy1_buff_vect[4*vecSize+ipart] =                     p1* S2 + c0 * S3 + m1 * S4;
+            Sy1_buff_vect[5*vecSize+ipart] =                              p1 * S3 + c0 * S4;
+            Sy1_buff_vect[6*vecSize+ipart] =                                        p1 * S4;
+            
+            for( unsigned int i = 0; i < 7 ; i++ ) {
+                DSx[i*vecSize+ipart] = Sx1_buff_vect[i*vecSize+ipart] - Sx0_buff_vect[i*vecSize+ipart];
+                DSy[i*vecSize+ipart] = Sy1_buff_vect[i*vecSize+ipart] - Sy0_buff_vect[i*vecSize+ipart];
+            }
+            
+            charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( ivect+istart+ipart ) )*particles.weight( ivect+istart+ipart );
+            crz_p[ipart] = charge_weight[ipart]*one_third*particles.momentum( 2, ivect+istart+ipart )*( *invgf )[ivect+istart+ipart-ipart_ref];
+        }
+        
+        // Jx^(d,p)
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            double crx_p = charge_weight[ipart]*dx_ov_dt;
+            
+            double sum[7];
+            sum[0] = 0.;
+            for( unsigned int k=1 ; k<7 ; k++ ) {
+                sum[k] = sum[k-1]-DSx[( k-1 )*vecSize+ipart];
+            }
+            
+            for( unsigned int j=0; j<7 ; j++ ) {
+                double tmp = crx_p * ( Sy0_buff_vect[j*vecSize+ipart] + 0.5*DSy[j*vecSize+ipart] );
+                for( unsigned int i=1 ; i<7 ; i++ ) {
+                    bJx [( i*7+j )*vecSize+ipart] += sum[i] * tmp;
+                }
+            }
+        }
+        
+        // Jy^(p,d)
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            double cry_p = charge_weight[ipart]*dy_ov_dt;
+            
+            double sum[7];
+            sum[0] = 0.;
+            for( unsigned int k=1 ; k<7 ; k++ ) {
+                sum[k] = sum[k-1]-DSy[( k-1 )*vecSize+ipart];
+            }
+            
+            for( unsigned int i=0; i<7 ; i++ ) {
+                double tmp = cry_p * ( Sx0_buff_vect[i*vecSize+ipart] + 0.5*DSx[i*vecSize+ipart] );
+                for( unsigned int j=1 ; j<7 ; j++ ) {
+                    bJy [( i*7+j )*vecSize+ipart] += sum[j] * tmp;
+                }
+            }
+        }
+        
+        // Jz^(p,p)
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            for( unsigned int i=0 ; i<7 ; i++ ) {
+                double tmp0( crz_p[ipart] * ( 0.5*Sx0_buff_vect[i*vecSize+ipart] + Sx1_buff_vect[i*vecSize+ipart] ) );
+                double tmp1( crz_p[ipart] * ( 0.5*Sx1_buff_vect[i*vecSize+ipart] + Sx0_buff_vect[i*vecSize+ipart] ) );
+                for( unsigned int j=0; j<7 ; j++ ) {
+                    bJz [( i*7+j )*vecSize+ipart] += ( Sy0_buff_vect[j*vecSize+ipart]* tmp1 + Sy1_buff_vect[j*vecSize+ipart]* tmp0 );
+                }
+            }
+        }
+        
+    }
+    
+    int iloc0 = ipom3*nprimy+jpom3;
+    int iloc = iloc0;
+    for( unsigned int i=1 ; i<7 ; i++ ) {
+        iloc += nprimy;
+        #pragma omp simd
+        for( unsigned int j=0 ; j<7 ; j++ ) {
+            double tmpJx( 0. );
+            int ilocal = ( i*7+j )*vecSize;
+#pragma unroll(8)
+            for( int ipart=0 ; ipart<8; ipart++ ) {
+                tmpJx += bJx [ilocal+ipart];
+            }
+            Jx[iloc+j] += tmpJx;
+        }
+    }
+    
+    iloc  = iloc0 + ipom3;
+    for( unsigned int i=0 ; i<7 ; i++ ) {
+        #pragma omp simd
+        for( unsigned int j=1 ; j<7 ; j++ ) {
+            double tmpJy( 0. );
+            int ilocal = ( i*7+j )*vecSize;
+#pragma unroll(8)
+            for( int ipart=0 ; ipart<8; ipart++ ) {
+                tmpJy += bJy [ilocal+ipart];
+            }
+            Jy[iloc+j] += tmpJy;
+        }
+        iloc += ( nprimy+1 );
+    }
+    
+    iloc = iloc0;
+    for( unsigned int i=0 ; i<7 ; i++ ) {
+        #pragma omp simd
+        for( unsigned int j=0 ; j<7 ; j++ ) {
+            double tmpJz( 0. );
+            int ilocal = ( i*7+j )*vecSize;
+#pragma unroll(8)
+            for( int ipart=0 ; ipart<8; ipart++ ) {
+                tmpJz += bJz [ilocal+ipart];
+            }
+            Jz[iloc+j] += tmpJz;
+        }
+        iloc += nprimy;
+    }
+    
+} // END Project vectorized
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Wrapper for projection
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector2D4OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int scell, int ipart_ref )
+{
+    if( istart == iend ) {
+        return;    //Don't treat empty cells.
+    }
+    
+    //Independent of cell. Should not be here
+    //{
+    double *deltaold = smpi->dynamics_deltaold[ithread].data();
+    std::vector<double> *invgf = &( smpi->dynamics_invgf[ithread] );
+    //}
+    int iold[2];
+    iold[0] = scell/nscelly+oversize[0];
+    iold[1] = ( scell%nscelly )+oversize[1];
+    
+    
+    // If no field diagnostics this timestep, then the projection is done directly on the total arrays
+    if( !diag_flag && !is_spectral ) {
+        fdouble *b_Jx =  &( *EMfields->Jx_ )( 0 );
+        fdouble *b_Jy =  &( *EMfields->Jy_ )( 0 );
+        fdouble *b_Jz =  &( *EMfields->Jz_ )( 0 );
+        currents( b_Jx, b_Jy, b_Jz, particles,  istart, iend, invgf, iold, deltaold, ipart_ref );
+        
+        // Otherwise, the projection may apply to the species-specific arrays, and includes the charge density
+    } else {
+        fdouble *b_Jx  = diag_flag && EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
+        fdouble *b_Jy  = diag_flag && EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
+        fdouble *b_Jz  = diag_flag && EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
+        fdouble *b_rho = diag_flag && EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
+        for( int ipart=istart ; ipart<iend; ipart++ ) {
+            currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  ipart, ( *invgf )[ipart-ipart_ref], iold, &deltaold[ipart-ipart_ref], invgf->size() );
+        }
+    }
+}
+
+// Project susceptibility
+void Projector2D4OrderV::susceptibility( ElectroMagn *EMfields, Particles &particles, double species_mass, SmileiMPI *smpi, int istart, int iend,  int ithread, int icell, int ipart_ref )
+{
+    ERROR( "Projection and interpolation for the envelope model are implemented only for interpolation_order = 2" );
+}
@@ -43,7 +43,7 @@ protected:
     int nprimz;
     int oversize[3];
     double dq_inv[3];
-    double *Jx_, *Jy_, *Jz_, *rho_;
+    fdouble *Jx_, *Jy_, *Jz_, *rho_;
     static constexpr double one_third = 1./3.;
 };
 
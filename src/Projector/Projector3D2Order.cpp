@@ -51,10 +51,8 @@ Projector3D2Order::~Projector3D2Order()
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project local currents (sort)
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector3D2Order::currents( double *Jx, double *Jy, double *Jz, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold )
+void Projector3D2Order::currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold )
 {
-    int nparts = particles.size();
-    
     // -------------------------------------
     // Variable declaration & initialization
     // -------------------------------------
@@ -95,7 +93,7 @@ void Projector3D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
     // --------------------------------------------------------
     
     // locate the particle on the primal grid at former time-step & calculate coeff. S0
-    delta = deltaold[0*nparts];
+    delta = deltaold[0];
     delta2 = delta*delta;
     Sx0[0] = 0.;
     Sx0[1] = 0.5 * ( delta2-delta+0.25 );
@@ -103,7 +101,7 @@ void Projector3D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
     Sx0[3] = 0.5 * ( delta2+delta+0.25 );
     Sx0[4] = 0.;
     
-    delta = deltaold[1*nparts];
+    delta = deltaold[1];
     delta2 = delta*delta;
     Sy0[0] = 0.;
     Sy0[1] = 0.5 * ( delta2-delta+0.25 );
@@ -111,7 +109,7 @@ void Projector3D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
     Sy0[3] = 0.5 * ( delta2+delta+0.25 );
     Sy0[4] = 0.;
     
-    delta = deltaold[2*nparts];
+    delta = deltaold[2];
     delta2 = delta*delta;
     Sz0[0] = 0.;
     Sz0[1] = 0.5 * ( delta2-delta+0.25 );
@@ -122,7 +120,7 @@ void Projector3D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
     // locate the particle on the primal grid at current time-step & calculate coeff. S1
     xpn = particles.position( 0, ipart ) * dx_inv_;
     int ip = round( xpn );
-    int ipo = iold[0*nparts];
+    int ipo = iold[0];
     int ip_m_ipo = ip-ipo-i_domain_begin;
     delta  = xpn - ( double )ip;
     delta2 = delta*delta;
@@ -132,7 +130,7 @@ void Projector3D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
     
     ypn = particles.position( 1, ipart ) * dy_inv_;
     int jp = round( ypn );
-    int jpo = iold[1*nparts];
+    int jpo = iold[1];
     int jp_m_jpo = jp-jpo-j_domain_begin;
     delta  = ypn - ( double )jp;
     delta2 = delta*delta;
@@ -142,7 +140,7 @@ void Projector3D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
     
     zpn = particles.position( 2, ipart ) * dz_inv_;
     int kp = round( zpn );
-    int kpo = iold[2*nparts];
+    int kpo = iold[2];
     int kp_m_kpo = kp-kpo-k_domain_begin;
     delta  = zpn - ( double )kp;
     delta2 = delta*delta;
@@ -345,10 +343,8 @@ void Projector3D2Order::currents( double *Jx, double *Jy, double *Jz, Particles
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project local current densities (sort)
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector3D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz, double *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold )
+void Projector3D2Order::currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int ipart, double invgf, int *iold, double *deltaold )
 {
-    int nparts = particles.size();
-    
     // -------------------------------------
     // Variable declaration & initialization
     // -------------------------------------
@@ -389,7 +385,7 @@ void Projector3D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
     // --------------------------------------------------------
     
     // locate the particle on the primal grid at former time-step & calculate coeff. S0
-    delta = deltaold[0*nparts];
+    delta = deltaold[0];
     delta2 = delta*delta;
     Sx0[0] = 0.;
     Sx0[1] = 0.5 * ( delta2-delta+0.25 );
@@ -397,7 +393,7 @@ void Projector3D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
     Sx0[3] = 0.5 * ( delta2+delta+0.25 );
     Sx0[4] = 0.;
     
-    delta = deltaold[1*nparts];
+    delta = deltaold[1];
     delta2 = delta*delta;
     Sy0[0] = 0.;
     Sy0[1] = 0.5 * ( delta2-delta+0.25 );
@@ -405,7 +401,7 @@ void Projector3D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
     Sy0[3] = 0.5 * ( delta2+delta+0.25 );
     Sy0[4] = 0.;
     
-    delta = deltaold[2*nparts];
+    delta = deltaold[2];
     delta2 = delta*delta;
     Sz0[0] = 0.;
     Sz0[1] = 0.5 * ( delta2-delta+0.25 );
@@ -416,7 +412,7 @@ void Projector3D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
     // locate the particle on the primal grid at current time-step & calculate coeff. S1
     xpn = particles.position( 0, ipart ) * dx_inv_;
     int ip = round( xpn );
-    int ipo = iold[0*nparts];
+    int ipo = iold[0];
     int ip_m_ipo = ip-ipo-i_domain_begin;
     delta  = xpn - ( double )ip;
     delta2 = delta*delta;
@@ -426,7 +422,7 @@ void Projector3D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
     
     ypn = particles.position( 1, ipart ) * dy_inv_;
     int jp = round( ypn );
-    int jpo = iold[1*nparts];
+    int jpo = iold[1];
     int jp_m_jpo = jp-jpo-j_domain_begin;
     delta  = ypn - ( double )jp;
     delta2 = delta*delta;
@@ -436,7 +432,7 @@ void Projector3D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
     
     zpn = particles.position( 2, ipart ) * dz_inv_;
     int kp = round( zpn );
-    int kpo = iold[2*nparts];
+    int kpo = iold[2];
     int kp_m_kpo = kp-kpo-k_domain_begin;
     delta  = zpn - ( double )kp;
     delta2 = delta*delta;
@@ -523,7 +519,7 @@ void Projector3D2Order::currentsAndDensity( double *Jx, double *Jy, double *Jz,
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project local densities only (Frozen species)
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector3D2Order::basic( double *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
+void Projector3D2Order::basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
 {
     //Warning : this function is used for frozen species or initialization only and doesn't use the standard scheme.
     //rho type = 0
@@ -729,12 +725,35 @@ void Projector3D2Order::ionizationCurrents( Field *Jx, Field *Jy, Field *Jz, Par
     
 } // END Project global current densities (ionize)
 
+// Former cell index and distance to the primal node of particle ipart
+inline void Projector3D2Order::oldPosition( Particles &particles, int ipart, double invgf, int *iold_buffer, double *delta_buffer, int *iold, double *deltaold )
+{
+    if( reconstruct_old_positions ) {
+        double d_inv[3] = { dx_inv_, dy_inv_, dz_inv_ };
+        int domain_begin[3] = { i_domain_begin, j_domain_begin, k_domain_begin };
+        for( unsigned int i=0; i<3; i++ ) {
+            double pos = reconstructOldPosition( particles, i, ipart, dt, invgf, d_inv[i] );
+            int ip = round( pos );
+            iold[i]     = ip - domain_begin[i];
+            deltaold[i] = pos - ( double )ip;
+        }
+    } else {
+        int nparts = particles.size();
+        for( unsigned int i=0; i<3; i++ ) {
+            iold[i]     = iold_buffer [ipart+i*nparts];
+            deltaold[i] = delta_buffer[ipart+i*nparts];
+        }
+    }
+}
+
 //Wrapper for projection
 void Projector3D2Order::currentsAndDensityWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int icell, int ipart_ref )
 {
-    std::vector<int> *iold = &( smpi->dynamics_iold[ithread] );
-    std::vector<double> *delta = &( smpi->dynamics_deltaold[ithread] );
+    int    *iold_buffer  = reconstruct_old_positions ? NULL : smpi->dynamics_iold[ithread].data();
+    double *delta_buffer = reconstruct_old_positions ? NULL : smpi->dynamics_deltaold[ithread].data();
     std::vector<double> *invgf = &( smpi->dynamics_invgf[ithread] );
+    int iold[3];
+    double deltaold[3];
     Jx_  =  &( *EMfields->Jx_ )( 0 );
     Jy_  =  &( *EMfields->Jy_ )( 0 );
     Jz_  =  &( *EMfields->Jz_ )( 0 );
@@ -745,21 +764,24 @@ void Projector3D2Order::currentsAndDensityWrapper( ElectroMagn *EMfields, Partic
         if( !is_spectral ) {
         
             for( int ipart=istart ; ipart<iend; ipart++ ) {
-                currents( Jx_, Jy_, Jz_, particles,  ipart, ( *invgf )[ipart], &( *iold )[ipart], &( *delta )[ipart] );
+                oldPosition( particles, ipart, ( *invgf )[ipart], iold_buffer, delta_buffer, iold, deltaold );
+                currents( Jx_, Jy_, Jz_, particles,  ipart, ( *invgf )[ipart], iold, deltaold );
             }
         } else {
             for( int ipart=istart ; ipart<iend; ipart++ ) {
-                currentsAndDensity( Jx_, Jy_, Jz_, rho_, particles,  ipart, ( *invgf )[ipart], &( *iold )[ipart], &( *delta )[ipart] );
+                oldPosition( particles, ipart, ( *invgf )[ipart], iold_buffer, delta_buffer, iold, deltaold );
+                currentsAndDensity( Jx_, Jy_, Jz_, rho_, particles,  ipart, ( *invgf )[ipart], iold, deltaold );
             }
         }
         // Otherwise, the projection may apply to the species-specific arrays
     } else {
-        double *b_Jx  = EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
-        double *b_Jy  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
-        double *b_Jz  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
-        double *b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
+        fdouble *b_Jx  = EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
+        fdouble *b_Jy  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
+        fdouble *b_Jz  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
+        fdouble *b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
         for( int ipart=istart ; ipart<iend; ipart++ ) {
-            currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  ipart, ( *invgf )[ipart], &( *iold )[ipart], &( *delta )[ipart] );
+            oldPosition( particles, ipart, ( *invgf )[ipart], iold_buffer, delta_buffer, iold, deltaold );
+            currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  ipart, ( *invgf )[ipart], iold, deltaold );
         }
     }
     
@@ -768,7 +790,7 @@ void Projector3D2Order::currentsAndDensityWrapper( ElectroMagn *EMfields, Partic
 void Projector3D2Order::susceptibility( ElectroMagn *EMfields, Particles &particles, double species_mass, SmileiMPI *smpi, int istart, int iend,  int ithread, int icell, int ipart_ref )
 
 {
-    double *Chi_envelope = &( *EMfields->Env_Chi_ )( 0 );
+    fdouble *Chi_envelope = &( *EMfields->Env_Chi_ )( 0 );
     
     std::vector<double> *Epart       = &( smpi->dynamics_Epart[ithread] );
     std::vector<double> *Phipart     = &( smpi->dynamics_PHIpart[ithread] );
@@ -43,6 +43,11 @@ Projector3D2OrderV::Projector3D2OrderV( Params &params, Patch *patch ) : Project
     dts2           = params.timestep/2.;
     dts4           = params.timestep/4.;
     
+    deposit_instance = SimdDispatch::select( params.simd_instruction_set,
+                                             &Projector3D2OrderV::depositGeneric,
+                                             &Projector3D2OrderV::depositAVX2,
+                                             &Projector3D2OrderV::depositAVX512 );
+    
     DEBUG( "cell_length "<< params.cell_length[0] );
     
 }
@@ -58,7 +63,7 @@ Projector3D2OrderV::~Projector3D2OrderV()
 // ---------------------------------------------------------------------------------------------------------------------
 //!  Project current densities & charge : diagFields timstep (not vectorized)
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector3D2OrderV::currentsAndDensity( double *Jx, double *Jy, double *Jz, double *rho, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref )
+void Projector3D2OrderV::currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref )
 {
 
     // -------------------------------------
@@ -153,7 +158,7 @@ void Projector3D2OrderV::currentsAndDensity( double *Jx, double *Jy, double *Jz,
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project charge : frozen & diagFields timstep (not vectorized)
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector3D2OrderV::basic( double *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
+void Projector3D2OrderV::basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int type )
 {
     //Warning : this function is used for frozen species or initialization only and doesn't use the standard scheme.
     //rho type = 0
@@ -362,7 +367,7 @@ void Projector3D2OrderV::ionizationCurrents( Field *Jx, Field *Jy, Field *Jz, Pa
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project current densities : main projector vectorized
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector3D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref )
+void Projector3D2OrderV::currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref )
 {
     // -------------------------------------
     // Variable declaration & initialization
@@ -410,7 +415,7 @@ void Projector3D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles
         
         #pragma omp simd
         for( int ipart=0 ; ipart<np_computed; ipart++ ) {
-            compute_distances( particles, npart_total, ipart, istart0, ipart_ref, deltaold, iold, Sx0_buff_vect, Sy0_buff_vect, Sz0_buff_vect, DSx, DSy, DSz );
+            compute_distances( particles, npart_total, ipart, istart0, ipart_ref, deltaold, iold, invgf->data(), Sx0_buff_vect, Sy0_buff_vect, Sz0_buff_vect, DSx, DSy, DSz );
             charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( istart0+ipart ) )*particles.weight( istart0+ipart );
         }
         
@@ -456,7 +461,7 @@ void Projector3D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles
         
         #pragma omp simd
         for( int ipart=0 ; ipart<np_computed; ipart++ ) {
-            compute_distances( particles, npart_total, ipart, istart0, ipart_ref, deltaold, iold, Sx0_buff_vect, Sy0_buff_vect, Sz0_buff_vect, DSx, DSy, DSz );
+            compute_distances( particles, npart_total, ipart, istart0, ipart_ref, deltaold, iold, invgf->data(), Sx0_buff_vect, Sy0_buff_vect, Sz0_buff_vect, DSx, DSy, DSz );
             charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( istart0+ipart ) )*particles.weight( istart0+ipart );
         }
         
@@ -498,7 +503,7 @@ void Projector3D2OrderV::currents( double *Jx, double *Jy, double *Jz, Particles
         
         #pragma omp simd
         for( int ipart=0 ; ipart<np_computed; ipart++ ) {
-            compute_distances( particles, npart_total, ipart, istart0, ipart_ref, deltaold, iold, Sx0_buff_vect, Sy0_buff_vect, Sz0_buff_vect, DSx, DSy, DSz );
+            compute_distances( particles, npart_total, ipart, istart0, ipart_ref, deltaold, iold, invgf->data(), Sx0_buff_vect, Sy0_buff_vect, Sz0_buff_vect, DSx, DSy, DSz );
             charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( istart0+ipart ) )*particles.weight( istart0+ipart );
         }
         
@@ -541,6 +546,26 @@ void Projector3D2OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields,
         bool diag_flag,
         bool is_spectral,
         int ispec, int scell, int ipart_ref )
+{
+    ( this->*deposit_instance )( EMfields, particles, smpi, istart, iend, ithread, diag_flag, is_spectral, ispec, scell, ipart_ref );
+}
+
+void Projector3D2OrderV::depositGeneric( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int scell, int ipart_ref )
+{
+    depositKernel( EMfields, particles, smpi, istart, iend, ithread, diag_flag, is_spectral, ispec, scell, ipart_ref );
+}
+
+void Projector3D2OrderV::depositAVX2( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int scell, int ipart_ref )
+{
+    depositKernel( EMfields, particles, smpi, istart, iend, ithread, diag_flag, is_spectral, ispec, scell, ipart_ref );
+}
+
+void Projector3D2OrderV::depositAVX512( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int scell, int ipart_ref )
+{
+    depositKernel( EMfields, particles, smpi, istart, iend, ithread, diag_flag, is_spectral, ispec, scell, ipart_ref );
+}
+
+void Projector3D2OrderV::depositKernel( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int scell, int ipart_ref )
 {
     if( istart == iend ) {
         return;    //Don't treat empty cells.
@@ -548,7 +573,7 @@ void Projector3D2OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields,
     
     //Independent of cell. Should not be here
     //{
-    std::vector<double> *delta = &( smpi->dynamics_deltaold[ithread] );
+    double *deltaold = reconstruct_old_positions ? NULL : smpi->dynamics_deltaold[ithread].data();
     std::vector<double> *invgf = &( smpi->dynamics_invgf[ithread] );
     //}
     int iold[3];
@@ -560,23 +585,19 @@ void Projector3D2OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields,
     
     
     // If no field diagnostics this timestep, then the projection is done directly on the total arrays
-    if( !diag_flag ) {
-        if( !is_spectral ) {
-            double *b_Jx =  &( *EMfields->Jx_ )( 0 );
-            double *b_Jy =  &( *EMfields->Jy_ )( 0 );
-            double *b_Jz =  &( *EMfields->Jz_ )( 0 );
-            currents( b_Jx, b_Jy, b_Jz, particles,  istart, iend, invgf, iold, &( *delta )[0], ipart_ref );
-        } else {
-            ERROR( "TO DO with rho" );
-        }
+    if( !diag_flag && !is_spectral ) {
+        fdouble *b_Jx =  &( *EMfields->Jx_ )( 0 );
+        fdouble *b_Jy =  &( *EMfields->Jy_ )( 0 );
+        fdouble *b_Jz =  &( *EMfields->Jz_ )( 0 );
+        currents( b_Jx, b_Jy, b_Jz, particles,  istart, iend, invgf, iold, deltaold, ipart_ref );
         
-        // Otherwise, the projection may apply to the species-specific arrays
+        // Otherwise, the projection may apply to the species-specific arrays, and includes the charge density
     } else {
-        double *b_Jx  = EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
-        double *b_Jy  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
-        double *b_Jz  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
-        double *b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
-        currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  istart, iend, invgf, iold, &( *delta )[0], ipart_ref );
+        fdouble *b_Jx  = diag_flag && EMfields->Jx_s [ispec] ? &( *EMfields->Jx_s [ispec] )( 0 ) : &( *EMfields->Jx_ )( 0 ) ;
+        fdouble *b_Jy  = diag_flag && EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
+        fdouble *b_Jz  = diag_flag && EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
+        fdouble *b_rho = diag_flag && EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
+        currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  istart, iend, invgf, iold, deltaold, ipart_ref );
     }
 }
 
@@ -584,7 +605,7 @@ void Projector3D2OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields,
 void Projector3D2OrderV::susceptibility( ElectroMagn *EMfields, Particles &particles, double species_mass, SmileiMPI *smpi, int istart, int iend,  int ithread, int scell, int ipart_ref )
 {
 
-    double *Chi_envelope = &( *EMfields->Env_Chi_ )( 0 ) ;
+    fdouble *Chi_envelope = &( *EMfields->Env_Chi_ )( 0 ) ;
     
     int iold[3];
     
@@ -11,12 +11,12 @@ public:
     ~Projector3D2OrderV();
     
     //! Project global current densities (EMfields->Jx_/Jy_/Jz_)
-    inline void currents( double *Jx, double *Jy, double *Jz, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref = 0 );
+    SMILEI_KERNEL_INLINE void currents( fdouble *Jx, fdouble *Jy, fdouble *Jz, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref = 0 );
     //! Project global current densities (EMfields->Jx_/Jy_/Jz_/rho), diagFields timestep
-    inline void currentsAndDensity( double *Jx, double *Jy, double *Jz, double *rho, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref = 0 );
+    SMILEI_KERNEL_INLINE void currentsAndDensity( fdouble *Jx, fdouble *Jy, fdouble *Jz, fdouble *rho, Particles &particles, unsigned int istart, unsigned int iend, std::vector<double> *invgf, int *iold, double *deltaold, int ipart_ref = 0 );
     
     //! Project global current charge (EMfields->rho_), frozen & diagFields timestep
-    void basic( double *rhoj, Particles &particles, unsigned int ipart, unsigned int bin ) override final;
+    void basic( fdouble *rhoj, Particles &particles, unsigned int ipart, unsigned int bin ) override final;
     
     //! Project global current densities if Ionization in Species::dynamics,
     void ionizationCurrents( Field *Jx, Field *Jy, Field *Jz, Particles &particles, int ipart, LocalFields Jion ) override final;
@@ -29,7 +29,18 @@ public:
 private:
     double dt, dts2, dts4;
     
-    inline void compute_distances( Particles &particles, int npart_total, int ipart, int istart, int ipart_ref, double *delta0, int *iold, double *Sx0, double *Sy0, double *Sz0, double *DSx, double *DSy, double *DSz )
+    //! Body of currentsAndDensityWrapper, compiled in each instance below
+    SMILEI_KERNEL_INLINE void depositKernel( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int scell, int ipart_ref );
+    
+    //! Instances of currentsAndDensityWrapper for each instruction set (see SimdDispatch.h)
+    void depositGeneric( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int scell, int ipart_ref );
+    SMILEI_TARGET_AVX2 void depositAVX2( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int scell, int ipart_ref );
+    SMILEI_TARGET_AVX512 void depositAVX512( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int scell, int ipart_ref );
+    
+    //! Instance selected at startup
+    void ( Projector3D2OrderV::*deposit_instance )( ElectroMagn *, Particles &, SmileiMPI *, int, int, int, bool, bool, int, int, int );
+    
+    inline void compute_distances( Particles &particles, int npart_total, int ipart, int istart, int ipart_ref, double *delta0, int *iold, double *invgf, double *Sx0, double *Sy0, double *Sz0, double *DSx, double *DSy, double *DSz )
     {
     
         int ipo = iold[0];
@@ -38,7 +49,13 @@ private:
         
         int vecSize = 8;
         
-        double delta = delta0[istart-ipart_ref+ipart];
+        // Former position: buffered by the interpolator or recomputed, relative to the primal node of the cell
+        double delta;
+        if( reconstruct_old_positions ) {
+            delta = reconstructOldPosition( particles, 0, istart+ipart, dt, invgf[istart-ipart_ref+ipart], dx_inv_ ) - ( double )( ipo+i_domain_begin );
+        } else {
+            delta = delta0[istart-ipart_ref+ipart];
+        }
         double delta2 = delta*delta;
         
         Sx0[          ipart] = 0.5 * ( delta2-delta+0.25 );
@@ -47,7 +64,11 @@ private:
         Sx0[3*vecSize+ipart] = 0.;
         
         //                            Y                                 //
-        delta = delta0[istart-ipart_ref+ipart+npart_total];
+        if( reconstruct_old_positions ) {
+            delta = reconstructOldPosition( particles, 1, istart+ipart, dt, invgf[istart-ipart_ref+ipart], dy_inv_ ) - ( double )( jpo+j_domain_begin );
+        } else {
+            delta = delta0[istart-ipart_ref+ipart+npart_total];
+        }
         delta2 = delta*delta;
         
         Sy0[          ipart] = 0.5 * ( delta2-delta+0.25 );
@@ -56,7 +77,11 @@ private:
         Sy0[3*vecSize+ipart] = 0.;
         
         //                            Z                                 //
-        delta = delta0[istart-ipart_ref+ipart+2*npart_total];
+        if( reconstruct_old_positions ) {
+            delta = reconstructOldPosition( particles, 2, istart+ipart, dt, invgf[istart-ipart_ref+ipart], dz_inv_ ) - ( double )( kpo+k_domain_begin );
+        } else {
+            delta = delta0[istart-ipart_ref+ipart+2*npart_total];
+        }
         delta2 = delta*delta;
         
         Sz0[          ipart] = 0.5 * ( delta2-delta+0.25 );
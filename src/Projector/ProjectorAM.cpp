@@ -1,10 +1,94 @@
 #include "ProjectorAM.h"
 
+#include <complex>
+#include "dcomplex.h"
+
 #include "Params.h"
 #include "Patch.h"
+#include "ElectroMagnAM.h"
+#include "cField2D.h"
+
+using namespace std;
 
 ProjectorAM::ProjectorAM( Params &params, Patch *patch )
     : Projector( params, patch )
 {
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! Fold the currents (and the charge on diagnostic timesteps) projected below the axis, and apply the on-axis
+//! conditions for all modes. To be called once per species, after all its particles have been projected.
+// ---------------------------------------------------------------------------------------------------------------------
+void ProjectorAM::currentsAxisBC( ElectroMagnAM *emAM, bool diag_flag, int ispec )
+{
+    complex<double> *rho, *Jl, *Jr, *Jt;
+    double sign = 1. ;
+    for ( int imode = 0; imode < Nmode; imode++){
+        sign *= -1.;
+        
+        if (!diag_flag){
+            Jl =  &( *emAM->Jl_[imode] )( 0 );
+            Jr =  &( *emAM->Jr_[imode] )( 0 );
+            Jt =  &( *emAM->Jt_[imode] )( 0 );
+        } else {
+            unsigned int n_species = emAM->Jl_.size() / Nmode;
+            unsigned int ifield = imode*n_species+ispec;
+            Jl  = emAM->Jl_s    [ifield] ? &( * ( emAM->Jl_s    [ifield] ) )( 0 ) : &( *emAM->Jl_    [imode] )( 0 ) ;
+            Jr  = emAM->Jr_s    [ifield] ? &( * ( emAM->Jr_s    [ifield] ) )( 0 ) : &( *emAM->Jr_    [imode] )( 0 ) ;
+            Jt  = emAM->Jt_s    [ifield] ? &( * ( emAM->Jt_s    [ifield] ) )( 0 ) : &( *emAM->Jt_    [imode] )( 0 ) ;
+            rho = emAM->rho_AM_s[ifield] ? &( * ( emAM->rho_AM_s[ifield] ) )( 0 ) : &( *emAM->rho_AM_[imode] )( 0 ) ;
+            //Fold rho
+            for( unsigned int i=2 ; i<npriml*nprimr+2; i+=nprimr ) {
+                for( unsigned int j=1 ; j<3; j++ ) {
+                    rho[i+j] = rho[i+j] - sign * rho[i-j];
+                }
+                if (imode > 0) rho[i] = 0.;
+            }//i
+        }
+        
+        //Fold Jt
+        for( unsigned int i=0 ; i<npriml; i++ ) {
+            int iloc = i*nprimr;
+            for( unsigned int j=1 ; j<3; j++ ) {
+                Jt [iloc+2+j] = Jt [iloc+2+j] + sign * Jt [iloc+2-j];
+            }
+        }//i
+        //Fold Jl
+        for( unsigned int i=0 ; i<npriml+1; i++ ) {
+            int iloc = i*nprimr;
+            for( unsigned int j=1 ; j<3; j++ ) {
+                Jl [iloc+2+j] = Jl [iloc+2+j] - sign * Jl [iloc+2-j];
+             }
+        }//i
+        
+        //Fold Jr
+        for( unsigned int i=0 ; i<npriml; i++ ) {
+            int ilocr = i*(nprimr+1);
+            for( unsigned int j=0 ; j<3; j++ ) {
+                Jr [ilocr+5-j] = Jr [ilocr+5-j] + sign * Jr [ilocr+j];
+            }
+        }//i
+        
+        // Jl and Jt boundaries on axis
+        int j = 2;
+        if (imode > 0){
+            // All Jl = zero on axis for imode > 0. Mode 0 is treated in general case.
+            for( unsigned int i=0 ; i<npriml+1; i++ ) {
+                int iloc = i*nprimr;
+                Jl [iloc+j] = 0. ;
+            }//i
+        }
+        if (imode == 1){
+            for( unsigned int i=0 ; i<npriml; i++ ) {
+                int iloc = i*nprimr;
+                int ilocr = i*(nprimr+1);
+                Jt [iloc+j] = -1./3.*(4.*Icpx*Jr[ilocr+j+1] + Jt[iloc+j+1]) ;
+            }//i
+        } else{
+            for( unsigned int i=0 ; i<npriml; i++ ) {
+                int iloc = i*nprimr;
+                Jt [iloc+j] = 0. ;
+            }
+        }
+    }
+}
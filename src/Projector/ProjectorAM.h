@@ -4,6 +4,7 @@
 #include "Projector.h"
 #include "Params.h"
 
+class ElectroMagnAM;
 
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -11,7 +12,7 @@
 //----------------------------------------------------------------------------------------------------------------------
 class ProjectorAM : public Projector
 {
-
+    
 public:
     //! Constructor for ProjectorAM
     ProjectorAM( Params &params, Patch *patch );
@@ -27,6 +28,9 @@ public:
     }
     
 protected:
+    //! Fold the currents projected below the axis and apply the on-axis conditions, for all modes
+    void currentsAxisBC( ElectroMagnAM *emAM, bool diag_flag, int ispec );
+    
     double dr;
     double dt;
     //! Inverse of the spatial step 1/dx
@@ -0,0 +1,507 @@
+#include "ProjectorAM2OrderV.h"
+
+#include <cmath>
+#include <iostream>
+#include <complex>
+#include "dcomplex.h"
+#include "ElectroMagnAM.h"
+#include "cField2D.h"
+#include "Particles.h"
+#include "Tools.h"
+#include "Patch.h"
+#include "PatchAM.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for ProjectorAM2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+ProjectorAM2OrderV::ProjectorAM2OrderV( Params &params, Patch *patch ) : ProjectorAM( params, patch )
+{
+    dt = params.timestep;
+    dr = params.cell_length[1];
+    dl_inv_   = 1.0/params.cell_length[0];
+    dl_ov_dt  = params.cell_length[0] / params.timestep;
+    dr_ov_dt  = params.cell_length[1] / params.timestep;
+    dr_inv_   = 1.0 / dr;
+    one_ov_dt  = 1.0 / params.timestep;
+    Nmode=params.nmodes;
+    i_domain_begin = patch->getCellStartingGlobalIndex( 0 );
+    j_domain_begin = patch->getCellStartingGlobalIndex( 1 );
+    
+    nprimr = params.n_space[1] + 2*params.oversize[1] + 1;
+    npriml = params.n_space[0] + 2*params.oversize[0] + 1;
+    
+    nscellr = params.n_space[1] + 1;
+    ncells  = ( params.n_space[0] + 1 ) * nscellr;
+    oversize[0] = params.oversize[0];
+    oversize[1] = params.oversize[1];
+    
+    invR = &((static_cast<PatchAM *>( patch )->invR)[0]);
+    invRd = &((static_cast<PatchAM *>( patch )->invRd)[0]);
+    
+    // Jl, Jr, Jt and rho, real and imaginary parts, for each mode
+    bJ.resize( Nmode*8*5*5*8 );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor for ProjectorAM2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+ProjectorAM2OrderV::~ProjectorAM2OrderV()
+{
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project local currents for all modes : main projector vectorized
+//! The shape factors and the mode-independent parts of Jl and Jr are computed once per block of particles,
+//! then each mode is accumulated for the whole block in separate real and imaginary buffers
+// ---------------------------------------------------------------------------------------------------------------------
+void ProjectorAM2OrderV::currents( ElectroMagnAM *emAM, Particles &particles, unsigned int istart, unsigned int iend, double *invgf, int *iold, double *deltaold, double *array_theta_old, int nparts, bool diag_flag, int ispec, int ipart_ref )
+{
+    // -------------------------------------
+    // Variable declaration & initialization
+    // -------------------------------------
+    
+    int ipo = iold[0];
+    int jpo = iold[1];
+    int ipom2 = ipo-2;
+    int jpom2 = jpo-2;
+    
+    const int vecSize = 8;
+    const int bsize = 5*5*vecSize;
+    
+    double Sl0_buff_vect[40] __attribute__( ( aligned( 64 ) ) );
+    double Sr0_buff_vect[40] __attribute__( ( aligned( 64 ) ) );
+    double Sl1_buff_vect[40] __attribute__( ( aligned( 64 ) ) );
+    double Sr1_buff_vect[40] __attribute__( ( aligned( 64 ) ) );
+    double DSl[40] __attribute__( ( aligned( 64 ) ) );
+    double DSr[40] __attribute__( ( aligned( 64 ) ) );
+    double Jl_p[bsize] __attribute__( ( aligned( 64 ) ) );
+    double Jr_p[bsize] __attribute__( ( aligned( 64 ) ) );
+    double charge_weight[8] __attribute__( ( aligned( 64 ) ) );
+    double rp[8] __attribute__( ( aligned( 64 ) ) );
+    double crt_p0[8] __attribute__( ( aligned( 64 ) ) );
+    // exp(i dtheta) and exp(i theta_bar), and their powers for the current mode
+    double e_delta_m1_re[8] __attribute__( ( aligned( 64 ) ) );
+    double e_delta_m1_im[8] __attribute__( ( aligned( 64 ) ) );
+    double e_bar_m1_re[8] __attribute__( ( aligned( 64 ) ) );
+    double e_bar_m1_im[8] __attribute__( ( aligned( 64 ) ) );
+    double e_delta_re[8] __attribute__( ( aligned( 64 ) ) );
+    double e_delta_im[8] __attribute__( ( aligned( 64 ) ) );
+    double e_bar_re[8] __attribute__( ( aligned( 64 ) ) );
+    double e_bar_im[8] __attribute__( ( aligned( 64 ) ) );
+    // Mode coefficients of Jl/Jr/rho (C_m) and of the two terms of Jt
+    double C_re[8] __attribute__( ( aligned( 64 ) ) );
+    double C_im[8] __attribute__( ( aligned( 64 ) ) );
+    double A_re[8] __attribute__( ( aligned( 64 ) ) );
+    double A_im[8] __attribute__( ( aligned( 64 ) ) );
+    double B_re[8] __attribute__( ( aligned( 64 ) ) );
+    double B_im[8] __attribute__( ( aligned( 64 ) ) );
+    
+    // Radial factors of Jr only depend on the cell
+    double *invR_local = &( invR[jpom2] );
+    double Vd[4], invRd_dr[4];
+    for( int j=0 ; j<4 ; j++ ) {
+        int jloc = j+jpom2+1;
+        Vd[j] = abs( jloc + j_domain_begin + 0.5 )* invRd[jloc]*dr ;
+        invRd_dr[j] = invRd[jloc]*dr;
+    }
+    
+    double *b = &( bJ[0] );
+    #pragma omp simd
+    for( unsigned int j=0; j<Nmode*8*bsize; j++ ) {
+        b[j] = 0.;
+    }
+    
+    int cell_nparts( ( int )iend-( int )istart );
+    
+    for( int ivect=0 ; ivect < cell_nparts; ivect += vecSize ) {
+        
+        int np_computed = min( cell_nparts-ivect, vecSize );
+        
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            
+            int ip = ivect+ipart+istart;
+            
+            // locate the particle on the primal grid at current time-step & calculate coeff. S1
+            //                            L                                 //
+            double pos = particles.position( 0, ip ) * dl_inv_;
+            int cell = round( pos );
+            int cell_shift = cell-ipo-i_domain_begin;
+            double delta  = pos - ( double )cell;
+            double delta2 = delta*delta;
+            double deltam =  0.5 * ( delta2-delta+0.25 );
+            double deltap =  0.5 * ( delta2+delta+0.25 );
+            delta2 = 0.75 - delta2;
+            double m1 = ( cell_shift == -1 );
+            double c0 = ( cell_shift ==  0 );
+            double p1 = ( cell_shift ==  1 );
+            Sl1_buff_vect[          ipart] = m1 * deltam                                                                                  ;
+            Sl1_buff_vect[  vecSize+ipart] = c0 * deltam + m1*delta2                                               ;
+            Sl1_buff_vect[2*vecSize+ipart] = p1 * deltam + c0*delta2 + m1*deltap;
+            Sl1_buff_vect[3*vecSize+ipart] =               p1*delta2 + c0*deltap;
+            Sl1_buff_vect[4*vecSize+ipart] =                           p1*deltap;
+            // locate the particle on the primal grid at former time-step & calculate coeff. S0
+            //                            L                                 //
+            delta = deltaold[ip-ipart_ref];
+            delta2 = delta*delta;
+            Sl0_buff_vect[          ipart] = 0;
+            Sl0_buff_vect[  vecSize+ipart] = 0.5 * ( delta2-delta+0.25 );
+            Sl0_buff_vect[2*vecSize+ipart] = 0.75-delta2;
+            Sl0_buff_vect[3*vecSize+ipart] = 0.5 * ( delta2+delta+0.25 );
+            Sl0_buff_vect[4*vecSize+ipart] = 0;
+            
+            //                            R                                 //
+            double yp = particles.position( 1, ip );
+            double zp = particles.position( 2, ip );
+            rp[ipart] = sqrt( yp*yp + zp*zp );
+            pos = rp[ipart] * dr_inv_;
+            cell = round( pos );
+            cell_shift = cell-jpo-j_domain_begin;
+            delta  = pos - ( double )cell;
+            delta2 = delta*delta;
+            deltam =  0.5 * ( delta2-delta+0.25 );
+            deltap =  0.5 * ( delta2+delta+0.25 );
+            delta2 = 0.75 - delta2;
+            m1 = ( cell_shift == -1 );
+            c0 = ( cell_shift ==  0 );
+            p1 = ( cell_shift ==  1 );
+            Sr1_buff_vect[          ipart] = m1 * deltam                                                                                  ;
+            Sr1_buff_vect[  vecSize+ipart] = c0 * deltam + m1*delta2                                               ;
+            Sr1_buff_vect[2*vecSize+ipart] = p1 * deltam + c0*delta2 + m1*deltap;
+            Sr1_buff_vect[3*vecSize+ipart] =               p1*delta2 + c0*deltap;
+            Sr1_buff_vect[4*vecSize+ipart] =                           p1*deltap;
+            //                            R                                 //
+            delta = deltaold[ip-ipart_ref+nparts];
+            delta2 = delta*delta;
+            Sr0_buff_vect[          ipart] = 0;
+            Sr0_buff_vect[  vecSize+ipart] = 0.5 * ( delta2-delta+0.25 );
+            Sr0_buff_vect[2*vecSize+ipart] = 0.75-delta2;
+            Sr0_buff_vect[3*vecSize+ipart] = 0.5 * ( delta2+delta+0.25 );
+            Sr0_buff_vect[4*vecSize+ipart] = 0;
+            
+            for( unsigned int i = 0; i < 5 ; i++ ) {
+                DSl[i*vecSize+ipart] = Sl1_buff_vect[ i*vecSize+ipart] - Sl0_buff_vect[ i*vecSize+ipart];
+                DSr[i*vecSize+ipart] = Sr1_buff_vect[ i*vecSize+ipart] - Sr0_buff_vect[ i*vecSize+ipart];
+            }
+            charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( ip ) )*particles.weight( ip );
+            
+            // Azimuthal displacement
+            double theta_old = array_theta_old[ip-ipart_ref];
+            double dtheta = std::remainder( atan2( zp, yp )-theta_old, 2*M_PI )/2.; // Otherwise dtheta is overestimated when going from -pi to +pi
+            double theta_bar = theta_old+dtheta;
+            e_delta_m1_re[ipart] = cos( dtheta );
+            e_delta_m1_im[ipart] = sin( dtheta );
+            e_bar_m1_re[ipart] = cos( theta_bar );
+            e_bar_m1_im[ipart] = sin( theta_bar );
+            e_delta_re[ipart] = 1.;
+            e_delta_im[ipart] = 0.;
+            e_bar_re[ipart] = 1.;
+            e_bar_im[ipart] = 0.;
+            
+            crt_p0[ipart] = charge_weight[ipart]*( particles.momentum( 2, ip )*yp-particles.momentum( 1, ip )*zp )/( rp[ipart] )*invgf[ip-ipart_ref];
+        }
+        
+        // Mode independent part of Jl and Jr, and division by R for Jt and rho
+        #pragma omp simd
+        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+            double crl_p = charge_weight[ipart]*dl_ov_dt;
+            double crr_p = charge_weight[ipart]*one_ov_dt;
+            
+            for( unsigned int j=0 ; j<5 ; j++ ) {
+                double tmp = crl_p * ( Sr0_buff_vect[j*vecSize+ipart] + 0.5*DSr[j*vecSize+ipart] )* invR_local[j];
+                Jl_p[j*vecSize+ipart] = 0.;
+                for( unsigned int i=1 ; i<5 ; i++ ) {
+                    Jl_p[( i*5+j )*vecSize+ipart] = Jl_p[( ( i-1 )*5+j )*vecSize+ipart] - DSl[( i-1 )*vecSize+ipart] * tmp;
+                }
+            }
+            
+            for( unsigned int i=0 ; i<5 ; i++ ) {
+                Jr_p[( i*5+4 )*vecSize+ipart] = 0.;
+            }
+            for( int j=3 ; j>=0 ; j-- ) {
+                double tmp = crr_p * DSr[( j+1 )*vecSize+ipart] * invRd_dr[j];
+                for( unsigned int i=0 ; i<5 ; i++ ) {
+                    Jr_p[( i*5+j )*vecSize+ipart] = Jr_p[( i*5+j+1 )*vecSize+ipart] * Vd[j] + ( Sl0_buff_vect[i*vecSize+ipart] + 0.5*DSl[i*vecSize+ipart] ) * tmp;
+                }
+            }
+            
+            for( unsigned int j=0 ; j<5 ; j++ ) {
+                Sr0_buff_vect[j*vecSize+ipart] *= invR_local[j];
+                Sr1_buff_vect[j*vecSize+ipart] *= invR_local[j];
+            }
+        }
+        
+        for( unsigned int imode=0; imode<Nmode; imode++ ) {
+            
+            if( imode == 0 ) {
+                #pragma omp simd
+                for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+                    C_re[ipart] = 1.;
+                    C_im[ipart] = 0.;
+                    // e_delta = 1.5 for mode 0
+                    A_re[ipart] = 0.5*crt_p0[ipart];
+                    A_im[ipart] = 0.;
+                    B_re[ipart] = 0.5*crt_p0[ipart];
+                    B_im[ipart] = 0.;
+                }
+            } else {
+                double crt_factor = 2./( dt*( double )imode );
+                #pragma omp simd
+                for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+                    double re = e_delta_re[ipart]*e_delta_m1_re[ipart] - e_delta_im[ipart]*e_delta_m1_im[ipart];
+                    double im = e_delta_re[ipart]*e_delta_m1_im[ipart] + e_delta_im[ipart]*e_delta_m1_re[ipart];
+                    e_delta_re[ipart] = re;
+                    e_delta_im[ipart] = im;
+                    re = e_bar_re[ipart]*e_bar_m1_re[ipart] - e_bar_im[ipart]*e_bar_m1_im[ipart];
+                    im = e_bar_re[ipart]*e_bar_m1_im[ipart] + e_bar_im[ipart]*e_bar_m1_re[ipart];
+                    e_bar_re[ipart] = re;
+                    e_bar_im[ipart] = im;
+                    
+                    C_re[ipart] = 2.*e_bar_re[ipart];
+                    C_im[ipart] = 2.*e_bar_im[ipart];
+                    // crt_p = charge_weight*i*e_bar/(dt*imode)*2*rp
+                    double crt_re = -charge_weight[ipart]*crt_factor*rp[ipart]*e_bar_im[ipart];
+                    double crt_im =  charge_weight[ipart]*crt_factor*rp[ipart]*e_bar_re[ipart];
+                    // A = crt_p*( 1/e_delta - 1 ), where 1/e_delta is the conjugate of e_delta
+                    A_re[ipart] = crt_re*( e_delta_re[ipart]-1. ) + crt_im*e_delta_im[ipart];
+                    A_im[ipart] = crt_im*( e_delta_re[ipart]-1. ) - crt_re*e_delta_im[ipart];
+                    // B = crt_p*( e_delta - 1 )
+                    B_re[ipart] = crt_re*( e_delta_re[ipart]-1. ) - crt_im*e_delta_im[ipart];
+                    B_im[ipart] = crt_im*( e_delta_re[ipart]-1. ) + crt_re*e_delta_im[ipart];
+                }
+            }
+            
+            double *bJl_re  = &( b[( imode*8   )*bsize] );
+            double *bJl_im  = &( b[( imode*8+1 )*bsize] );
+            double *bJr_re  = &( b[( imode*8+2 )*bsize] );
+            double *bJr_im  = &( b[( imode*8+3 )*bsize] );
+            double *bJt_re  = &( b[( imode*8+4 )*bsize] );
+            double *bJt_im  = &( b[( imode*8+5 )*bsize] );
+            double *brho_re = &( b[( imode*8+6 )*bsize] );
+            double *brho_im = &( b[( imode*8+7 )*bsize] );
+            
+            #pragma omp simd
+            for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+                for( unsigned int i=0 ; i<5 ; i++ ) {
+                    for( unsigned int j=0 ; j<5 ; j++ ) {
+                        int k = ( i*5+j )*vecSize+ipart;
+                        double S1 = Sl1_buff_vect[i*vecSize+ipart]*Sr1_buff_vect[j*vecSize+ipart];
+                        double S0 = Sl0_buff_vect[i*vecSize+ipart]*Sr0_buff_vect[j*vecSize+ipart];
+                        bJl_re[k] += C_re[ipart] * Jl_p[k];
+                        bJl_im[k] += C_im[ipart] * Jl_p[k];
+                        bJr_re[k] += C_re[ipart] * Jr_p[k];
+                        bJr_im[k] += C_im[ipart] * Jr_p[k];
+                        bJt_re[k] += A_re[ipart]*S1 - B_re[ipart]*S0;
+                        bJt_im[k] += A_im[ipart]*S1 - B_im[ipart]*S0;
+                    }
+                }
+            }
+            if( diag_flag ) {
+                #pragma omp simd
+                for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+                    for( unsigned int i=0 ; i<5 ; i++ ) {
+                        for( unsigned int j=0 ; j<5 ; j++ ) {
+                            int k = ( i*5+j )*vecSize+ipart;
+                            double S1 = charge_weight[ipart]*Sl1_buff_vect[i*vecSize+ipart]*Sr1_buff_vect[j*vecSize+ipart];
+                            brho_re[k] += C_re[ipart]*S1;
+                            brho_im[k] += C_im[ipart]*S1;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    
+    // Add the contribution of the cell to the global arrays
+    complex<double> *Jl, *Jr, *Jt, *rho = NULL;
+    for( unsigned int imode=0; imode<Nmode; imode++ ) {
+        
+        if( !diag_flag ) {
+            Jl =  &( *emAM->Jl_[imode] )( 0 );
+            Jr =  &( *emAM->Jr_[imode] )( 0 );
+            Jt =  &( *emAM->Jt_[imode] )( 0 );
+        } else {
+            unsigned int n_species = emAM->Jl_.size() / Nmode;
+            unsigned int ifield = imode*n_species+ispec;
+            Jl  = emAM->Jl_s    [ifield] ? &( * ( emAM->Jl_s    [ifield] ) )( 0 ) : &( *emAM->Jl_    [imode] )( 0 ) ;
+            Jr  = emAM->Jr_s    [ifield] ? &( * ( emAM->Jr_s    [ifield] ) )( 0 ) : &( *emAM->Jr_    [imode] )( 0 ) ;
+            Jt  = emAM->Jt_s    [ifield] ? &( * ( emAM->Jt_s    [ifield] ) )( 0 ) : &( *emAM->Jt_    [imode] )( 0 ) ;
+            rho = emAM->rho_AM_s[ifield] ? &( * ( emAM->rho_AM_s[ifield] ) )( 0 ) : &( *emAM->rho_AM_[imode] )( 0 ) ;
+        }
+        
+        double *bJl_re  = &( b[( imode*8   )*bsize] );
+        double *bJl_im  = &( b[( imode*8+1 )*bsize] );
+        double *bJr_re  = &( b[( imode*8+2 )*bsize] );
+        double *bJr_im  = &( b[( imode*8+3 )*bsize] );
+        double *bJt_re  = &( b[( imode*8+4 )*bsize] );
+        double *bJt_im  = &( b[( imode*8+5 )*bsize] );
+        double *brho_re = &( b[( imode*8+6 )*bsize] );
+        double *brho_im = &( b[( imode*8+7 )*bsize] );
+        
+        for( unsigned int i=0 ; i<5 ; i++ ) {
+            int iloc  = ( i+ipom2 )*nprimr + jpom2;
+            int ilocr = ( i+ipom2 )*( nprimr+1 ) + jpom2 + 1;
+            for( unsigned int j=0 ; j<5 ; j++ ) {
+                int ilocal = ( i*5+j )*vecSize;
+                double Jl_re( 0. ), Jl_im( 0. ), Jr_re( 0. ), Jr_im( 0. ), Jt_re( 0. ), Jt_im( 0. );
+#pragma unroll(8)
+                for( int ipart=0 ; ipart<8; ipart++ ) {
+                    Jl_re += bJl_re[ilocal+ipart];
+                    Jl_im += bJl_im[ilocal+ipart];
+                    Jr_re += bJr_re[ilocal+ipart];
+                    Jr_im += bJr_im[ilocal+ipart];
+                    Jt_re += bJt_re[ilocal+ipart];
+                    Jt_im += bJt_im[ilocal+ipart];
+                }
+                // Jl^(d,p)
+                if( i > 0 ) {
+                    Jl[iloc+j] += complex<double>( Jl_re, Jl_im );
+                }
+                // Jr^(p,d)
+                if( j < 4 ) {
+                    Jr[ilocr+j] += complex<double>( Jr_re, Jr_im );
+                }
+                // Jt^(p,p)
+                Jt[iloc+j] += complex<double>( Jt_re, Jt_im );
+                
+                if( diag_flag ) {
+                    double rho_re( 0. ), rho_im( 0. );
+#pragma unroll(8)
+                    for( int ipart=0 ; ipart<8; ipart++ ) {
+                        rho_re += brho_re[ilocal+ipart];
+                        rho_im += brho_im[ilocal+ipart];
+                    }
+                    rho[iloc+j] += complex<double>( rho_re, rho_im );
+                }
+            }
+        }
+    }
+    
+} // END Project local current densities (Jl, Jr, Jt, sort)
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project for diags and frozen species - mode >= 0
+// ---------------------------------------------------------------------------------------------------------------------
+void ProjectorAM2OrderV::basicForComplex( complex<double> *rhoj, Particles &particles, unsigned int ipart, unsigned int type, int imode )
+{
+    //Warning : this function is not charge conserving.
+    
+    // -------------------------------------
+    // Variable declaration & initialization
+    // -------------------------------------
+    
+    int iloc, nr( nprimr );
+    double charge_weight = inv_cell_volume * ( double )( particles.charge( ipart ) )*particles.weight( ipart );
+    double r = sqrt( particles.position( 1, ipart )*particles.position( 1, ipart )+particles.position( 2, ipart )*particles.position( 2, ipart ) );
+    
+    if( type > 0 ) { //if current density
+        charge_weight *= 1./sqrt( 1.0 + particles.momentum( 0, ipart )*particles.momentum( 0, ipart )
+                                  + particles.momentum( 1, ipart )*particles.momentum( 1, ipart )
+                                  + particles.momentum( 2, ipart )*particles.momentum( 2, ipart ) );
+        if( type == 1 ) { //if Jl
+            charge_weight *= particles.momentum( 0, ipart );
+        } else if( type == 2 ) { //if Jr
+            charge_weight *= ( particles.momentum( 1, ipart )*particles.position( 1, ipart ) + particles.momentum( 2, ipart )*particles.position( 2, ipart ) )/ r ;
+            nr++;
+        } else { //if Jt
+            charge_weight *= ( -particles.momentum( 1, ipart )*particles.position( 2, ipart ) + particles.momentum( 2, ipart )*particles.position( 1, ipart ) ) / r ;
+        }
+    }
+    
+    complex<double> e_theta = ( particles.position( 1, ipart ) + Icpx*particles.position( 2, ipart ) )/r;
+    complex<double> C_m = 1.;
+    if( imode > 0 ) {
+        C_m = 2.;
+    }
+    for( unsigned int i=0; i<( unsigned int )imode; i++ ) {
+        C_m *= e_theta;
+    }
+    
+    double xpn, ypn;
+    double delta, delta2;
+    double Sl1[5], Sr1[5];
+    
+    // --------------------------------------------------------
+    // Locate particles & Calculate Esirkepov coef. S, DS and W
+    // --------------------------------------------------------
+    
+    // locate the particle on the primal grid at current time-step & calculate coeff. S1
+    xpn = particles.position( 0, ipart ) * dl_inv_;
+    int ip = round( xpn + 0.5 * ( type==1 ) );
+    delta  = xpn - ( double )ip;
+    delta2 = delta*delta;
+    Sl1[1] = 0.5 * ( delta2-delta+0.25 );
+    Sl1[2] = 0.75-delta2;
+    Sl1[3] = 0.5 * ( delta2+delta+0.25 );
+    ypn = r * dr_inv_ ;
+    int jp = round( ypn + 0.5*( type==2 ) );
+    delta  = ypn - ( double )jp;
+    delta2 = delta*delta;
+    Sr1[1] = 0.5 * ( delta2-delta+0.25 );
+    Sr1[2] = 0.75-delta2;
+    Sr1[3] = 0.5 * ( delta2+delta+0.25 );
+    
+    // ---------------------------
+    // Calculate the total charge
+    // ---------------------------
+    ip -= i_domain_begin + 2;
+    jp -= j_domain_begin + 2;
+    
+    if( type != 2 ) {
+        for( unsigned int i=1 ; i<4 ; i++ ) {
+            iloc = ( i+ip )*nr+jp;
+            for( unsigned int j=1 ; j<4 ; j++ ) {
+                rhoj [iloc+j] += C_m*charge_weight* Sl1[i]*Sr1[j] * invR[j+jp];
+            }
+        }//i
+    } else {
+        for( unsigned int i=1 ; i<4 ; i++ ) {
+            iloc = ( i+ip )*nr+jp;
+            for( unsigned int j=1 ; j<4 ; j++ ) {
+                rhoj [iloc+j] += C_m*charge_weight* Sl1[i]*Sr1[j] * invRd[j+jp];
+            }
+        }//i
+    }
+} // END Project for diags local current densities
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project global current densities : ionization NOT DONE YET
+// ---------------------------------------------------------------------------------------------------------------------
+void ProjectorAM2OrderV::ionizationCurrents( Field *Jl, Field *Jr, Field *Jt, Particles &particles, int ipart, LocalFields Jion )
+{
+    // As for ProjectorAM2Order, the ionization currents are not projected yet in AM geometry
+    return;
+} // END Project global current densities (ionize)
+
+//------------------------------------//
+//Wrapper for projection
+void ProjectorAM2OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int icell, int ipart_ref )
+{
+    if( is_spectral ) {
+        ERROR( "Not implemented" );
+    }
+    
+    ElectroMagnAM *emAM = static_cast<ElectroMagnAM *>( EMfields );
+    
+    if( istart != iend ) {
+        int iold[2];
+        iold[0] = icell/nscellr+oversize[0];
+        iold[1] = icell%nscellr+oversize[1];
+        
+        int nparts = smpi->dynamics_invgf[ithread].size();
+        double *invgf = &( smpi->dynamics_invgf[ithread][0] );
+        double *delta = &( smpi->dynamics_deltaold[ithread][0] );
+        double *theta_old = &( smpi->dynamics_thetaold[ithread][0] );
+        
+        currents( emAM, particles, istart, iend, invgf, iold, delta, theta_old, nparts, diag_flag, ispec, ipart_ref );
+    }
+    
+    //Boundary conditions for currents on axis, once all the cells of the patch have been projected
+    if( emAM->isYmin && icell == ncells-1 ) {
+        currentsAxisBC( emAM, diag_flag, ispec );
+    }
+}
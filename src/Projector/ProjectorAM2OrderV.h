@@ -0,0 +1,39 @@
+#ifndef PROJECTORAM2ORDERV_H
+#define PROJECTORAM2ORDERV_H
+
+#include <complex>
+#include <vector>
+
+#include "ProjectorAM.h"
+#include "ElectroMagnAM.h"
+
+
+class ProjectorAM2OrderV : public ProjectorAM
+{
+public:
+    ProjectorAM2OrderV( Params &, Patch *patch );
+    ~ProjectorAM2OrderV();
+    
+    //! Project the currents of all modes (and the charge on diag timesteps) for the particles of a cell
+    inline void currents( ElectroMagnAM *emAM, Particles &particles, unsigned int istart, unsigned int iend, double *invgf, int *iold, double *deltaold, double *array_theta_old, int nparts, bool diag_flag, int ispec, int ipart_ref = 0 );
+    
+    //! Project global current charge (EMfields->rho_), frozen & diagFields timestep
+    void basicForComplex( std::complex<double> *rhoj, Particles &particles, unsigned int ipart, unsigned int type, int imode ) override final;
+    
+    //! Project global current densities if Ionization in Species::dynamics,
+    void ionizationCurrents( Field *Jl, Field *Jr, Field *Jt, Particles &particles, int ipart, LocalFields Jion ) override final;
+    
+    //!Wrapper
+    void currentsAndDensityWrapper( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, bool diag_flag, bool is_spectral, int ispec, int icell = 0, int ipart_ref = 0 ) override final;
+    
+private:
+    //! Number of cells along r and in the patch (the cell index of a particle is icell = il*nscellr + ir)
+    int nscellr, ncells;
+    //! Number of ghost cells along l and r
+    int oversize[2];
+    //! Per-mode buffers accumulating the split real and imaginary parts of the currents of a cell, 5x5 nodes x 8 particles each
+    std::vector<double> bJ;
+};
+
+#endif
+
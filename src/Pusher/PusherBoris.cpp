@@ -35,7 +35,7 @@ void PusherBoris::operator()( Particles &particles, SmileiMPI *smpi, int istart,
     double pxsm, pysm, pzsm;
     double local_invgf;
     
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, 0 ) );
     }
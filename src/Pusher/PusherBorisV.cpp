@@ -12,6 +12,8 @@ using namespace std;
 PusherBorisV::PusherBorisV( Params &params, Species *species )
     : Pusher( params, species )
 {
+    push_instance = SimdDispatch::select( params.simd_instruction_set,
+                                          &PusherBorisV::pushGeneric, &PusherBorisV::pushAVX2, &PusherBorisV::pushAVX512 );
 }
 
 PusherBorisV::~PusherBorisV()
@@ -23,6 +25,26 @@ PusherBorisV::~PusherBorisV()
 ***********************************************************************/
 
 void PusherBorisV::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref )
+{
+    ( this->*push_instance )( particles, smpi, istart, iend, ithread, ipart_ref );
+}
+
+void PusherBorisV::pushGeneric( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref )
+{
+    push( particles, smpi, istart, iend, ithread, ipart_ref );
+}
+
+void PusherBorisV::pushAVX2( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref )
+{
+    push( particles, smpi, istart, iend, ithread, ipart_ref );
+}
+
+void PusherBorisV::pushAVX512( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref )
+{
+    push( particles, smpi, istart, iend, ithread, ipart_ref );
+}
+
+void PusherBorisV::push( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref )
 {
     std::vector<double> *Epart = &( smpi->dynamics_Epart[ithread] );
     std::vector<double> *Bpart = &( smpi->dynamics_Bpart[ithread] );
@@ -35,7 +57,7 @@ void PusherBorisV::operator()( Particles &particles, SmileiMPI *smpi, int istart
     
     //int* cell_keys;
     
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, 0 ) );
     }
@@ -22,6 +22,18 @@ public:
     //! Overloading of () operator
     virtual void operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref = 0 );
     
+private:
+    //! Body of the pusher, compiled in each instance below
+    SMILEI_KERNEL_INLINE void push( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref );
+    
+    //! Instances of the pusher for each instruction set (see SimdDispatch.h)
+    void pushGeneric( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref );
+    SMILEI_TARGET_AVX2 void pushAVX2( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref );
+    SMILEI_TARGET_AVX512 void pushAVX512( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref );
+    
+    //! Instance selected at startup
+    void ( PusherBorisV::*push_instance )( Particles &, SmileiMPI *, int, int, int, int );
+    
 };
 
 #endif
@@ -0,0 +1,131 @@
+/*! @file PusherHigueraCaryV.cpp
+
+  @brief PusherHigueraCaryV.cpp  vectorized version of the particle pusher of A.V. Higuera and J.R. Cari.
+
+  @details See article https://arxiv.org/abs/1701.05605
+
+  @date 2026-10-18
+ */
+#include "PusherHigueraCaryV.h"
+
+#include <iostream>
+#include <cmath>
+
+#include "Species.h"
+
+#include "Particles.h"
+
+using namespace std;
+
+PusherHigueraCaryV::PusherHigueraCaryV( Params &params, Species *species )
+    : Pusher( params, species )
+{
+}
+
+PusherHigueraCaryV::~PusherHigueraCaryV()
+{
+}
+
+/***********************************************************************
+  Lorentz Force -- leap-frog (HigueraCary) scheme
+ ***********************************************************************/
+
+void PusherHigueraCaryV::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref )
+{
+    std::vector<double> *Epart = &( smpi->dynamics_Epart[ithread] );
+    std::vector<double> *Bpart = &( smpi->dynamics_Bpart[ithread] );
+    double *invgf = &( smpi->dynamics_invgf[ithread][0] );
+    
+    pdouble *momentum[3];
+    for( int i = 0 ; i<3 ; i++ ) {
+        momentum[i] =  &( particles.momentum( i, 0 ) );
+    }
+    double *position[3];
+    for( int i = 0 ; i<nDim_ ; i++ ) {
+        position[i] =  &( particles.position( i, 0 ) );
+    }
+#ifdef  __DEBUG
+    double *position_old[3];
+    for( int i = 0 ; i<nDim_ ; i++ ) {
+        position_old[i] =  &( particles.position_old( i, 0 ) );
+    }
+#endif
+    short *charge = &( particles.charge( 0 ) );
+    
+    int nparts = Epart->size()/3;
+    double *Ex = &( ( *Epart )[0*nparts] );
+    double *Ey = &( ( *Epart )[1*nparts] );
+    double *Ez = &( ( *Epart )[2*nparts] );
+    double *Bx = &( ( *Bpart )[0*nparts] );
+    double *By = &( ( *Bpart )[1*nparts] );
+    double *Bz = &( ( *Bpart )[2*nparts] );
+    
+    vector<double> dcharge( nparts );
+    for( int ipart=istart ; ipart<iend; ipart++ ) {
+        dcharge[ipart-ipart_ref] = ( double )( charge[ipart] );
+    }
+    
+    #pragma omp simd
+    for( int ipart=istart ; ipart<iend; ipart++ ) {
+        double psm[3], um[3];
+        
+        double charge_over_mass_dts2 = dcharge[ipart-ipart_ref]*one_over_mass_*dts2;
+        
+        // init Half-acceleration in the electric field
+        psm[0] = charge_over_mass_dts2*( *( Ex+ipart-ipart_ref ) );
+        psm[1] = charge_over_mass_dts2*( *( Ey+ipart-ipart_ref ) );
+        psm[2] = charge_over_mass_dts2*( *( Ez+ipart-ipart_ref ) );
+        
+        um[0] = momentum[0][ipart] + psm[0];
+        um[1] = momentum[1][ipart] + psm[1];
+        um[2] = momentum[2][ipart] + psm[2];
+        
+        // Intermediate gamma factor: only this part differs from the Boris scheme
+        // Square Gamma factor from um
+        double gfm2 = ( 1.0 + um[0]*um[0] + um[1]*um[1] + um[2]*um[2] );
+        
+        // Equivalent of betax,betay,betaz in the paper
+        double Tx    = charge_over_mass_dts2 * ( *( Bx+ipart-ipart_ref ) );
+        double Ty    = charge_over_mass_dts2 * ( *( By+ipart-ipart_ref ) );
+        double Tz    = charge_over_mass_dts2 * ( *( Bz+ipart-ipart_ref ) );
+        
+        // beta**2
+        double beta2 = Tx*Tx + Ty*Ty + Tz*Tz;
+        double Tu    = Tx*um[0] + Ty*um[1] + Tz*um[2];
+        
+        // Equivalent of 1/\gamma_{new} in the paper
+        double local_invgf = 1./sqrt( 0.5*( gfm2 - beta2 +
+                                            sqrt( ( gfm2 - beta2 )*( gfm2 - beta2 ) + 4.0*( beta2 + Tu*Tu ) ) ) );
+                                            
+        // Rotation in the magnetic field
+        Tx    *= local_invgf;
+        Ty    *= local_invgf;
+        Tz    *= local_invgf;
+        double inv_det_T = 1.0/( 1.0+Tx*Tx+Ty*Ty+Tz*Tz );
+        
+        // finalize Half-acceleration in the electric field
+        psm[0] += ( ( 1.0+Tx*Tx-Ty*Ty-Tz*Tz )* um[0]  +      2.0*( Tx*Ty+Tz )* um[1]  +      2.0*( Tz*Tx-Ty )* um[2] )*inv_det_T;
+        psm[1] += ( 2.0*( Tx*Ty-Tz )* um[0]  + ( 1.0-Tx*Tx+Ty*Ty-Tz*Tz )* um[1]  +      2.0*( Ty*Tz+Tx )* um[2] )*inv_det_T;
+        psm[2] += ( 2.0*( Tz*Tx+Ty )* um[0]  +      2.0*( Ty*Tz-Tx )* um[1]  + ( 1.0-Tx*Tx-Ty*Ty+Tz*Tz )* um[2] )*inv_det_T;
+        
+        // final gamma factor
+        local_invgf = 1. / sqrt( 1.0 + psm[0]*psm[0] + psm[1]*psm[1] + psm[2]*psm[2] );
+        invgf[ipart-ipart_ref] = local_invgf;
+        
+        momentum[0][ipart] = psm[0];
+        momentum[1][ipart] = psm[1];
+        momentum[2][ipart] = psm[2];
+        
+        // Move the particle
+#ifdef  __DEBUG
+        for( int i = 0 ; i<nDim_ ; i++ ) {
+            position_old[i][ipart] = position[i][ipart];
+        }
+#endif
+        local_invgf *= dt;
+        for( int i = 0 ; i<nDim_ ; i++ ) {
+            position[i][ipart]     += psm[i]*local_invgf;
+        }
+    }
+    
+}
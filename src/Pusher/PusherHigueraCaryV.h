@@ -0,0 +1,29 @@
+/*! @file PusherHigueraCaryV.h
+
+  @brief PusherHigueraCaryV.h  vectorized version of the particle pusher of A.V. Higuera and J.R. Cari.
+
+  @details See article https://arxiv.org/abs/1701.05605
+
+  @date 2026-10-18
+ */
+
+#ifndef PUSHERHIGUERACARYV_H
+#define PUSHERHIGUERACARYV_H
+
+#include "Pusher.h"
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class PusherHigueraCaryV
+//  --------------------------------------------------------------------------------------------------------------------
+class PusherHigueraCaryV : public Pusher
+{
+public:
+    //! Creator for Pusher
+    PusherHigueraCaryV( Params &params, Species *species );
+    ~PusherHigueraCaryV();
+    //! Overloading of () operator
+    virtual void operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref = 0 );
+    
+};
+
+#endif
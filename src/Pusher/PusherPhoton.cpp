@@ -35,7 +35,7 @@ void PusherPhoton::operator()( Particles &particles, SmileiMPI *smpi,
     // Inverse normalized energy
     std::vector<double> *invgf = &( smpi->dynamics_invgf[ithread] );
     
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, 0 ) );
     }
@@ -35,7 +35,7 @@ void PusherPonderomotiveBorisV::operator()( Particles &particles, SmileiMPI *smp
     double TxTy, TyTz, TzTx;
     double one_ov_gamma_ponderomotive;
     
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, 0 ) );
     }
@@ -34,7 +34,7 @@ void PusherPonderomotivePositionBoris::operator()( Particles &particles, SmileiM
     double gamma0, gamma0_sq, gamma_ponderomotive;
     double pxsm, pysm, pzsm;
     
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, 0 ) );
     }
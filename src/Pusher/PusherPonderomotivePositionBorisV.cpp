@@ -35,7 +35,7 @@ void PusherPonderomotivePositionBorisV::operator()( Particles &particles, Smilei
     
     //int* cell_keys;
     
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, 0 ) );
     }
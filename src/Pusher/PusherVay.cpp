@@ -46,7 +46,7 @@ void PusherVay::operator()( Particles &particles, SmileiMPI *smpi, int istart, i
     //double Tx2, Ty2, Tz2;
     //double TxTy, TyTz, TzTx;
     
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, 0 ) );
     }
@@ -0,0 +1,140 @@
+/*! @file PusherVayV.cpp
+
+ @brief PusherVayV.cpp  vectorized version of the particle pusher of J.L. Vay.
+
+ #details The description of the J.L. Vay pusher can be found in this reference:
+          http://dx.doi.org/10.1063/1.2837054
+
+ @date 2026-10-18
+*/
+#include "PusherVayV.h"
+
+#include <iostream>
+#include <cmath>
+
+#include "Species.h"
+
+#include "Particles.h"
+
+using namespace std;
+
+PusherVayV::PusherVayV( Params &params, Species *species )
+    : Pusher( params, species )
+{
+}
+
+PusherVayV::~PusherVayV()
+{
+}
+
+/***********************************************************************
+    Lorentz Force -- leap-frog (Vay) scheme
+***********************************************************************/
+
+void PusherVayV::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_ref )
+{
+    std::vector<double> *Epart = &( smpi->dynamics_Epart[ithread] );
+    std::vector<double> *Bpart = &( smpi->dynamics_Bpart[ithread] );
+    double *invgf = &( smpi->dynamics_invgf[ithread][0] );
+    
+    pdouble *momentum[3];
+    for( int i = 0 ; i<3 ; i++ ) {
+        momentum[i] =  &( particles.momentum( i, 0 ) );
+    }
+    double *position[3];
+    for( int i = 0 ; i<nDim_ ; i++ ) {
+        position[i] =  &( particles.position( i, 0 ) );
+    }
+#ifdef  __DEBUG
+    double *position_old[3];
+    for( int i = 0 ; i<nDim_ ; i++ ) {
+        position_old[i] =  &( particles.position_old( i, 0 ) );
+    }
+#endif
+    short *charge = &( particles.charge( 0 ) );
+    
+    int nparts = Epart->size()/3;
+    double *Ex = &( ( *Epart )[0*nparts] );
+    double *Ey = &( ( *Epart )[1*nparts] );
+    double *Ez = &( ( *Epart )[2*nparts] );
+    double *Bx = &( ( *Bpart )[0*nparts] );
+    double *By = &( ( *Bpart )[1*nparts] );
+    double *Bz = &( ( *Bpart )[2*nparts] );
+    
+    vector<double> dcharge( nparts );
+    for( int ipart=istart ; ipart<iend; ipart++ ) {
+        dcharge[ipart-ipart_ref] = ( double )( charge[ipart] );
+    }
+    
+    #pragma omp simd
+    for( int ipart=istart ; ipart<iend; ipart++ ) {
+        double charge_over_mass_dts2 = dcharge[ipart-ipart_ref]*one_over_mass_*dts2;
+        
+        // ____________________________________________
+        // Part I: Computation of uprime
+        
+        double local_invgf = 1./sqrt( 1.0 + momentum[0][ipart]*momentum[0][ipart]
+                                      + momentum[1][ipart]*momentum[1][ipart]
+                                      + momentum[2][ipart]*momentum[2][ipart] );
+                                      
+        // Add Electric field
+        double upx = momentum[0][ipart] + 2.*charge_over_mass_dts2*( *( Ex+ipart-ipart_ref ) );
+        double upy = momentum[1][ipart] + 2.*charge_over_mass_dts2*( *( Ey+ipart-ipart_ref ) );
+        double upz = momentum[2][ipart] + 2.*charge_over_mass_dts2*( *( Ez+ipart-ipart_ref ) );
+        
+        // Add magnetic field
+        double Tx  = charge_over_mass_dts2* ( *( Bx+ipart-ipart_ref ) );
+        double Ty  = charge_over_mass_dts2* ( *( By+ipart-ipart_ref ) );
+        double Tz  = charge_over_mass_dts2* ( *( Bz+ipart-ipart_ref ) );
+        
+        upx += local_invgf*( momentum[1][ipart]*Tz - momentum[2][ipart]*Ty );
+        upy += local_invgf*( momentum[2][ipart]*Tx - momentum[0][ipart]*Tz );
+        upz += local_invgf*( momentum[0][ipart]*Ty - momentum[1][ipart]*Tx );
+        
+        // alpha is gamma^2
+        double alpha = 1.0 + upx*upx + upy*upy + upz*upz;
+        double T2    = Tx*Tx + Ty*Ty + Tz*Tz;
+        
+        // ___________________________________________
+        // Part II: Computation of Gamma^{i+1}
+        
+        // s is sigma
+        double s     = alpha - T2;
+        double us    = upx*Tx + upy*Ty + upz*Tz;
+        
+        // alpha becomes 1/gamma^{i+1}
+        alpha = 1.0/sqrt( 0.5*( s + sqrt( s*s + 4.0*( T2 + us*us ) ) ) );
+        
+        Tx *= alpha;
+        Ty *= alpha;
+        Tz *= alpha;
+        
+        s = 1.0/( 1.0+Tx*Tx+Ty*Ty+Tz*Tz );
+        alpha   = upx*Tx + upy*Ty + upz*Tz;
+        
+        double psm[3];
+        psm[0] = s*( upx + alpha*Tx + Tz*upy - Ty*upz );
+        psm[1] = s*( upy + alpha*Ty + Tx*upz - Tz*upx );
+        psm[2] = s*( upz + alpha*Tz + Ty*upx - Tx*upy );
+        
+        // Inverse Gamma factor
+        local_invgf = 1.0 / sqrt( 1.0 + psm[0]*psm[0] + psm[1]*psm[1] + psm[2]*psm[2] );
+        invgf[ipart-ipart_ref] = local_invgf;
+        
+        momentum[0][ipart] = psm[0];
+        momentum[1][ipart] = psm[1];
+        momentum[2][ipart] = psm[2];
+        
+        // Move the particle
+#ifdef  __DEBUG
+        for( int i = 0 ; i<nDim_ ; i++ ) {
+            position_old[i][ipart] = position[i][ipart];
+        }
+#endif
+        local_invgf *= dt;
+        for( int i = 0 ; i<nDim_ ; i++ ) {
+            position[i][ipart]     += psm[i]*local_invgf;
+        }
+    }
+    
+}
@@ -180,6 +180,7 @@ class Main(SmileiSingleton):
     patch_arrangement = "hilbertian"
     clrw = -1
     every_clean_particles_overhead = 100
+    reconstruct_old_positions = False
     timestep = None
     number_of_AM = 2
     number_of_AM_relativistic_field_initialization = 1
@@ -203,6 +204,9 @@ class Main(SmileiSingleton):
 
     # Default fields
     maxwell_solver = 'Yee'
+    maxwell_tile_size = 0
+    field_padding = False
+    aggregate_field_exchanges = False
     EM_boundary_conditions = [["periodic"]]
     EM_boundary_conditions_k = []
     save_magnectic_fields_for_SM = True
@@ -301,6 +305,9 @@ class Vectorization(SmileiSingleton):
     mode                = "off"
     reconfigure_every   = 20
     initial_mode        = "off"
+    incremental_sort_threshold = 0.3
+    fused_kernel        = False
+    instruction_set     = "auto"
 
 
 class MovingWindow(SmileiSingleton):
@@ -327,6 +334,7 @@ class CurrentFilter(SmileiSingleton):
     """Current filtering parameters"""
     model = "binomial"
     passes = 0
+    compensation = False
 
 class FieldFilter(SmileiSingleton):
     """Fields filtering parameters"""
@@ -368,6 +376,13 @@ class Species(SmileiComponent):
     is_test = False
     relativistic_field_initialization = False
     ponderomotive_dynamics = False
+    sort_kernel = "incremental"
+    merging_method = "none"
+    merge_every = 0
+    merge_min_particles_per_cell = 8
+    merge_min_packet_size = 4
+    merge_max_packet_size = 4
+    merge_momentum_cell_size = [16,16,16]
 
 class Laser(SmileiComponent):
     """Laser parameters"""
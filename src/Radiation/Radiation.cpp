@@ -81,7 +81,7 @@ void Radiation::computeParticlesChi( Particles &particles,
     double gamma;
     
     // Momentum shortcut
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, 0 ) );
     }
@@ -90,7 +90,7 @@ void Radiation::computeParticlesChi( Particles &particles,
     short *charge = &( particles.charge( 0 ) );
     
     // Quantum parameter
-    double *chi = &( particles.chi( 0 ) );
+    pdouble *chi = &( particles.chi( 0 ) );
     
     // _______________________________________________________________
     // Computation
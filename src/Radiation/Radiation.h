@@ -63,7 +63,7 @@ public:
     //! \param Bz z component of the particle magnetic field
     //#pragma omp declare simd
     double inline computeParticleChi( double &charge_over_mass2,
-                                      double &px, double &py, double &pz,
+                                      double px, double py, double pz,
                                       double &gamma,
                                       double &Ex, double &Ey, double &Ez,
                                       double &Bx, double &By, double &Bz )
@@ -85,7 +85,7 @@ void RadiationCorrLandauLifshitz::operator()(
     double temp;
     
     // Momentum shortcut
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, 0 ) );
     }
@@ -94,7 +94,7 @@ void RadiationCorrLandauLifshitz::operator()(
     short *charge = &( particles.charge( 0 ) );
     
     // Weight shortcut
-    double *weight = &( particles.weight( 0 ) );
+    pdouble *weight = &( particles.weight( 0 ) );
     
     // Optical depth for the Monte-Carlo process
     // double* chi = &( particles.chi(0));
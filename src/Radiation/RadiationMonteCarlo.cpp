@@ -99,7 +99,7 @@ void RadiationMonteCarlo::operator()(
     int mc_it_nb;
     
     // Momentum shortcut
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, 0 ) );
     }
@@ -114,10 +114,10 @@ void RadiationMonteCarlo::operator()(
     short *charge = &( particles.charge( 0 ) );
     
     // Weight shortcut
-    double *weight = &( particles.weight( 0 ) );
+    pdouble *weight = &( particles.weight( 0 ) );
     
     // Optical depth for the Monte-Carlo process
-    double *tau = &( particles.tau( 0 ) );
+    pdouble *tau = &( particles.tau( 0 ) );
     
     // Optical depth for the Monte-Carlo process
     // double* chi = &( particles.chi(0));
@@ -267,8 +267,8 @@ void RadiationMonteCarlo::photonEmission( int ipart,
         double &particle_chi,
         double &particle_gamma,
         double *position[3],
-        double *momentum[3],
-        double *weight,
+        pdouble *momentum[3],
+        pdouble *weight,
         Species *photon_species,
         RadiationTables &RadiationTables )
 {
@@ -68,8 +68,8 @@ public:
                          double &particle_chi,
                          double &particle_gamma,
                          double *position[3],
-                         double *momentum[3],
-                         double *weight,
+                         pdouble *momentum[3],
+                         pdouble *weight,
                          Species *photon_species,
                          RadiationTables &RadiationTables );
                          
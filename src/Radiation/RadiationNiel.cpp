@@ -99,7 +99,7 @@ void RadiationNiel::operator()(
     double random_numbers[nbparticles];
     
     // Momentum shortcut
-    double *momentum[3];
+    pdouble *momentum[3];
     for( int i = 0 ; i<3 ; i++ ) {
         momentum[i] =  &( particles.momentum( i, istart ) );
     }
@@ -108,10 +108,10 @@ void RadiationNiel::operator()(
     short *charge = &( particles.charge( istart ) );
     
     // Weight shortcut
-    double *weight = &( particles.weight( istart ) );
+    pdouble *weight = &( particles.weight( istart ) );
     
     // Quantum parameter
-    double *particle_chi = &( particles.chi( istart ) );
+    pdouble *particle_chi = &( particles.chi( istart ) );
     
     // Reinitialize the cumulative radiated energy for the current thread
     radiated_energy_ = 0.;
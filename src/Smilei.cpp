@@ -276,6 +276,11 @@ int main( int argc, char *argv[] )
     //if (global_factor!=1) {
     domain.build( params, &smpi, vecPatches, openPMD );
     //}
+#else
+    // The native spectral solver works on the Domain grid
+    if( params.is_spectral ) {
+        domain.build( params, &smpi, vecPatches, openPMD );
+    }
 #endif
     
     timers.global.reboot();
@@ -397,7 +402,15 @@ int main( int argc, char *argv[] )
             //if ( global_factor==1 )
             {
                 if( time_dual > params.time_fields_frozen ) {
-                    vecPatches.solveMaxwell( params, simWindow, itime, time_dual, timers, &smpi );
+                    if( !params.is_spectral ) {
+                        vecPatches.solveMaxwell( params, simWindow, itime, time_dual, timers, &smpi );
+                    } else {
+                        #pragma omp single
+                        SyncCartesianPatch::patchedToCartesian( vecPatches, domain, params, &smpi, timers, itime );
+                        domain.solveMaxwell( params, simWindow, itime, time_dual, timers, &smpi );
+                        #pragma omp single
+                        SyncCartesianPatch::cartesianToPatches( domain, vecPatches, params, &smpi, timers, itime );
+                    }
                 }
             }
 #else
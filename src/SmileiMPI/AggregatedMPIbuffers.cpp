@@ -0,0 +1,278 @@
+#include "AggregatedMPIbuffers.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Field.h"
+#include "Patch.h"
+#include "VectorPatch.h"
+
+using namespace std;
+
+AggregatedMPIbuffers::AggregatedMPIbuffers( vector<Field *> &fields, VectorPatch &vecPatches, int iDim, bool sum, int tag, MPI_Comm comm ) :
+    name_( fields[0]->name ),
+    ncomp_( fields.size()/vecPatches.size() ),
+    iDim_( iDim ),
+    sum_( sum ),
+    tag_( tag ),
+    comm_( comm )
+{
+    build( fields, vecPatches );
+}
+
+
+AggregatedMPIbuffers::~AggregatedMPIbuffers()
+{
+    freeRequests();
+}
+
+
+bool AggregatedMPIbuffers::isFor( vector<Field *> &fields, unsigned int nPatches, int iDim, bool sum )
+{
+    return fields.size()==ncomp_*nPatches && fields[0]->name==name_ && iDim==iDim_ && sum==sum_;
+}
+
+
+void AggregatedMPIbuffers::update( vector<Field *> &fields, VectorPatch &vecPatches )
+{
+    vector<int> sig;
+    signature( vecPatches, sig );
+    if( fields != fields_ || sig != signature_ ) {
+        build( fields, vecPatches );
+    }
+}
+
+
+void AggregatedMPIbuffers::signature( VectorPatch &vecPatches, vector<int> &sig )
+{
+    sig.clear();
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+        Patch *patch = vecPatches( ipatch );
+        sig.push_back( patch->hindex );
+        for( unsigned int iDim=0 ; iDim<patch->neighbor_.size() ; iDim++ ) {
+            for( int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++ ) {
+                sig.push_back( patch->neighbor_[iDim][iNeighbor] );
+                sig.push_back( patch->MPI_neighbor_[iDim][iNeighbor] );
+            }
+        }
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// List the faces sent and received by all the patches, in the same boxes as Patch::initExchange and
+// Patch::initSumField, and bind the buffers of each neighboring MPI process to persistent requests
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::build( vector<Field *> &fields, VectorPatch &vecPatches )
+{
+    freeRequests();
+    send_faces_.clear();
+    recv_faces_.clear();
+    recv_groups_.assign( 1, 0 );
+    
+    fields_ = fields;
+    signature( vecPatches, signature_ );
+    
+    unsigned int nPatches = vecPatches.size();
+    unsigned int nComp = fields.size()/nPatches;
+    unsigned int nDim = fields[0]->dims_.size();
+    const vector<unsigned int> &oversize = vecPatches( 0 )->EMfields->oversize;
+    
+    unsigned int dimStart = iDim_<0 ? 0    : iDim_;
+    unsigned int dimEnd   = iDim_<0 ? nDim : iDim_+1;
+    
+    for( unsigned int icomp=0 ; icomp<nComp ; icomp++ ) {
+        for( unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++ ) {
+            Patch *patch = vecPatches( ipatch );
+            Field *field = fields[icomp*nPatches+ipatch];
+            
+            for( unsigned int iDim=dimStart ; iDim<dimEnd ; iDim++ ) {
+                for( int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++ ) {
+                    if( !patch->is_a_MPI_neighbor( iDim, iNeighbor ) ) {
+                        continue;
+                    }
+                    
+                    Face send, recv;
+                    send.field = field;
+                    for( unsigned int i=0 ; i<3 ; i++ ) {
+                        send.start[i] = 0;
+                        send.size[i] = i<nDim ? field->dims_[i] : 1;
+                    }
+                    recv = send;
+                    
+                    unsigned int n = field->dims_[iDim];
+                    unsigned int ghost = 2*oversize[iDim] + 1 + field->isDual_[iDim];
+                    if( sum_ ) {
+                        send.start[iDim] = iNeighbor * ( n - ghost );
+                        send.size [iDim] = ghost;
+                        recv.start[iDim] = iNeighbor * ( n - ghost );
+                        recv.size [iDim] = ghost;
+                    } else {
+                        send.start[iDim] = iNeighbor * ( n - ghost ) + ( 1-iNeighbor ) * ( oversize[iDim] + 1 + field->isDual_[iDim] );
+                        send.size [iDim] = oversize[iDim];
+                        recv.start[iDim] = iNeighbor * ( n - oversize[iDim] );
+                        recv.size [iDim] = oversize[iDim];
+                    }
+                    
+                    // The face sent by the patch h through its side s is received by its neighbor through the side 1-s
+                    send.rank = patch->MPI_neighbor_[iDim][iNeighbor];
+                    recv.rank = send.rank;
+                    long long prefix = ( long long )( icomp*3 + iDim ) << 33;
+                    send.key = prefix + 2*( long long )patch->hindex + iNeighbor;
+                    recv.key = prefix + 2*( long long )patch->neighbor_[iDim][iNeighbor] + ( 1-iNeighbor );
+                    
+                    send_faces_.push_back( send );
+                    recv_faces_.push_back( recv );
+                }
+            }
+            if( recv_faces_.size() > recv_groups_.back() ) {
+                recv_groups_.push_back( recv_faces_.size() );
+            }
+        }
+    }
+    
+    send_buffer_.resize( layout( send_faces_, send_ranks_, send_counts_, send_displs_ ) );
+    recv_buffer_.resize( layout( recv_faces_, recv_ranks_, recv_counts_, recv_displs_ ) );
+    
+    send_requests_.resize( send_ranks_.size() );
+    for( unsigned int irank=0 ; irank<send_ranks_.size() ; irank++ ) {
+        MPI_Send_init( &send_buffer_[send_displs_[irank]], send_counts_[irank], MPI_FDOUBLE, send_ranks_[irank], tag_, comm_, &send_requests_[irank] );
+    }
+    recv_requests_.resize( recv_ranks_.size() );
+    for( unsigned int irank=0 ; irank<recv_ranks_.size() ; irank++ ) {
+        MPI_Recv_init( &recv_buffer_[recv_displs_[irank]], recv_counts_[irank], MPI_FDOUBLE, recv_ranks_[irank], tag_, comm_, &recv_requests_[irank] );
+    }
+}
+
+
+unsigned int AggregatedMPIbuffers::layout( vector<Face> &faces, vector<int> &ranks, vector<int> &counts, vector<int> &displs )
+{
+    vector<unsigned int> order( faces.size() );
+    for( unsigned int iface=0 ; iface<faces.size() ; iface++ ) {
+        order[iface] = iface;
+    }
+    sort( order.begin(), order.end(), [&faces]( unsigned int a, unsigned int b ) {
+        return faces[a].rank < faces[b].rank || ( faces[a].rank == faces[b].rank && faces[a].key < faces[b].key );
+    } );
+    
+    ranks.clear();
+    counts.clear();
+    displs.clear();
+    unsigned int offset = 0;
+    for( unsigned int i=0 ; i<order.size() ; i++ ) {
+        Face &face = faces[order[i]];
+        if( ranks.size()==0 || ranks.back()!=face.rank ) {
+            ranks.push_back( face.rank );
+            counts.push_back( 0 );
+            displs.push_back( offset );
+        }
+        face.offset = offset;
+        unsigned int size = face.size[0]*face.size[1]*face.size[2];
+        counts.back() += size;
+        offset += size;
+    }
+    return offset;
+}
+
+
+void AggregatedMPIbuffers::freeRequests()
+{
+    for( unsigned int i=0 ; i<send_requests_.size() ; i++ ) {
+        MPI_Request_free( &send_requests_[i] );
+    }
+    for( unsigned int i=0 ; i<recv_requests_.size() ; i++ ) {
+        MPI_Request_free( &recv_requests_[i] );
+    }
+    send_requests_.clear();
+    recv_requests_.clear();
+}
+
+
+void AggregatedMPIbuffers::init()
+{
+    startRecv();
+    for( unsigned int iface=0 ; iface<nSendFaces() ; iface++ ) {
+        pack( iface );
+    }
+    startSend();
+}
+
+
+void AggregatedMPIbuffers::finalize()
+{
+    waitAll();
+    for( unsigned int igroup=0 ; igroup<nRecvGroups() ; igroup++ ) {
+        unpack( igroup );
+    }
+}
+
+
+void AggregatedMPIbuffers::startRecv()
+{
+    if( recv_requests_.size() > 0 ) {
+        MPI_Startall( recv_requests_.size(), &recv_requests_[0] );
+    }
+}
+
+
+void AggregatedMPIbuffers::startSend()
+{
+    if( send_requests_.size() > 0 ) {
+        MPI_Startall( send_requests_.size(), &send_requests_[0] );
+    }
+}
+
+
+void AggregatedMPIbuffers::waitAll()
+{
+    if( recv_requests_.size() > 0 ) {
+        MPI_Waitall( recv_requests_.size(), &recv_requests_[0], MPI_STATUSES_IGNORE );
+    }
+    if( send_requests_.size() > 0 ) {
+        MPI_Waitall( send_requests_.size(), &send_requests_[0], MPI_STATUSES_IGNORE );
+    }
+}
+
+
+void AggregatedMPIbuffers::pack( unsigned int iface )
+{
+    Face &face = send_faces_[iface];
+    Field *field = face.field;
+    unsigned int ny = field->paddedDims_.size()>1 ? field->paddedDims_[1] : 1;
+    unsigned int nz = field->paddedDims_.size()>2 ? field->paddedDims_[2] : 1;
+    
+    fdouble *buffer = &send_buffer_[face.offset];
+    for( unsigned int i=0 ; i<face.size[0] ; i++ ) {
+        for( unsigned int j=0 ; j<face.size[1] ; j++ ) {
+            fdouble *row = &field->data_[( ( face.start[0]+i )*ny + face.start[1]+j )*nz + face.start[2]];
+            memcpy( buffer, row, face.size[2]*sizeof( fdouble ) );
+            buffer += face.size[2];
+        }
+    }
+}
+
+
+void AggregatedMPIbuffers::unpack( unsigned int igroup )
+{
+    for( unsigned int iface=recv_groups_[igroup] ; iface<recv_groups_[igroup+1] ; iface++ ) {
+        Face &face = recv_faces_[iface];
+        Field *field = face.field;
+        unsigned int ny = field->paddedDims_.size()>1 ? field->paddedDims_[1] : 1;
+        unsigned int nz = field->paddedDims_.size()>2 ? field->paddedDims_[2] : 1;
+        
+        fdouble *buffer = &recv_buffer_[face.offset];
+        for( unsigned int i=0 ; i<face.size[0] ; i++ ) {
+            for( unsigned int j=0 ; j<face.size[1] ; j++ ) {
+                fdouble *row = &field->data_[( ( face.start[0]+i )*ny + face.start[1]+j )*nz + face.start[2]];
+                if( sum_ ) {
+                    for( unsigned int k=0 ; k<face.size[2] ; k++ ) {
+                        row[k] += buffer[k];
+                    }
+                } else {
+                    memcpy( row, buffer, face.size[2]*sizeof( fdouble ) );
+                }
+                buffer += face.size[2];
+            }
+        }
+    }
+}
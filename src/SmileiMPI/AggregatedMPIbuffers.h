@@ -0,0 +1,105 @@
+#ifndef AGGREGATEDMPIBUFFERS_H
+#define AGGREGATEDMPIBUFFERS_H
+
+#include <mpi.h>
+#include <vector>
+#include <string>
+
+#include "Tools.h"
+
+class Field;
+class VectorPatch;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class AggregatedMPIbuffers : MPI messages of one phase of a field synchronization, aggregated per MPI process
+//! The ghost cells of all the patches and components exchanged with a given MPI process are packed in a single
+//! buffer, sent and received through persistent requests kept from one call to the next (Main.aggregate_field_exchanges).
+//! In a buffer, the faces are ordered by component, direction, hindex of the sending patch and side,
+//! so that both MPI processes of a pair compute the same layout from their own patches.
+//  --------------------------------------------------------------------------------------------------------------------
+class AggregatedMPIbuffers
+{
+public:
+    //! fields : nComp components for all the patches of vecPatches (component after component)
+    //! iDim : direction of the exchange, -1 for all directions at once
+    //! sum : the ghost cells are summed (densities) instead of copied
+    AggregatedMPIbuffers( std::vector<Field *> &fields, VectorPatch &vecPatches, int iDim, bool sum, int tag, MPI_Comm comm );
+    ~AggregatedMPIbuffers();
+    
+    //! True if these buffers are used to synchronize these fields, with the same direction and operation
+    //! (the number of components is compared, not the number of patches, which changes with the load balancing)
+    bool isFor( std::vector<Field *> &fields, unsigned int nPatches, int iDim, bool sum );
+    //! Rebuild the buffers and the requests if the fields or the MPI neighbors of the patches changed
+    void update( std::vector<Field *> &fields, VectorPatch &vecPatches );
+    
+    //! Start the receptions, pack and start the sends
+    void init();
+    //! Wait for all the communications and unpack
+    void finalize();
+    
+    //! Steps of init and finalize, the loops on the faces and groups being shared between threads by the caller
+    void startRecv();
+    void startSend();
+    void waitAll();
+    inline unsigned int nSendFaces()
+    {
+        return send_faces_.size();
+    }
+    inline unsigned int nRecvGroups()
+    {
+        return recv_groups_.size()-1;
+    }
+    //! Copy a face of a patch in the send buffer
+    void pack( unsigned int iface );
+    //! Copy (or add) all the faces received by one component of one patch
+    void unpack( unsigned int igroup );
+    
+private:
+    //! Part of a Field exchanged with another MPI process
+    struct Face {
+        Field *field;
+        unsigned int start[3];
+        unsigned int size[3];
+        //! Rank of the other MPI process, and position of the face in its buffer
+        int rank;
+        long long key;
+        unsigned int offset;
+    };
+    
+    //! List the faces, sort them in the buffers and create the persistent requests
+    void build( std::vector<Field *> &fields, VectorPatch &vecPatches );
+    //! Free the persistent requests
+    void freeRequests();
+    //! Hindexes and MPI neighbors of all patches, to detect a change of the decomposition
+    void signature( VectorPatch &vecPatches, std::vector<int> &sig );
+    //! Order the faces in per-rank buffers, return the buffer size
+    static unsigned int layout( std::vector<Face> &faces, std::vector<int> &ranks, std::vector<int> &counts, std::vector<int> &displs );
+    
+    //! Name of the first field, number of components, direction and operation
+    std::string name_;
+    unsigned int ncomp_;
+    int iDim_;
+    bool sum_;
+    
+    //! Fields and patches for which the buffers were built
+    std::vector<Field *> fields_;
+    std::vector<int> signature_;
+    
+    int tag_;
+    MPI_Comm comm_;
+    
+    std::vector<Face> send_faces_;
+    std::vector<Face> recv_faces_;
+    //! recv_faces_[recv_groups_[i]:recv_groups_[i+1]] are the faces received by one component of one patch
+    std::vector<unsigned int> recv_groups_;
+    
+    //! One message per neighboring MPI process
+    std::vector<int> send_ranks_, send_counts_, send_displs_;
+    std::vector<int> recv_ranks_, recv_counts_, recv_displs_;
+    std::vector<fdouble> send_buffer_, recv_buffer_;
+    std::vector<MPI_Request> send_requests_, recv_requests_;
+    
+};
+
+#endif
+
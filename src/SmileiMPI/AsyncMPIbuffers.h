@@ -27,7 +27,7 @@ public:
     std::vector< std::vector<MPI_Request> > srequest;
     //! ndim vectors of 2 received requests (1 per direction)
     std::vector< std::vector<MPI_Request> > rrequest;
-    std::vector< double >  buf[3][2];
+    std::vector< fdouble >  buf[3][2];
     std::vector< std::complex<double> >  ibuf[3][2];
     
     std::vector< std::vector<int> > send_tags_, recv_tags_;
@@ -137,8 +137,10 @@ void SmileiMPI::init( Params &params, DomainDecomposition *domain_decomposition
     dynamics_Epart.resize( omp_get_max_threads() );
     dynamics_Bpart.resize( omp_get_max_threads() );
     dynamics_invgf.resize( omp_get_max_threads() );
-    dynamics_iold.resize( omp_get_max_threads() );
-    dynamics_deltaold.resize( omp_get_max_threads() );
+    if( !params.reconstruct_old_positions ) {
+        dynamics_iold.resize( omp_get_max_threads() );
+        dynamics_deltaold.resize( omp_get_max_threads() );
+    }
     if( params.geometry == "AMcylindrical" ) {
         dynamics_thetaold.resize( omp_get_max_threads() );
     }
@@ -154,8 +156,10 @@ void SmileiMPI::init( Params &params, DomainDecomposition *domain_decomposition
     dynamics_Epart.resize( 1 );
     dynamics_Bpart.resize( 1 );
     dynamics_invgf.resize( 1 );
-    dynamics_iold.resize( 1 );
-    dynamics_deltaold.resize( 1 );
+    if( !params.reconstruct_old_positions ) {
+        dynamics_iold.resize( 1 );
+        dynamics_deltaold.resize( 1 );
+    }
     if( params.geometry == "AMcylindrical" ) {
         dynamics_thetaold.resize( 1 );
     }
@@ -572,17 +576,23 @@ int SmileiMPI::hrank( int h )
 // ----------------------------------------------------------------------
 MPI_Datatype SmileiMPI::createMPIparticles( Particles *particles )
 {
-    int nbrOfProp = particles->double_prop.size() + particles->short_prop.size() + particles->uint64_prop.size();
+    unsigned int ndouble  = particles->double_prop.size();
+    unsigned int npdouble = particles->pdouble_prop.size();
+    unsigned int nshort   = particles->short_prop.size();
+    int nbrOfProp = ndouble + npdouble + nshort + particles->uint64_prop.size();
     
     MPI_Aint address[nbrOfProp];
-    for( unsigned int iprop=0 ; iprop<particles->double_prop.size() ; iprop++ ) {
+    for( unsigned int iprop=0 ; iprop<ndouble ; iprop++ ) {
         MPI_Get_address( &( ( *( particles->double_prop[iprop] ) )[0] ), &( address[iprop] ) );
     }
-    for( unsigned int iprop=0 ; iprop<particles->short_prop.size() ; iprop++ ) {
-        MPI_Get_address( &( ( *( particles->short_prop[iprop] ) )[0] ), &( address[particles->double_prop.size()+iprop] ) );
+    for( unsigned int iprop=0 ; iprop<npdouble ; iprop++ ) {
+        MPI_Get_address( &( ( *( particles->pdouble_prop[iprop] ) )[0] ), &( address[ndouble+iprop] ) );
+    }
+    for( unsigned int iprop=0 ; iprop<nshort ; iprop++ ) {
+        MPI_Get_address( &( ( *( particles->short_prop[iprop] ) )[0] ), &( address[ndouble+npdouble+iprop] ) );
     }
     for( unsigned int iprop=0 ; iprop<particles->uint64_prop.size() ; iprop++ ) {
-        MPI_Get_address( &( ( *( particles->uint64_prop[iprop] ) )[0] ), &( address[particles->double_prop.size()+particles->short_prop.size()+iprop] ) );
+        MPI_Get_address( &( ( *( particles->uint64_prop[iprop] ) )[0] ), &( address[ndouble+npdouble+nshort+iprop] ) );
     }
     
     int nbr_parts[nbrOfProp];
@@ -600,14 +610,17 @@ MPI_Datatype SmileiMPI::createMPIparticles( Particles *particles )
     
     MPI_Datatype partDataType[nbrOfProp];
     // define MPI type of each property, default is DOUBLE
-    for( unsigned int i=0 ; i<particles->double_prop.size() ; i++ ) {
+    for( unsigned int i=0 ; i<ndouble ; i++ ) {
         partDataType[i] = MPI_DOUBLE;
     }
-    for( unsigned int iprop=0 ; iprop<particles->short_prop.size() ; iprop++ ) {
-        partDataType[ particles->double_prop.size()+iprop] = MPI_SHORT;
+    for( unsigned int iprop=0 ; iprop<npdouble ; iprop++ ) {
+        partDataType[ndouble+iprop] = ( sizeof( pdouble ) == sizeof( double ) ) ? MPI_DOUBLE : MPI_FLOAT;
+    }
+    for( unsigned int iprop=0 ; iprop<nshort ; iprop++ ) {
+        partDataType[ndouble+npdouble+iprop] = MPI_SHORT;
     }
     for( unsigned int iprop=0 ; iprop<particles->uint64_prop.size() ; iprop++ ) {
-        partDataType[ particles->double_prop.size()+particles->short_prop.size()+iprop] = MPI_UNSIGNED_LONG_LONG;
+        partDataType[ndouble+npdouble+nshort+iprop] = MPI_UNSIGNED_LONG_LONG;
     }
     
     MPI_Datatype typeParticlesMPI;
@@ -1486,7 +1499,7 @@ void SmileiMPI::recv( ElectroMagn *EM, int from, int tag, unsigned int nmodes )
 
 void SmileiMPI::isend( Field *field, int to, int hindex, MPI_Request &request )
 {
-    MPI_Isend( &( ( *field )( 0 ) ), field->globalDims_, MPI_DOUBLE, to, hindex, MPI_COMM_WORLD, &request );
+    MPI_Isend( &( ( *field )( 0 ) ), field->globalDims_, MPI_FDOUBLE, to, hindex, MPI_COMM_WORLD, &request );
     
 } // End isend ( Field )
 
@@ -1501,7 +1514,7 @@ void SmileiMPI::isendComplex( Field *field, int to, int hindex, MPI_Request &req
 void SmileiMPI::recv( Field *field, int from, int hindex )
 {
     MPI_Status status;
-    MPI_Recv( &( ( *field )( 0 ) ), field->globalDims_, MPI_DOUBLE, from, hindex, MPI_COMM_WORLD, &status );
+    MPI_Recv( &( ( *field )( 0 ) ), field->globalDims_, MPI_FDOUBLE, from, hindex, MPI_COMM_WORLD, &status );
     
 } // End recv ( Field )
 
@@ -158,7 +158,7 @@ public:
     std::vector<std::vector<double>> dynamics_Bpart;
     //! gamma factor
     std::vector<std::vector<double>> dynamics_invgf;
-    //! iold_pos
+    //! iold_pos (not allocated if the projectors reconstruct the former positions)
     std::vector<std::vector<int>> dynamics_iold;
     //! delta_old_pos
     std::vector<std::vector<double>> dynamics_deltaold;
@@ -182,8 +182,10 @@ public:
         dynamics_Epart[ithread].resize( 3*npart );
         dynamics_Bpart[ithread].resize( 3*npart );
         dynamics_invgf[ithread].resize( npart );
-        dynamics_iold[ithread].resize( ndim_field*npart );
-        dynamics_deltaold[ithread].resize( ndim_field*npart );
+        if( dynamics_iold.size() > 0 ) {
+            dynamics_iold[ithread].resize( ndim_field*npart );
+            dynamics_deltaold[ithread].resize( ndim_field*npart );
+        }
         if( isAM ) {
             dynamics_thetaold[ithread].resize( npart );
         }
@@ -0,0 +1,123 @@
+// -----------------------------------------------------------------------------
+//
+//! \file DynamicsPipeline.h
+//
+//! \brief Particle dynamics (interpolation, push, boundary conditions and
+//!        projection) with the operator types known at compile time
+//
+// -----------------------------------------------------------------------------
+
+#ifndef DYNAMICSPIPELINE_H
+#define DYNAMICSPIPELINE_H
+
+#include "Species.h"
+#include "Particles.h"
+#include "PartBoundCond.h"
+#include "PartWall.h"
+#include "Patch.h"
+#include "SmileiMPI.h"
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class DynamicsPipeline: moves all the bins of a species in a single call
+//  --------------------------------------------------------------------------------------------------------------------
+class DynamicsPipeline
+{
+public:
+    DynamicsPipeline() {};
+    virtual ~DynamicsPipeline() {};
+
+    //! Interpolate, push, apply the walls and boundary conditions, and project the particles of all the bins
+    //! \param nrj_lost energy of the particles lost at the boundaries (incremented)
+    virtual void operator()( Species *species, ElectroMagn *EMfields, Params &params, bool diag_flag,
+                             PartWalls *partWalls, Patch *patch, SmileiMPI *smpi,
+                             int ithread, unsigned int ispec, double &nrj_lost ) = 0;
+};
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class DynamicsPipelineT: the operators of the species are called through their concrete type,
+//! so that the calls are resolved at compile time and the dimension tests are folded
+//! \param nDim   number of dimensions of the particles (cartesian geometries)
+//! \param InterpT, PushT, ProjT   exact types of species->Interp, species->Push and species->Proj
+//  --------------------------------------------------------------------------------------------------------------------
+template<int nDim, class InterpT, class PushT, class ProjT>
+class DynamicsPipelineT final : public DynamicsPipeline
+{
+public:
+    DynamicsPipelineT() {};
+    ~DynamicsPipelineT() override final {};
+
+    void operator()( Species *species, ElectroMagn *EMfields, Params &params, bool diag_flag,
+                     PartWalls *partWalls, Patch *patch, SmileiMPI *smpi,
+                     int ithread, unsigned int ispec, double &nrj_lost ) override final
+    {
+        InterpT *interp = static_cast<InterpT *>( species->Interp );
+        PushT   *push   = static_cast<PushT *>( species->Push );
+        ProjT   *proj   = static_cast<ProjT *>( species->Proj );
+        PartBoundCond *partBoundCond = species->partBoundCond;
+        Particles &particles = *species->particles;
+
+        double *invgf = &( smpi->dynamics_invgf[ithread][0] );
+        double ener_iPart( 0. );
+
+#ifdef  __DETAILED_TIMERS
+        double timer;
+#endif
+
+        for( unsigned int ibin = 0 ; ibin < species->first_index.size() ; ibin++ ) {
+            int istart = species->first_index[ibin];
+            int iend   = species->last_index[ibin];
+
+#ifdef  __DETAILED_TIMERS
+            timer = MPI_Wtime();
+#endif
+
+            // Interpolate the fields at the particle position
+            interp->InterpT::fieldsWrapper( EMfields, particles, smpi, &( species->first_index[ibin] ), &( species->last_index[ibin] ), ithread, 0 );
+
+#ifdef  __DETAILED_TIMERS
+            patch->patch_timers[0] += MPI_Wtime() - timer;
+            timer = MPI_Wtime();
+#endif
+
+            // Push the particles
+            push->PushT::operator()( particles, smpi, istart, iend, ithread, 0 );
+
+#ifdef  __DETAILED_TIMERS
+            patch->patch_timers[1] += MPI_Wtime() - timer;
+            timer = MPI_Wtime();
+#endif
+
+            // Apply wall and boundary conditions
+            for( unsigned int iwall=0; iwall<partWalls->size(); iwall++ ) {
+                for( int iPart=istart ; iPart<iend; iPart++ ) {
+                    double dtgf = params.timestep * invgf[iPart];
+                    if( !( *partWalls )[iwall]->apply( particles, iPart, species, dtgf, ener_iPart ) ) {
+                        nrj_lost += species->mass * ener_iPart;
+                    }
+                }
+            }
+            for( int iPart=istart ; iPart<iend; iPart++ ) {
+                if( !partBoundCond->apply<nDim, false>( particles, iPart, species, ener_iPart ) ) {
+                    species->addPartInExchList( iPart );
+                    nrj_lost += species->mass * ener_iPart;
+                }
+            }
+
+#ifdef  __DETAILED_TIMERS
+            patch->patch_timers[3] += MPI_Wtime() - timer;
+            timer = MPI_Wtime();
+#endif
+
+            // Project currents if not a Test species and charges as well if a diag is needed.
+            if( !particles.is_test ) {
+                proj->ProjT::currentsAndDensityWrapper( EMfields, particles, smpi, istart, iend, ithread, diag_flag, params.is_spectral, ispec, 0, 0 );
+            }
+
+#ifdef  __DETAILED_TIMERS
+            patch->patch_timers[2] += MPI_Wtime() - timer;
+#endif
+        }
+    };
+};
+
+#endif
@@ -0,0 +1,100 @@
+// -----------------------------------------------------------------------------
+//
+//! \file DynamicsPipelineFactory.h
+//
+//! \brief Class DynamicsPipelineFactory that selects the pre-instantiated
+//!        dynamics pipeline matching the operators of a species
+//
+// -----------------------------------------------------------------------------
+
+#ifndef DYNAMICSPIPELINEFACTORY_H
+#define DYNAMICSPIPELINEFACTORY_H
+
+#include <typeinfo>
+
+#include "DynamicsPipeline.h"
+
+#include "Interpolator1D2Order.h"
+#include "Interpolator1D4Order.h"
+#include "Interpolator2D2Order.h"
+#include "Interpolator2D4Order.h"
+#include "Interpolator3D2Order.h"
+#include "Interpolator3D4Order.h"
+
+#include "Projector1D2Order.h"
+#include "Projector1D4Order.h"
+#include "Projector2D2Order.h"
+#include "Projector2D4Order.h"
+#include "Projector3D2Order.h"
+#include "Projector3D4Order.h"
+
+#include "PusherBoris.h"
+#include "PusherVay.h"
+#include "PusherHigueraCary.h"
+
+#include "Params.h"
+#include "Species.h"
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class DynamicsPipelineFactory
+//
+//! \brief Returns NULL when no pipeline is instantiated for the operators of the species:
+//!        Species::dynamics then calls the operators through their virtual interfaces.
+//  --------------------------------------------------------------------------------------------------------------------
+class DynamicsPipelineFactory
+{
+public:
+    //! Must be called once the operators of the species are created (Species::initOperators)
+    static DynamicsPipeline *create( Params &params, Species *species )
+    {
+        // Only the plain interpolation -> push -> projection sequence of the scalar operators
+        if( species->vectorized_operators || species->mass <= 0 || species->ponderomotive_dynamics
+                || species->Ionize || species->Radiate || species->Multiphoton_Breit_Wheeler_process ) {
+            return NULL;
+        }
+
+        if( params.geometry == "1Dcartesian" ) {
+            if( params.interpolation_order == 2 ) {
+                return create<1, Interpolator1D2Order, Projector1D2Order>( species );
+            } else if( params.interpolation_order == 4 ) {
+                return create<1, Interpolator1D4Order, Projector1D4Order>( species );
+            }
+        } else if( params.geometry == "2Dcartesian" ) {
+            if( params.interpolation_order == 2 ) {
+                return create<2, Interpolator2D2Order, Projector2D2Order>( species );
+            } else if( params.interpolation_order == 4 ) {
+                return create<2, Interpolator2D4Order, Projector2D4Order>( species );
+            }
+        } else if( params.geometry == "3Dcartesian" ) {
+            if( params.interpolation_order == 2 ) {
+                return create<3, Interpolator3D2Order, Projector3D2Order>( species );
+            } else if( params.interpolation_order == 4 ) {
+                return create<3, Interpolator3D4Order, Projector3D4Order>( species );
+            }
+        }
+
+        return NULL;
+    }
+
+private:
+    //! Pipeline for the given interpolator and projector, checking the exact types of the operators
+    template<int nDim, class InterpT, class ProjT>
+    static DynamicsPipeline *create( Species *species )
+    {
+        if( typeid( *species->Interp ) != typeid( InterpT ) || typeid( *species->Proj ) != typeid( ProjT ) ) {
+            return NULL;
+        }
+
+        if( typeid( *species->Push ) == typeid( PusherBoris ) ) {
+            return new DynamicsPipelineT<nDim, InterpT, PusherBoris, ProjT>();
+        } else if( typeid( *species->Push ) == typeid( PusherVay ) ) {
+            return new DynamicsPipelineT<nDim, InterpT, PusherVay, ProjT>();
+        } else if( typeid( *species->Push ) == typeid( PusherHigueraCary ) ) {
+            return new DynamicsPipelineT<nDim, InterpT, PusherHigueraCary, ProjT>();
+        }
+
+        return NULL;
+    }
+};
+
+#endif
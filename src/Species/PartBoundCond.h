@@ -40,6 +40,22 @@ public:
     //! value of keep_part.
     //! Be careful, once an a BC along a given dimension set keep_part to 0, it will remain to 0.
     inline int apply( Particles &particles, int ipart, Species *species, double &nrj_iPart )  //, bool &contribute ) {
+    {
+        if( isAM ) {
+            return apply<3, true>( particles, ipart, species, nrj_iPart );
+        } else if( nDim_particle == 3 ) {
+            return apply<3, false>( particles, ipart, species, nrj_iPart );
+        } else if( nDim_particle == 2 ) {
+            return apply<2, false>( particles, ipart, species, nrj_iPart );
+        } else {
+            return apply<1, false>( particles, ipart, species, nrj_iPart );
+        }
+    };
+    
+    //! Same as apply, with the dimension and the geometry known at compile time
+    //! (used by the DynamicsPipeline to fold the dimension tests)
+    template<int nDim, bool AM>
+    inline int apply( Particles &particles, int ipart, Species *species, double &nrj_iPart )
     {
     
         /*if ((particles.position(0, ipart) > x_max)
@@ -71,9 +87,9 @@ public:
             }
         }
         
-        if( !isAM ) {
+        if( !AM ) {
             // iDim = 1
-            if( nDim_particle >= 2 ) {
+            if( nDim >= 2 ) {
             
                 if( particles.position( 1, ipart ) <  y_min ) {
                     if( bc_ymin==NULL ) {
@@ -89,7 +105,7 @@ public:
                     }
                 }
                 // iDim = 2
-                if( nDim_particle == 3 ) {
+                if( nDim == 3 ) {
                 
                     if( particles.position( 2, ipart ) <  z_min ) {
                         if( bc_zmin==NULL ) {
@@ -104,8 +120,8 @@ public:
                             keep_part *= ( *bc_zmax )( particles, ipart, 2, 2.*z_max, species, nrj_iPart );
                         }
                     }
-                } // end if (nDim_particle == 3)
-            } // end if (nDim_particle >= 2)
+                } // end if (nDim == 3)
+            } // end if (nDim >= 2)
         }
         // iDim = 1 & 2
         else {
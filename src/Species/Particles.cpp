@@ -27,6 +27,7 @@ Particles::Particles():
     isMonteCarlo = false;
     
     double_prop.resize( 0 );
+    pdouble_prop.resize( 0 );
     short_prop.resize( 0 );
     uint64_prop.resize( 0 );
 }
@@ -57,10 +58,10 @@ void Particles::initialize( unsigned int nParticles, unsigned int nDim )
         }
         
         for( unsigned int i=0 ; i< 3 ; i++ ) {
-            double_prop.push_back( &( Momentum[i] ) );
+            pdouble_prop.push_back( &( Momentum[i] ) );
         }
         
-        double_prop.push_back( &Weight );
+        pdouble_prop.push_back( &Weight );
         
 #ifdef  __DEBUG
         Position_old.resize( nDim );
@@ -78,14 +79,14 @@ void Particles::initialize( unsigned int nParticles, unsigned int nDim )
         // - if radiation reaction (continuous or discontinuous)
         // - if multiphoton-Breit-Wheeler if photons
         if( isQuantumParameter ) {
-            double_prop.push_back( &Chi );
+            pdouble_prop.push_back( &Chi );
         }
         
         // Optical Depth for Monte-Carlo processes:
         // - if the discontinuous (Monte-Carlo) radiation reaction
         // are activated, tau is the incremental optical depth to emission
         if( isMonteCarlo ) {
-            double_prop.push_back( &Tau );
+            pdouble_prop.push_back( &Tau );
         }
         
     }
@@ -183,15 +184,19 @@ void Particles::shrink_to_fit( unsigned int nDim )
 {
 
     for( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) {
-        std::vector<double>( *double_prop[iprop] ).swap( *double_prop[iprop] );
+        ParticleProperty<double>( *double_prop[iprop] ).swap( *double_prop[iprop] );
+    }
+    
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        ParticleProperty<pdouble>( *pdouble_prop[iprop] ).swap( *pdouble_prop[iprop] );
     }
     
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
-        std::vector<short>( *short_prop[iprop] ).swap( *short_prop[iprop] );
+        ParticleProperty<short>( *short_prop[iprop] ).swap( *short_prop[iprop] );
     }
     
     for( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) {
-        std::vector<uint64_t>( *uint64_prop[iprop] ).swap( *uint64_prop[iprop] );
+        ParticleProperty<uint64_t>( *uint64_prop[iprop] ).swap( *uint64_prop[iprop] );
     }
 }
 
@@ -205,6 +210,10 @@ void Particles::clear()
         double_prop[iprop]->clear();
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        pdouble_prop[iprop]->clear();
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         short_prop[iprop]->clear();
     }
@@ -221,6 +230,10 @@ void Particles::cp_particle( unsigned int ipart )
         double_prop[iprop]->push_back( ( *double_prop[iprop] )[ipart] );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        pdouble_prop[iprop]->push_back( ( *pdouble_prop[iprop] )[ipart] );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         short_prop[iprop]->push_back( ( *short_prop[iprop] )[ipart] );
     }
@@ -240,6 +253,10 @@ void Particles::cp_particle( unsigned int ipart, Particles &dest_parts )
         dest_parts.double_prop[iprop]->push_back( ( *double_prop[iprop] )[ipart] );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        dest_parts.pdouble_prop[iprop]->push_back( ( *pdouble_prop[iprop] )[ipart] );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         dest_parts.short_prop[iprop]->push_back( ( *short_prop[iprop] )[ipart] );
     }
@@ -258,6 +275,10 @@ void Particles::cp_particle( unsigned int ipart, Particles &dest_parts, int dest
         dest_parts.double_prop[iprop]->insert( dest_parts.double_prop[iprop]->begin() + dest_id, ( *double_prop[iprop] )[ipart] );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        dest_parts.pdouble_prop[iprop]->insert( dest_parts.pdouble_prop[iprop]->begin() + dest_id, ( *pdouble_prop[iprop] )[ipart] );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         dest_parts.short_prop[iprop]->insert( dest_parts.short_prop[iprop]->begin() + dest_id, ( *short_prop[iprop] )[ipart] );
     }
@@ -277,6 +298,10 @@ void Particles::cp_particles( unsigned int iPart, unsigned int nPart, Particles
         dest_parts.double_prop[iprop]->insert( dest_parts.double_prop[iprop]->begin() + dest_id, double_prop[iprop]->begin()+iPart, double_prop[iprop]->begin()+iPart+nPart );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        dest_parts.pdouble_prop[iprop]->insert( dest_parts.pdouble_prop[iprop]->begin() + dest_id, pdouble_prop[iprop]->begin()+iPart, pdouble_prop[iprop]->begin()+iPart+nPart );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         dest_parts.short_prop[iprop]->insert( dest_parts.short_prop[iprop]->begin() + dest_id, short_prop[iprop]->begin()+iPart, short_prop[iprop]->begin()+iPart+nPart );
     }
@@ -301,6 +326,15 @@ void Particles::cp_particle_safe( unsigned int ipart, Particles &dest_parts )
         dest_parts.double_prop[iprop]->push_back( ( *double_prop[iprop] )[ipart] );
     }
     
+    nprop = pdouble_prop.size();
+    if( dest_parts.pdouble_prop.size() < nprop ) {
+        nprop = dest_parts.pdouble_prop.size();
+    }
+    
+    for( unsigned int iprop=0 ; iprop<nprop ; iprop++ ) {
+        dest_parts.pdouble_prop[iprop]->push_back( ( *pdouble_prop[iprop] )[ipart] );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         dest_parts.short_prop[iprop]->push_back( ( *short_prop[iprop] )[ipart] );
     }
@@ -320,6 +354,10 @@ void Particles::erase_particle( unsigned int ipart )
         ( *double_prop[iprop] ).erase( ( *double_prop[iprop] ).begin()+ipart );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        ( *pdouble_prop[iprop] ).erase( ( *pdouble_prop[iprop] ).begin()+ipart );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         ( *short_prop[iprop] ).erase( ( *short_prop[iprop] ).begin()+ipart );
     }
@@ -339,6 +377,10 @@ void Particles::erase_particle_trail( unsigned int ipart )
         ( *double_prop[iprop] ).erase( ( *double_prop[iprop] ).begin()+ipart, ( *double_prop[iprop] ).end() );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        ( *pdouble_prop[iprop] ).erase( ( *pdouble_prop[iprop] ).begin()+ipart, ( *pdouble_prop[iprop] ).end() );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         ( *short_prop[iprop] ).erase( ( *short_prop[iprop] ).begin()+ipart, ( *short_prop[iprop] ).end() );
     }
@@ -348,6 +390,54 @@ void Particles::erase_particle_trail( unsigned int ipart )
     }
     
 }
+// ---------------------------------------------------------------------------------------------------------------------
+// Move the particles which are not flagged in dead towards the beginning of one property array, then truncate it
+// ---------------------------------------------------------------------------------------------------------------------
+template<typename T>
+static void compact_property( ParticleProperty<T> &prop, const vector<bool> &dead, unsigned int ifirst )
+{
+    unsigned int idest = ifirst;
+    for( unsigned int ipart=ifirst+1 ; ipart<prop.size() ; ipart++ ) {
+        if( !dead[ipart] ) {
+            prop[idest++] = prop[ipart];
+        }
+    }
+    prop.resize( idest );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Suppress the particles flagged in dead. Removing particles one by one with erase_particle shifts the tail
+// of all the properties each time: flagging them first and compacting once costs a single pass.
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::erase_particles( const vector<bool> &dead )
+{
+    // Particles before the first tombstone stay in place
+    unsigned int ifirst = 0;
+    while( ifirst < size() && !dead[ifirst] ) {
+        ifirst++;
+    }
+    if( ifirst == size() ) {
+        return;
+    }
+    
+    for( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) {
+        compact_property( *double_prop[iprop], dead, ifirst );
+    }
+    
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        compact_property( *pdouble_prop[iprop], dead, ifirst );
+    }
+    
+    for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
+        compact_property( *short_prop[iprop], dead, ifirst );
+    }
+    
+    for( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) {
+        compact_property( *uint64_prop[iprop], dead, ifirst );
+    }
+    
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Suppress npart particles from ipart
 // ---------------------------------------------------------------------------------------------------------------------
@@ -357,6 +447,10 @@ void Particles::erase_particle( unsigned int ipart, unsigned int npart )
         ( *double_prop[iprop] ).erase( ( *double_prop[iprop] ).begin()+ipart, ( *double_prop[iprop] ).begin()+ipart+npart );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        ( *pdouble_prop[iprop] ).erase( ( *pdouble_prop[iprop] ).begin()+ipart, ( *pdouble_prop[iprop] ).begin()+ipart+npart );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         ( *short_prop[iprop] ).erase( ( *short_prop[iprop] ).begin()+ipart, ( *short_prop[iprop] ).begin()+ipart+npart );
     }
@@ -439,6 +533,10 @@ void Particles::swap_part( unsigned int part1, unsigned int part2 )
         std::swap( ( *double_prop[iprop] )[part1], ( *double_prop[iprop] )[part2] );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        std::swap( ( *pdouble_prop[iprop] )[part1], ( *pdouble_prop[iprop] )[part2] );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         std::swap( ( *short_prop[iprop] )[part1], ( *short_prop[iprop] )[part2] );
     }
@@ -460,6 +558,13 @@ void Particles::swap_part3( unsigned int part1, unsigned int part2, unsigned int
         ( *double_prop[iprop] )[part2] = temp;
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        temp = ( *pdouble_prop[iprop] )[part1];
+        ( *pdouble_prop[iprop] )[part1] = ( *pdouble_prop[iprop] )[part3];
+        ( *pdouble_prop[iprop] )[part3] = ( *pdouble_prop[iprop] )[part2];
+        ( *pdouble_prop[iprop] )[part2] = temp;
+    }
+    
     short stemp;
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         stemp = ( *short_prop[iprop] )[part1];
@@ -491,6 +596,14 @@ void Particles::swap_part4( unsigned int part1, unsigned int part2, unsigned int
         ( *double_prop[iprop] )[part2] = temp;
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        temp = ( *pdouble_prop[iprop] )[part1];
+        ( *pdouble_prop[iprop] )[part1] = ( *pdouble_prop[iprop] )[part4];
+        ( *pdouble_prop[iprop] )[part4] = ( *pdouble_prop[iprop] )[part3];
+        ( *pdouble_prop[iprop] )[part3] = ( *pdouble_prop[iprop] )[part2];
+        ( *pdouble_prop[iprop] )[part2] = temp;
+    }
+    
     short stemp;
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         stemp = ( *short_prop[iprop] )[part1];
@@ -544,6 +657,10 @@ void Particles::overwrite_part( unsigned int part1, unsigned int part2 )
         ( *double_prop[iprop] )[part2] = ( *double_prop[iprop] )[part1];
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        ( *pdouble_prop[iprop] )[part2] = ( *pdouble_prop[iprop] )[part1];
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         ( *short_prop[iprop] )[part2] = ( *short_prop[iprop] )[part1];
     }
@@ -560,6 +677,7 @@ void Particles::overwrite_part( unsigned int part1, unsigned int part2 )
 void Particles::overwrite_part( unsigned int part1, unsigned int part2, unsigned int N )
 {
     unsigned int sizepart = N*sizeof( Position[0][0] );
+    unsigned int sizepdouble = N*sizeof( pdouble );
     unsigned int sizecharge = N*sizeof( Charge[0] );
     unsigned int sizeid = N*sizeof( Id[0] );
     
@@ -567,6 +685,10 @@ void Particles::overwrite_part( unsigned int part1, unsigned int part2, unsigned
         memcpy( & ( *double_prop[iprop] )[part2],  &( *double_prop[iprop] )[part1], sizepart );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        memcpy( & ( *pdouble_prop[iprop] )[part2],  &( *pdouble_prop[iprop] )[part1], sizepdouble );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         memcpy( & ( *short_prop[iprop] )[part2],  &( *short_prop[iprop] )[part1], sizecharge );
     }
@@ -585,6 +707,10 @@ void Particles::overwrite_part( unsigned int part1, Particles &dest_parts, unsig
         ( *dest_parts.double_prop[iprop] )[part2] = ( *double_prop[iprop] )[part1];
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        ( *dest_parts.pdouble_prop[iprop] )[part2] = ( *pdouble_prop[iprop] )[part1];
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         ( *dest_parts.short_prop[iprop] )[part2] = ( *short_prop[iprop] )[part1];
     }
@@ -600,6 +726,7 @@ void Particles::overwrite_part( unsigned int part1, Particles &dest_parts, unsig
 void Particles::overwrite_part( unsigned int part1, Particles &dest_parts, unsigned int part2, unsigned int N )
 {
     unsigned int sizepart = N*sizeof( Position[0][0] );
+    unsigned int sizepdouble = N*sizeof( pdouble );
     unsigned int sizecharge = N*sizeof( Charge[0] );
     unsigned int sizeid = N*sizeof( Id[0] );
     
@@ -607,6 +734,10 @@ void Particles::overwrite_part( unsigned int part1, Particles &dest_parts, unsig
         memcpy( & ( *dest_parts.double_prop[iprop] )[part2],  &( *double_prop[iprop] )[part1], sizepart );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        memcpy( & ( *dest_parts.pdouble_prop[iprop] )[part2],  &( *pdouble_prop[iprop] )[part1], sizepdouble );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         memcpy( & ( *dest_parts.short_prop[iprop] )[part2],  &( *short_prop[iprop] )[part1], sizecharge );
     }
@@ -626,6 +757,7 @@ void Particles::swap_part( unsigned int part1, unsigned int part2, unsigned int
     double *buffer[N];
     
     unsigned int sizepart = N*sizeof( Position[0][0] );
+    unsigned int sizepdouble = N*sizeof( pdouble );
     unsigned int sizecharge = N*sizeof( Charge[0] );
     unsigned int sizeid = N*sizeof( Id[0] );
     
@@ -635,6 +767,12 @@ void Particles::swap_part( unsigned int part1, unsigned int part2, unsigned int
         memcpy( &( ( *double_prop[iprop] )[part2] ), buffer, sizepart );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        memcpy( buffer, &( ( *pdouble_prop[iprop] )[part1] ), sizepdouble );
+        memcpy( &( ( *pdouble_prop[iprop] )[part1] ), &( ( *pdouble_prop[iprop] )[part2] ), sizepdouble );
+        memcpy( &( ( *pdouble_prop[iprop] )[part2] ), buffer, sizepdouble );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         memcpy( buffer, &( ( *short_prop[iprop] )[part1] ), sizecharge );
         memcpy( &( ( *short_prop[iprop] )[part1] ), &( ( *short_prop[iprop] )[part2] ), sizecharge );
@@ -666,6 +804,10 @@ void Particles::create_particle()
         ( *double_prop[iprop] ).push_back( 0. );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        ( *pdouble_prop[iprop] ).push_back( 0. );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         ( *short_prop[iprop] ).push_back( 0 );
     }
@@ -686,6 +828,10 @@ void Particles::create_particles( int nAdditionalParticles )
         ( *double_prop[iprop] ).resize( nParticles+nAdditionalParticles, 0. );
     }
     
+    for( unsigned int iprop=0 ; iprop<pdouble_prop.size() ; iprop++ ) {
+        ( *pdouble_prop[iprop] ).resize( nParticles+nAdditionalParticles, 0. );
+    }
+    
     for( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
         ( *short_prop[iprop] ).resize( nParticles+nAdditionalParticles, 0 );
     }
@@ -9,12 +9,26 @@
 
 #include "Tools.h"
 #include "TimeSelection.h"
+#include "AlignedAllocator.h"
 
 class Particle;
 
 class Params;
 class Patch;
 
+//! Storage of one particle property: contiguous, and aligned so that the
+//! vectorized operators start each pack on a cache-line boundary
+template<typename T>
+using ParticleProperty = std::vector<T, AlignedAllocator<T> >;
+
+//! Floating-point type of the particle momentum, weight, chi and tau.
+//! Positions always remain in double precision; compiling with
+//! config=single_precision_particles stores the other properties in float
+#ifdef __SINGLE_PRECISION_PARTICLES
+typedef float pdouble;
+#else
+typedef double pdouble;
+#endif
 
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -88,6 +102,9 @@ public:
     //! Suppress all particles from iPart to the end of particle array
     void erase_particle_trail( unsigned int iPart );
     
+    //! Suppress in a single pass the particles flagged in dead (tombstones), keeping the order of the others
+    void erase_particles( const std::vector<bool> &dead );
+    
     //! Print parameters of particle iPart
     void print( unsigned int iPart );
     
@@ -157,39 +174,39 @@ public:
     }
     
     //! Method used to get the list of Particle position
-    inline std::vector<double>  position( unsigned int idim ) const
+    inline ParticleProperty<double>  position( unsigned int idim ) const
     {
         return Position[idim];
     }
     
     //! Method used to get the Particle momentum
-    inline double  momentum( unsigned int idim, unsigned int ipart ) const
+    inline pdouble momentum( unsigned int idim, unsigned int ipart ) const
     {
         return Momentum[idim][ipart];
     }
     //! Method used to set a new value to the Particle momentum
-    inline double &momentum( unsigned int idim, unsigned int ipart )
+    inline pdouble &momentum( unsigned int idim, unsigned int ipart )
     {
         return Momentum[idim][ipart];
     }
     //! Method used to get the Particle momentum
-    inline std::vector<double>  momentum( unsigned int idim ) const
+    inline ParticleProperty<pdouble>  momentum( unsigned int idim ) const
     {
         return Momentum[idim];
     }
     
     //! Method used to get the Particle weight
-    inline double  weight( unsigned int ipart ) const
+    inline pdouble weight( unsigned int ipart ) const
     {
         return Weight[ipart];
     }
     //! Method used to set a new value to the Particle weight
-    inline double &weight( unsigned int ipart )
+    inline pdouble &weight( unsigned int ipart )
     {
         return Weight[ipart];
     }
     //! Method used to get the Particle weight
-    inline std::vector<double>  weight() const
+    inline ParticleProperty<pdouble>  weight() const
     {
         return Weight;
     }
@@ -205,7 +222,7 @@ public:
         return Charge[ipart];
     }
     //! Method used to get the list of Particle charges
-    inline std::vector<short>  charge() const
+    inline ParticleProperty<short>  charge() const
     {
         return Charge;
     }
@@ -232,34 +249,34 @@ public:
     //! Partiles properties, respect type order : all double, all short, all unsigned int
     
     //! array containing the particle position
-    std::vector< std::vector<double> > Position;
+    std::vector< ParticleProperty<double> > Position;
     
     //! array containing the particle former (old) positions
-    std::vector< std::vector<double> >Position_old;
+    std::vector< ParticleProperty<double> > Position_old;
     
     //! array containing the particle moments
-    std::vector< std::vector<double> >  Momentum;
+    std::vector< ParticleProperty<pdouble> > Momentum;
     
     //! containing the particle weight: equivalent to a charge density
-    std::vector<double> Weight;
+    ParticleProperty<pdouble> Weight;
     
     //! containing the particle quantum parameter
-    std::vector<double> Chi;
+    ParticleProperty<pdouble> Chi;
     
     //! charge state of the particle (multiples of e>0)
-    std::vector<short> Charge;
+    ParticleProperty<short> Charge;
     
     //! Id of the particle
-    std::vector<uint64_t> Id;
+    ParticleProperty<uint64_t> Id;
     
     // Discontinuous radiation losses
     
     //! Incremental optical depth for
     //! the Monte-Carlo process
-    std::vector<double> Tau;
+    ParticleProperty<pdouble> Tau;
     
     //! cell_keys of the particle
-    std::vector<int> cell_keys;
+    ParticleProperty<int> cell_keys;
     
     // TEST PARTICLE PARAMETERS
     bool is_test;
@@ -287,7 +304,7 @@ public:
         return Id[ipart];
     }
     //! Method used to get the Particle Ids
-    inline std::vector<uint64_t> id() const
+    inline ParticleProperty<uint64_t> id() const
     {
         return Id;
     }
@@ -303,42 +320,43 @@ public:
     bool isMonteCarlo;
     
     //! Method used to get the Particle chi factor
-    inline double  chi( unsigned int ipart ) const
+    inline pdouble chi( unsigned int ipart ) const
     {
         return Chi[ipart];
     }
     //! Method used to set a new value to the Particle chi factor
-    inline double &chi( unsigned int ipart )
+    inline pdouble &chi( unsigned int ipart )
     {
         return Chi[ipart];
     }
     //! Method used to get the Particle chi factor
-    inline std::vector<double>  chi() const
+    inline ParticleProperty<pdouble>  chi() const
     {
         return Chi;
     }
     
     //! Method used to get the Particle optical depth
-    inline double  tau( unsigned int ipart ) const
+    inline pdouble tau( unsigned int ipart ) const
     {
         return Tau[ipart];
     }
     //! Method used to set a new value to
     //! the Particle optical depth
-    inline double &tau( unsigned int ipart )
+    inline pdouble &tau( unsigned int ipart )
     {
         return Tau[ipart];
     }
     //! Method used to get the Particle optical depth
-    inline std::vector<double>  tau() const
+    inline ParticleProperty<pdouble>  tau() const
     {
         return Tau;
     }
     
     
-    std::vector< std::vector<double  >*> double_prop;
-    std::vector< std::vector<short   >*> short_prop;
-    std::vector< std::vector<uint64_t>*> uint64_prop;
+    std::vector< ParticleProperty<double  >*> double_prop;
+    std::vector< ParticleProperty<pdouble >*> pdouble_prop;
+    std::vector< ParticleProperty<short   >*> short_prop;
+    std::vector< ParticleProperty<uint64_t>*> uint64_prop;
     
     
 #ifdef __DEBUG
@@ -362,20 +380,6 @@ public:
     
     Particle operator()( unsigned int iPart );
     
-    //! Methods to obtain any property, given its index in the arrays double_prop, uint64_prop, or short_prop
-    void getProperty( unsigned int iprop, std::vector<uint64_t> *&prop )
-    {
-        prop = uint64_prop[iprop];
-    }
-    void getProperty( unsigned int iprop, std::vector<short> *&prop )
-    {
-        prop = short_prop[iprop];
-    }
-    void getProperty( unsigned int iprop, std::vector<double> *&prop )
-    {
-        prop = double_prop[iprop];
-    }
-    
 private:
 
 };
@@ -16,6 +16,8 @@
 #include "IonizationFactory.h"
 #include "RadiationFactory.h"
 #include "MultiphotonBreitWheelerFactory.h"
+#include "MergingFactory.h"
+#include "DynamicsPipelineFactory.h"
 #include "PartBoundCond.h"
 #include "PartWall.h"
 #include "BoundaryConditionType.h"
@@ -53,6 +55,12 @@ Species::Species( Params &params, Patch *patch ) :
     pusher( "boris" ),
     radiation_model( "none" ),
     time_frozen( 0 ),
+    merging_method( "none" ),
+    merging_time_selection( NULL ),
+    merge_min_particles_per_cell( 8 ),
+    merge_min_packet_size( 4 ),
+    merge_max_packet_size( 4 ),
+    merge_momentum_cell_size( 3, 16 ),
     radiating( false ),
     relativistic_field_initialization( false ),
     time_relativistic_initialization( 0 ),
@@ -78,6 +86,8 @@ Species::Species( Params &params, Patch *patch ) :
     radiation_photon_species( "" ),
     mBW_pair_creation_sampling( 2, 1 ),
     clrw( params.clrw ),
+    nparts_moved_by_sort( 0 ),
+    multithreaded_sort( false ),
     oversize( params.oversize ),
     cell_length( params.cell_length ),
     min_loc_vec( patch->getDomainLocalMin() ),
@@ -144,6 +154,7 @@ void Species::initCluster( Params &params )
     nrj_mw_lost = 0.;
     nrj_new_particles = 0.;
     nrj_radiation = 0.;
+    nmerged_particles = 0.;
     
 }//END initCluster
 
@@ -209,6 +220,13 @@ void Species::initOperators( Params &params, Patch *patch )
     
     // Create the multiphoton Breit-Wheeler model
     Multiphoton_Breit_Wheeler_process = MultiphotonBreitWheelerFactory::create( params, this );
+    
+    // Create the particle merging method
+    Merge = MergingFactory::create( params, this );
+    
+    // Pre-instantiated dynamics for the most common operators
+    Pipeline = DynamicsPipelineFactory::create( params, this );
+    
     // define limits for BC and functions applied and for domain decomposition
     partBoundCond = new PartBoundCond( params, this, patch );
     for( unsigned int iDim=0 ; iDim < nDim_particle ; iDim++ ) {
@@ -243,6 +261,15 @@ Species::~Species()
     if( Multiphoton_Breit_Wheeler_process ) {
         delete Multiphoton_Breit_Wheeler_process;
     }
+    if( Merge ) {
+        delete Merge;
+    }
+    if( Pipeline ) {
+        delete Pipeline;
+    }
+    if( merging_time_selection ) {
+        delete merging_time_selection;
+    }
     if( partBoundCond ) {
         delete partBoundCond;
     }
@@ -628,176 +655,181 @@ void Species::dynamics( double time_dual, unsigned int ispec,
         //Still needed for ionization
         vector<double> *Epart = &( smpi->dynamics_Epart[ithread] );
         
-        for( unsigned int ibin = 0 ; ibin < first_index.size() ; ibin++ ) {
-        
-#ifdef  __DETAILED_TIMERS
-            timer = MPI_Wtime();
-#endif
-            
-            // Interpolate the fields at the particle position
-            Interp->fieldsWrapper( EMfields, *particles, smpi, &( first_index[ibin] ), &( last_index[ibin] ), ithread );
+        // Same sequence as below, without virtual calls
+        if( Pipeline && time_dual>time_frozen ) {
+            ( *Pipeline )( this, EMfields, params, diag_flag, partWalls, patch, smpi, ithread, ispec, nrj_lost_per_thd[tid] );
+        } else {
+            for( unsigned int ibin = 0 ; ibin < first_index.size() ; ibin++ ) {
             
 #ifdef  __DETAILED_TIMERS
-            patch->patch_timers[0] += MPI_Wtime() - timer;
+                timer = MPI_Wtime();
 #endif
-            
-            // Ionization
-            if( Ionize ) {
-            
+                
+                // Interpolate the fields at the particle position
+                Interp->fieldsWrapper( EMfields, *particles, smpi, &( first_index[ibin] ), &( last_index[ibin] ), ithread );
+                
 #ifdef  __DETAILED_TIMERS
-                timer = MPI_Wtime();
+                patch->patch_timers[0] += MPI_Wtime() - timer;
 #endif
                 
-                ( *Ionize )( particles, first_index[ibin], last_index[ibin], Epart, patch, Proj );
+                // Ionization
+                if( Ionize ) {
                 
 #ifdef  __DETAILED_TIMERS
-                patch->patch_timers[4] += MPI_Wtime() - timer;
+                    timer = MPI_Wtime();
 #endif
-            }
-            
-            if( time_dual<=time_frozen ) continue; // Do not push nor project frozen particles
-
-            // Radiation losses
-            if( Radiate ) {
-            
+                    
+                    ( *Ionize )( particles, first_index[ibin], last_index[ibin], Epart, patch, Proj );
+                    
 #ifdef  __DETAILED_TIMERS
-                timer = MPI_Wtime();
+                    patch->patch_timers[4] += MPI_Wtime() - timer;
 #endif
+                }
                 
-                // Radiation process
-                ( *Radiate )( *particles, this->photon_species, smpi,
-                              RadiationTables,
-                              first_index[ibin], last_index[ibin], ithread );
-                              
-                // Update scalar variable for diagnostics
-                nrj_radiation += Radiate->getRadiatedEnergy();
+                if( time_dual<=time_frozen ) continue; // Do not push nor project frozen particles
+
+                // Radiation losses
+                if( Radiate ) {
                 
-                // Update the quantum parameter chi
-                Radiate->computeParticlesChi( *particles,
-                                              smpi,
-                                              first_index[ibin],
-                                              last_index[ibin],
-                                              ithread );
 #ifdef  __DETAILED_TIMERS
-                patch->patch_timers[5] += MPI_Wtime() - timer;
+                    timer = MPI_Wtime();
 #endif
-                
-            }
-            
-            
-            // Multiphoton Breit-Wheeler
-            if( Multiphoton_Breit_Wheeler_process ) {
-            
+                    
+                    // Radiation process
+                    ( *Radiate )( *particles, this->photon_species, smpi,
+                                  RadiationTables,
+                                  first_index[ibin], last_index[ibin], ithread );
+                                  
+                    // Update scalar variable for diagnostics
+                    nrj_radiation += Radiate->getRadiatedEnergy();
+                    
+                    // Update the quantum parameter chi
+                    Radiate->computeParticlesChi( *particles,
+                                                  smpi,
+                                                  first_index[ibin],
+                                                  last_index[ibin],
+                                                  ithread );
 #ifdef  __DETAILED_TIMERS
-                timer = MPI_Wtime();
+                    patch->patch_timers[5] += MPI_Wtime() - timer;
 #endif
+                    
+                }
                 
-                // Pair generation process
-                ( *Multiphoton_Breit_Wheeler_process )( *particles,
-                                                        smpi,
-                                                        MultiphotonBreitWheelerTables,
-                                                        first_index[ibin], last_index[ibin], ithread );
-                                                        
-                // Update scalar variable for diagnostics
-                // We reuse nrj_radiation for the pairs
-                nrj_radiation += Multiphoton_Breit_Wheeler_process->getPairEnergy();
                 
-                // Update the photon quantum parameter chi of all photons
-                Multiphoton_Breit_Wheeler_process->compute_thread_chiph( *particles,
-                        smpi,
-                        first_index[ibin],
-                        last_index[ibin],
-                        ithread ); 
+                // Multiphoton Breit-Wheeler
+                if( Multiphoton_Breit_Wheeler_process ) {
                 
-                // Suppression of the decayed photons into pairs
-                Multiphoton_Breit_Wheeler_process->decayed_photon_cleaning(
-                    *particles, smpi, ibin, first_index.size(), &first_index[0], &last_index[0], ithread );
+#ifdef  __DETAILED_TIMERS
+                    timer = MPI_Wtime();
+#endif
+                    
+                    // Pair generation process
+                    ( *Multiphoton_Breit_Wheeler_process )( *particles,
+                                                            smpi,
+                                                            MultiphotonBreitWheelerTables,
+                                                            first_index[ibin], last_index[ibin], ithread );
+                                                            
+                    // Update scalar variable for diagnostics
+                    // We reuse nrj_radiation for the pairs
+                    nrj_radiation += Multiphoton_Breit_Wheeler_process->getPairEnergy();
                     
+                    // Update the photon quantum parameter chi of all photons
+                    Multiphoton_Breit_Wheeler_process->compute_thread_chiph( *particles,
+                            smpi,
+                            first_index[ibin],
+                            last_index[ibin],
+                            ithread ); 
+                    
+                    // Suppression of the decayed photons into pairs
+                    Multiphoton_Breit_Wheeler_process->decayed_photon_cleaning(
+                        *particles, smpi, ibin, first_index.size(), &first_index[0], &last_index[0], ithread );
+                        
 #ifdef  __DETAILED_TIMERS
-                patch->patch_timers[6] += MPI_Wtime() - timer;
+                    patch->patch_timers[6] += MPI_Wtime() - timer;
 #endif
+                    
+                }
                 
-            }
-            
 #ifdef  __DETAILED_TIMERS
-            timer = MPI_Wtime();
+                timer = MPI_Wtime();
 #endif
-            
-            // Push the particles and the photons
-            ( *Push )( *particles, smpi, first_index[ibin], last_index[ibin], ithread );
-            //particles->test_move( first_index[ibin], last_index[ibin], params );
-            
+                
+                // Push the particles and the photons
+                ( *Push )( *particles, smpi, first_index[ibin], last_index[ibin], ithread );
+                //particles->test_move( first_index[ibin], last_index[ibin], params );
+                
 #ifdef  __DETAILED_TIMERS
-            patch->patch_timers[1] += MPI_Wtime() - timer;
-            timer = MPI_Wtime();
+                patch->patch_timers[1] += MPI_Wtime() - timer;
+                timer = MPI_Wtime();
 #endif
-            
-            // Apply wall and boundary conditions
-            if( mass>0 ) {
-                for( unsigned int iwall=0; iwall<partWalls->size(); iwall++ ) {
+                
+                // Apply wall and boundary conditions
+                if( mass>0 ) {
+                    for( unsigned int iwall=0; iwall<partWalls->size(); iwall++ ) {
+                        for( iPart=first_index[ibin] ; ( int )iPart<last_index[ibin]; iPart++ ) {
+                            double dtgf = params.timestep * smpi->dynamics_invgf[ithread][iPart];
+                            if( !( *partWalls )[iwall]->apply( *particles, iPart, this, dtgf, ener_iPart ) ) {
+                                nrj_lost_per_thd[tid] += mass * ener_iPart;
+                            }
+                        }
+                    }
+                    // Boundary Condition may be physical or due to domain decomposition
+                    // apply returns 0 if iPart is not in the local domain anymore
+                    //        if omp, create a list per thread
                     for( iPart=first_index[ibin] ; ( int )iPart<last_index[ibin]; iPart++ ) {
-                        double dtgf = params.timestep * smpi->dynamics_invgf[ithread][iPart];
-                        if( !( *partWalls )[iwall]->apply( *particles, iPart, this, dtgf, ener_iPart ) ) {
+                        if( !partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
+                            addPartInExchList( iPart );
                             nrj_lost_per_thd[tid] += mass * ener_iPart;
+                            //}
+                            //else if ( partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
+                            //std::cout<<"removed particle position"<< particles->position(0,iPart)<<" , "<<particles->position(1,iPart)<<" ,"<<particles->position(2,iPart)<<std::endl;
                         }
                     }
-                }
-                // Boundary Condition may be physical or due to domain decomposition
-                // apply returns 0 if iPart is not in the local domain anymore
-                //        if omp, create a list per thread
-                for( iPart=first_index[ibin] ; ( int )iPart<last_index[ibin]; iPart++ ) {
-                    if( !partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
-                        addPartInExchList( iPart );
-                        nrj_lost_per_thd[tid] += mass * ener_iPart;
-                        //}
-                        //else if ( partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
-                        //std::cout<<"removed particle position"<< particles->position(0,iPart)<<" , "<<particles->position(1,iPart)<<" ,"<<particles->position(2,iPart)<<std::endl;
+                    
+                } else if( mass==0 ) {
+                    for( unsigned int iwall=0; iwall<partWalls->size(); iwall++ ) {
+                        for( iPart=first_index[ibin] ; ( int )iPart<last_index[ibin]; iPart++ ) {
+                            double dtgf = params.timestep * smpi->dynamics_invgf[ithread][iPart];
+                            if( !( *partWalls )[iwall]->apply( *particles, iPart, this, dtgf, ener_iPart ) ) {
+                                nrj_lost_per_thd[tid] += ener_iPart;
+                            }
+                        }
                     }
-                }
-                
-            } else if( mass==0 ) {
-                for( unsigned int iwall=0; iwall<partWalls->size(); iwall++ ) {
+                    
+                    // Boundary Condition may be physical or due to domain decomposition
+                    // apply returns 0 if iPart is not in the local domain anymore
+                    //        if omp, create a list per thread
                     for( iPart=first_index[ibin] ; ( int )iPart<last_index[ibin]; iPart++ ) {
-                        double dtgf = params.timestep * smpi->dynamics_invgf[ithread][iPart];
-                        if( !( *partWalls )[iwall]->apply( *particles, iPart, this, dtgf, ener_iPart ) ) {
+                        if( !partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
+                            addPartInExchList( iPart );
                             nrj_lost_per_thd[tid] += ener_iPart;
                         }
                     }
+                    
                 }
                 
-                // Boundary Condition may be physical or due to domain decomposition
-                // apply returns 0 if iPart is not in the local domain anymore
-                //        if omp, create a list per thread
-                for( iPart=first_index[ibin] ; ( int )iPart<last_index[ibin]; iPart++ ) {
-                    if( !partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
-                        addPartInExchList( iPart );
-                        nrj_lost_per_thd[tid] += ener_iPart;
-                    }
-                }
-                
-            }
-            
 #ifdef  __DETAILED_TIMERS
-            patch->patch_timers[3] += MPI_Wtime() - timer;
+                patch->patch_timers[3] += MPI_Wtime() - timer;
 #endif
-            
-            //START EXCHANGE PARTICLES OF THE CURRENT BIN ?
-            
+                
+                //START EXCHANGE PARTICLES OF THE CURRENT BIN ?
+                
 #ifdef  __DETAILED_TIMERS
-            timer = MPI_Wtime();
+                timer = MPI_Wtime();
 #endif
-            
-            // Project currents if not a Test species and charges as well if a diag is needed.
-            // Do not project if a photon
-            if( ( !particles->is_test ) && ( mass > 0 ) ) {
-                Proj->currentsAndDensityWrapper( EMfields, *particles, smpi, first_index[ibin], last_index[ibin], ithread, diag_flag, params.is_spectral, ispec );
-            }
-            
+                
+                // Project currents if not a Test species and charges as well if a diag is needed.
+                // Do not project if a photon
+                if( ( !particles->is_test ) && ( mass > 0 ) ) {
+                    Proj->currentsAndDensityWrapper( EMfields, *particles, smpi, first_index[ibin], last_index[ibin], ithread, diag_flag, params.is_spectral, ispec );
+                }
+                
 #ifdef  __DETAILED_TIMERS
-            patch->patch_timers[2] += MPI_Wtime() - timer;
+                patch->patch_timers[2] += MPI_Wtime() - timer;
 #endif
-            
-        }// ibin
+                
+            }// ibin
+        }
         
         
         for( unsigned int ithd=0 ; ithd<nrj_lost_per_thd.size() ; ithd++ ) {
@@ -838,7 +870,7 @@ void Species::dynamics( double time_dual, unsigned int ispec,
 
     if(time_dual <= time_frozen && diag_flag &&( !particles->is_test ) ) { //immobile particle (at the moment only project density)
         if( params.geometry != "AMcylindrical" ) {
-            double *b_rho=nullptr;
+            fdouble *b_rho=nullptr;
             for( unsigned int ibin = 0 ; ibin < first_index.size() ; ibin ++ ) { //Loop for projection on buffer_proj
                 b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
                 for( iPart=first_index[ibin] ; ( int )iPart<last_index[ibin]; iPart++ ) {
@@ -894,7 +926,7 @@ void Species::projection_for_diags( double time_dual, unsigned int ispec,
     if( diag_flag &&( !particles->is_test ) ) {
     
         if( params.geometry != "AMcylindrical" ) {
-            double *buf[4];
+            fdouble *buf[4];
             
             for( unsigned int ibin = 0 ; ibin < first_index.size() ; ibin ++ ) { //Loop for projection on buffer_proj
             
@@ -995,7 +1027,7 @@ void Species::computeCharge( unsigned int ispec, ElectroMagn *EMfields )
             // Not for now, else rho is incremented twice. Here and dynamics. Must add restartRhoJs and manage independantly diags output
             //b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(bin_start) : &(*EMfields->rho_)(bin_start);
             if( !dynamic_cast<ElectroMagnAM *>( EMfields ) ) {
-                double *b_rho = &( *EMfields->rho_ )( 0 );
+                fdouble *b_rho = &( *EMfields->rho_ )( 0 );
                 
                 for( unsigned int iPart=first_index[ibin] ; ( int )iPart<last_index[ibin]; iPart++ ) {
                     Proj->basic( b_rho, ( *particles ), iPart, 0 );
@@ -1237,59 +1269,88 @@ void Species::reconfiguration( Params &param, Patch *patch )
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Sort particles
+// Merge the particles cell by cell, after the push and before the sort.
+// first_index/last_index still describe the cells before the push: only the particles which stayed in their cell
+// are merged. The removed particles get a cell_key equal to -1 and are dropped by the next sort.
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::mergeParticles( double time_dual )
+{
+    if( time_dual <= time_frozen ) {
+        return;
+    }
+
+    for( unsigned int icell = 0 ; icell < first_index.size() ; icell++ ) {
+        ( *Merge )( mass, *particles, icell, first_index[icell], last_index[icell], count[icell], nmerged_particles );
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Sort particles from scratch: count sort by cell_keys into the spare buffer of particles_sorted.
+// Particles with a cell_key equal to -1 are removed.
+// The particles are split in chunks which build their own histogram and scatter their particles independently.
+// With multithreaded_sort, chunks are OpenMP tasks so that the idle threads of the current parallel region
+// (e.g. waiting at the end of the loop on patches) take part in the sort of a large patch.
 // ---------------------------------------------------------------------------------------------------------------------
 void Species::count_sort_part( Params &params )
 {
-    unsigned int ip, npart, ixy, tot, oc, nxy, token;
-    int ix, iy;
-    double x, y;
+    unsigned int npart, nbin, token, nchunk, chunk_size;
+    int tot, nkey;
     
-    nxy = params.n_space[0]*params.n_space[1];
-    token = ( particles == &particles_sorted[0] );
-    
-    int indices[nxy];
+    nbin  = first_index.size();
     npart = particles->size();
-    //particles_sorted = particles ;
-    particles_sorted[token].initialize( npart, *particles );
+    token = ( particles == &particles_sorted[0] );
     
-    for( unsigned int i=0; i < nxy ; i++ ) {
-        indices[i] = 0 ;
+    nchunk = 1;
+#ifdef _OPENMP
+    if( multithreaded_sort ) {
+        nchunk = min( ( unsigned int )omp_get_num_threads(), npart/min_particles_per_sort_task + 1 );
     }
-    
-    // first loop counts the # of particles in each cell
-    for( ip=0; ip < npart; ip++ ) {
-        x = particles->position( 0, ip )-min_loc;
-        y = particles->position( 1, ip )-min_loc_vec[1];
-        
-        ix = floor( x * dx_inv_[0] ) ;
-        iy = floor( y * dx_inv_[1] ) ;
-        
-        ixy = iy + ix*params.n_space[1];
-        
-        
-        indices[ixy] ++;
+#endif
+    chunk_size = ( npart + nchunk - 1 ) / nchunk;
+    
+    // Number of particles of each chunk in each bin
+    vector<int> offset( nchunk*nbin, 0 );
+    
+    #pragma omp taskloop default( shared ) if( nchunk > 1 )
+    for( unsigned int ichunk=0; ichunk < nchunk; ichunk++ ) {
+        int *hist = &offset[ichunk*nbin];
+        unsigned int ip_end = min( npart, ( ichunk+1 )*chunk_size );
+        for( unsigned int ip=ichunk*chunk_size; ip < ip_end; ip++ ) {
+            int key = particles->cell_keys[ip];
+            if( key != -1 ) {
+                hist[key]++;
+            }
+        }
     }
     
-    // second loop convert the count array in cumulative sum
-    tot=0;
-    for( ixy=0; ixy < nxy; ixy++ ) {
-        oc = indices[ixy];
-        indices[ixy] = tot;
-        tot += oc;
+    // Prefix sum over the bins then the chunks: offset becomes the first slot of each chunk in each bin
+    tot = 0;
+    for( unsigned int ibin=0; ibin < nbin; ibin++ ) {
+        first_index[ibin] = tot;
+        for( unsigned int ichunk=0; ichunk < nchunk; ichunk++ ) {
+            nkey = offset[ichunk*nbin+ibin];
+            offset[ichunk*nbin+ibin] = tot;
+            tot += nkey;
+        }
+        last_index[ibin] = tot;
     }
     
-    // last loop puts the particles and update the count array
-    for( ip=0; ip < npart; ip++ ) {
-        x = particles->position( 0, ip )-min_loc;
-        y = particles->position( 1, ip )-min_loc_vec[1];
-        
-        ix = floor( x * dx_inv_[1] ) ;
-        iy = floor( y * dx_inv_[2] ) ;
-        
-        ixy = iy + ix*params.n_space[1];
-        particles->overwrite_part( ip, particles_sorted[token], indices[ixy] );
-        indices[ixy]++;
+    particles_sorted[token].initialize( tot, *particles );
+    
+    // Each particle is copied once, at the next free slot of its chunk in its bin
+    #pragma omp taskloop default( shared ) if( nchunk > 1 )
+    for( unsigned int ichunk=0; ichunk < nchunk; ichunk++ ) {
+        int *dest = &offset[ichunk*nbin];
+        unsigned int ip_end = min( npart, ( ichunk+1 )*chunk_size );
+        for( unsigned int ip=ichunk*chunk_size; ip < ip_end; ip++ ) {
+            int key = particles->cell_keys[ip];
+            if( key == -1 ) {
+                continue;
+            }
+            int ip_dest = dest[key]++;
+            particles->overwrite_part( ip, particles_sorted[token], ip_dest );
+            particles_sorted[token].cell_keys[ip_dest] = key;
+        }
     }
     
     particles = &particles_sorted[token] ;
@@ -2042,7 +2103,7 @@ void Species::ponderomotive_update_position_and_currents( double time_dual, unsi
     else { // immobile particle
     
         if( diag_flag &&( !particles->is_test ) ) {
-            double *b_rho=nullptr;
+            fdouble *b_rho=nullptr;
             for( unsigned int ibin = 0 ; ibin < first_index.size() ; ibin ++ ) { //Loop for projection on buffer_proj
                 // only 3D is implemented actually
                 if( nDim_field==2 ) {
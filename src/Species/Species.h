@@ -29,6 +29,8 @@ class Field3D;
 class Patch;
 class SimWindow;
 class Radiation;
+class Merging;
+class DynamicsPipeline;
 
 
 //! class Species
@@ -93,6 +95,24 @@ public:
     //! Time for which the species is frozen
     double time_frozen;
     
+    //! Particle merging method ("none" or "vranic")
+    std::string merging_method;
+    
+    //! Time selection of the particle merging
+    TimeSelection *merging_time_selection;
+    
+    //! Minimum number of particles in a cell to merge its particles
+    unsigned int merge_min_particles_per_cell;
+    
+    //! Minimum number of particles merged together
+    unsigned int merge_min_packet_size;
+    
+    //! Maximum number of particles merged together
+    unsigned int merge_max_packet_size;
+    
+    //! Number of momentum-space cells in each direction for the merging
+    std::vector<unsigned int> merge_momentum_cell_size;
+    
     //! logical true if particles radiate
     bool radiating;
     
@@ -190,6 +210,10 @@ public:
     std::vector<int> first_index, last_index;
     //! Array counting the occurence of each cell key
     std::vector<int> count;
+    //! Number of particles relocated by the cell sort since the last profiling
+    unsigned int nparts_moved_by_sort;
+    //! Sort kernel: true to always count sort from scratch, with the work shared between OpenMP threads
+    bool multithreaded_sort;
     //! sub dimensions of buffers for dim > 1
     std::vector<unsigned int> b_dim;
     
@@ -231,6 +255,8 @@ public:
     double nrj_new_particles;
     //! Accumulate energy lost by the particle with the radiation
     double nrj_radiation;
+    //! Accumulate the number of particles removed by the merging
+    double nmerged_particles;
     
     //! whether to choose vectorized operators with respective sorting methods
     int vectorized_operators;
@@ -247,6 +273,9 @@ public:
     //! Multiphoton Breit-wheeler
     MultiphotonBreitWheeler *Multiphoton_Breit_Wheeler_process;
     
+    //! Particle merging method
+    Merging *Merge;
+    
     //! Boundary condition for the Particles of the considered Species
     PartBoundCond *partBoundCond;
     
@@ -263,6 +292,10 @@ public:
     //! Projector
     Projector *Proj;
     
+    //! Interpolation, push, boundary conditions and projection with the operator types resolved at compile time
+    //! (NULL if not instantiated for these operators: they are then called through their virtual interfaces)
+    DynamicsPipeline *Pipeline = NULL;
+    
     // -----------------------------------------------------------------------------
     //  5. Methods
     
@@ -388,8 +421,15 @@ public:
     //! the best mode from the particle distribution
     virtual void reconfiguration( Params &param, Patch   *patch );
     
+    //! Merge the particles of each cell, the removed ones are dropped by the next sort
+    void mergeParticles( double time_dual );
+    
+    //! Complete count sort of the particles by cell_keys into the spare particles_sorted buffer
     void count_sort_part( Params &param );
     
+    //! Minimum number of particles handled by each OpenMP task of the multithreaded sort
+    static const unsigned int min_particles_per_sort_task = 4096;
+    
     //!
     virtual void add_space_for_a_particle()
     {
@@ -460,6 +500,7 @@ public:
         nrj_mw_lost = 0;
         nrj_new_particles = 0;
         //nrj_radiation = 0;
+        nmerged_particles = 0;
     }
     
     inline void storeNRJlost( double nrj )
@@ -490,6 +531,7 @@ public:
         //speciesSize *= getNbrOfParticles();
         int speciesSize( 0 );
         speciesSize += particles->double_prop.size()*sizeof( double );
+        speciesSize += particles->pdouble_prop.size()*sizeof( pdouble );
         speciesSize += particles->short_prop.size()*sizeof( short );
         speciesSize += particles->uint64_prop.size()*sizeof( uint64_t );
         speciesSize *= getParticlesCapacity();
@@ -411,6 +411,56 @@ public:
 
         PyTools::extract( "c_part_max", thisSpecies->c_part_max, "Species", ispec );
 
+        // Kernel of the cell sort
+        std::string sort_kernel( "incremental" );
+        PyTools::extract( "sort_kernel", sort_kernel, "Species", ispec );
+        if( sort_kernel == "multithreaded" ) {
+            thisSpecies->multithreaded_sort = true;
+            if( params.vectorization_mode == "off" && patch->isMaster() ) {
+                WARNING( "For species '" << species_name << "', sort_kernel = 'multithreaded' only applies to particles sorted per cell (vectorization)" );
+            }
+        } else if( sort_kernel != "incremental" ) {
+            ERROR( "For species '" << species_name << "', sort_kernel must be 'incremental' or 'multithreaded'" );
+        }
+
+        // Particle merging
+        PyTools::extract( "merging_method", thisSpecies->merging_method, "Species", ispec );
+        std::transform( thisSpecies->merging_method.begin(), thisSpecies->merging_method.end(), thisSpecies->merging_method.begin(), tolower );
+        if( thisSpecies->merging_method != "none" ) {
+            if( thisSpecies->merging_method != "vranic" ) {
+                ERROR( "For species '" << species_name << "', merging_method must be 'none' or 'vranic'" );
+            }
+            // The merging relies on the particles being sorted per cell
+            if( params.vectorization_mode == "off" ) {
+                ERROR( "For species '" << species_name << "', merging_method requires the vectorization (particles sorted per cell)" );
+            }
+            if( params.vectorization_mode == "adaptive_mixed_sort" && patch->isMaster() ) {
+                WARNING( "For species '" << species_name << "', particles are only merged while the species uses the vectorized operators" );
+            }
+            thisSpecies->merging_time_selection = new TimeSelection( PyTools::extract_py( "merge_every", "Species", ispec ), "Species merge_every" );
+            PyTools::extract( "merge_min_particles_per_cell", thisSpecies->merge_min_particles_per_cell, "Species", ispec );
+            PyTools::extract( "merge_min_packet_size", thisSpecies->merge_min_packet_size, "Species", ispec );
+            PyTools::extract( "merge_max_packet_size", thisSpecies->merge_max_packet_size, "Species", ispec );
+            if( thisSpecies->merge_min_packet_size < 3 ) {
+                ERROR( "For species '" << species_name << "', merge_min_packet_size must be at least 3" );
+            }
+            if( thisSpecies->merge_max_packet_size < thisSpecies->merge_min_packet_size ) {
+                ERROR( "For species '" << species_name << "', merge_max_packet_size must be larger than merge_min_packet_size" );
+            }
+            PyTools::extract( "merge_momentum_cell_size", thisSpecies->merge_momentum_cell_size, "Species", ispec );
+            if( thisSpecies->merge_momentum_cell_size.size() != 3 ) {
+                ERROR( "For species '" << species_name << "', merge_momentum_cell_size must be a list of 3 integers" );
+            }
+            for( unsigned int i=0; i<3; i++ ) {
+                if( thisSpecies->merge_momentum_cell_size[i] == 0 ) {
+                    ERROR( "For species '" << species_name << "', merge_momentum_cell_size must be strictly positive" );
+                }
+            }
+            if( patch->isMaster() ) {
+                MESSAGE( 2, "> Particle merging with method: `" << thisSpecies->merging_method << "`" );
+            }
+        }
+
         PyTools::extract( "time_frozen", thisSpecies->time_frozen, "Species", ispec );
         if( thisSpecies->time_frozen > 0 && thisSpecies->momentum_initialization!="cold" ) {
             if( patch->isMaster() ) {
@@ -471,6 +521,17 @@ public:
                 }
             }
         }
+        // the former positions can only be recomputed if the boundaries do not modify the particles
+        if( params.reconstruct_old_positions ) {
+            for( unsigned int iDim=0; iDim<params.nDim_particle; iDim++ ) {
+                for( unsigned int iside=0; iside<2; iside++ ) {
+                    if( thisSpecies->boundary_conditions[iDim][iside] != "periodic"
+                            && thisSpecies->boundary_conditions[iDim][iside] != "remove" ) {
+                        ERROR( "For species '" << species_name << "', boundary_conditions `" << thisSpecies->boundary_conditions[iDim][iside] << "` incompatible with Main.reconstruct_old_positions (only `periodic` and `remove`)" );
+                    }
+                }
+            }
+        }
         // for thermalizing BCs on particles check if thermal_boundary_temperature is correctly defined
         bool has_temperature = PyTools::extract( "thermal_boundary_temperature", thisSpecies->thermal_boundary_temperature, "Species", ispec );
         bool has_velocity    = PyTools::extract( "thermal_boundary_velocity", thisSpecies->thermal_boundary_velocity, "Species", ispec );
@@ -788,6 +849,15 @@ public:
         newSpecies->max_charge                               = species->max_charge;
         newSpecies->tracking_diagnostic                      = species->tracking_diagnostic;
         newSpecies->ponderomotive_dynamics                   = species->ponderomotive_dynamics;
+        newSpecies->multithreaded_sort                       = species->multithreaded_sort;
+        newSpecies->merging_method                           = species->merging_method;
+        if( species->merging_time_selection ) {
+            newSpecies->merging_time_selection               = new TimeSelection( species->merging_time_selection );
+        }
+        newSpecies->merge_min_particles_per_cell             = species->merge_min_particles_per_cell;
+        newSpecies->merge_min_packet_size                    = species->merge_min_packet_size;
+        newSpecies->merge_max_packet_size                    = species->merge_max_packet_size;
+        newSpecies->merge_momentum_cell_size                 = species->merge_momentum_cell_size;
 
         if( newSpecies->mass==0 ) {
             newSpecies->multiphoton_Breit_Wheeler[0]         = species->multiphoton_Breit_Wheeler[0];
@@ -18,6 +18,7 @@
 #include "BoundaryConditionType.h"
 
 #include "ElectroMagn.h"
+#include "ElectroMagnAM.h"
 #include "Interpolator.h"
 #include "InterpolatorFactory.h"
 #include "Profile.h"
@@ -46,6 +47,7 @@ using namespace std;
 SpeciesV::SpeciesV( Params &params, Patch *patch ) :
     Species( params, patch )
 {
+    isAM_ = params.geometry == "AMcylindrical";
     initCluster( params );
     npack_ = 0 ;
     packsize_ = 0;
@@ -64,7 +66,7 @@ SpeciesV::~SpeciesV()
 void SpeciesV::initCluster( Params &params )
 {
     int ncells = 1;
-    for( unsigned int iDim=0 ; iDim<nDim_particle ; iDim++ ) {
+    for( unsigned int iDim=0 ; iDim<params.nDim_field ; iDim++ ) {
         ncells *= ( params.n_space[iDim]+1 );
     }
     last_index.resize( ncells, 0 );
@@ -80,17 +82,17 @@ void SpeciesV::initCluster( Params &params )
     f_dim2 =  params.n_space[2] + 2 * oversize[2] +1;
     
     b_dim.resize( params.nDim_field, 1 );
-    if( nDim_particle == 1 ) {
+    if( params.nDim_field == 1 ) {
         b_dim[0] = ( 1 + clrw ) + 2 * oversize[0];
         f_dim1 = 1;
         f_dim2 = 1;
     }
-    if( nDim_particle == 2 ) {
+    if( params.nDim_field == 2 ) {
         b_dim[0] = ( 1 + clrw ) + 2 * oversize[0]; // There is a primal number of bins.
         b_dim[1] =  f_dim1;
         f_dim2 = 1;
     }
-    if( nDim_particle == 3 ) {
+    if( params.nDim_field == 3 ) {
         b_dim[0] = ( 1 + clrw ) + 2 * oversize[0]; // There is a primal number of bins.
         b_dim[1] = f_dim1;
         b_dim[2] = f_dim2;
@@ -135,7 +137,7 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
         //else
         //    npack_ *= (f_dim0-2*oversize[0]);
         
-        if( nDim_particle == 3 ) {
+        if( nDim_field == 3 ) {
             packsize_ *= ( f_dim2-2*oversize[2] );
         }
     }
@@ -152,8 +154,11 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
     // -------------------------------
     // calculate the particle dynamics
     // -------------------------------
-    if( time_dual>time_frozen || Ionize ) { // moving particle
-    
+    if( params.fused_kernel && time_dual>time_frozen && mass>0 && pusher!="borisnr"
+            && !Ionize && !Radiate && !Multiphoton_Breit_Wheeler_process ) {
+        fused_dynamics( time_dual, ispec, EMfields, params, diag_flag, partWalls, patch, smpi );
+    } else if( time_dual>time_frozen || Ionize ) { // moving particle
+        
         smpi->dynamics_resize( ithread, nDim_field, last_index.back(), params.geometry=="AMcylindrical" );
         
         //Point to local thread dedicated buffers
@@ -166,9 +171,9 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
         }
         
         for( unsigned int ipack = 0 ; ipack < npack_ ; ipack++ ) {
-        
+            
             int nparts_in_pack = last_index[( ipack+1 ) * packsize_-1 ];
-            smpi->dynamics_resize( ithread, nDim_particle, nparts_in_pack );
+            smpi->dynamics_resize( ithread, nDim_field, nparts_in_pack, isAM_ );
             
 #ifdef  __DETAILED_TIMERS
             timer = MPI_Wtime();
@@ -179,7 +184,7 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
                 Interp->fieldsWrapper( EMfields, *particles, smpi, &( first_index[ipack*packsize_+scell] ),
                                        &( last_index[ipack*packsize_+scell] ),
                                        ithread, first_index[ipack*packsize_] );
-                                       
+            
 #ifdef  __DETAILED_TIMERS
             patch->patch_timers[0] += MPI_Wtime() - timer;
 #endif
@@ -198,7 +203,7 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
             }
             
             if ( time_dual <= time_frozen ) continue;
-
+            
             // Radiation losses
             if( Radiate ) {
 #ifdef  __DETAILED_TIMERS
@@ -209,7 +214,7 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
                     ( *Radiate )( *particles, this->photon_species, smpi,
                                   RadiationTables,
                                   first_index[scell], last_index[scell], ithread );
-                                  
+                    
                     // Update scalar variable for diagnostics
                     nrj_radiation += Radiate->getRadiatedEnergy();
                     
@@ -231,13 +236,13 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
                 timer = MPI_Wtime();
 #endif
                 for( unsigned int scell = 0 ; scell < first_index.size() ; scell++ ) {
-                
+                    
                     // Pair generation process
                     ( *Multiphoton_Breit_Wheeler_process )( *particles,
                                                             smpi,
                                                             MultiphotonBreitWheelerTables,
                                                             first_index[scell], last_index[scell], ithread );
-                                                            
+                    
                     // Update scalar variable for diagnostics
                     // We reuse nrj_radiation for the pairs
                     nrj_radiation += Multiphoton_Breit_Wheeler_process->getPairEnergy();
@@ -248,11 +253,7 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
                             first_index[scell],
                             last_index[scell],
                             ithread );
-                            
-                    // Suppression of the decayed photons into pairs
-                    Multiphoton_Breit_Wheeler_process->decayed_photon_cleaning(
-                        *particles, smpi, scell, first_index.size(), &first_index[0], &last_index[0], ithread );
-                        
+                    
                 }
 #ifdef  __DETAILED_TIMERS
                 patch->patch_timers[6] += MPI_Wtime() - timer;
@@ -267,17 +268,12 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
             ( *Push )( *particles, smpi, first_index[ipack*packsize_],
                        last_index[ipack*packsize_+packsize_-1],
                        ithread, first_index[ipack*packsize_] );
-                       
+            
 #ifdef  __DETAILED_TIMERS
             patch->patch_timers[1] += MPI_Wtime() - timer;
             timer = MPI_Wtime();
 #endif
             
-            unsigned int length[3];
-            length[0]=0;
-            length[1]=params.n_space[1]+1;
-            length[2]=params.n_space[2]+1;
-            
             for( unsigned int scell = 0 ; scell < packsize_ ; scell++ ) {
                 // Apply wall and boundary conditions
                 if( mass>0 ) {
@@ -300,10 +296,7 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
                             particles->cell_keys[iPart] = -1;
                         } else {
                             //Compute cell_keys of remaining particles
-                            for( unsigned int i = 0 ; i<nDim_particle; i++ ) {
-                                particles->cell_keys[iPart] *= this->length_[i];
-                                particles->cell_keys[iPart] += round( ( particles->position( i, iPart )-min_loc_vec[i] ) * dx_inv_[i] );
-                            }
+                            particles->cell_keys[iPart] = cellKey( *particles, iPart );
                             //First reduction of the count sort algorithm. Lost particles are not included.
                             count[particles->cell_keys[iPart]] ++;
                         }
@@ -322,16 +315,16 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
                     // Boundary Condition may be physical or due to domain decomposition
                     // apply returns 0 if iPart is not in the local domain anymore
                     for( iPart=first_index[scell] ; ( int )iPart<last_index[scell]; iPart++ ) {
-                        if( !partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
+                        // Photons decayed into pairs (weight <= 0) are tombstones: the sort drops them
+                        if( Multiphoton_Breit_Wheeler_process && particles->weight( iPart ) <= 0 ) {
+                            particles->cell_keys[iPart] = -1;
+                        } else if( !partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
                             addPartInExchList( iPart );
                             nrj_lost_per_thd[tid] += ener_iPart;
                             particles->cell_keys[iPart] = -1;
                         } else {
                             //Compute cell_keys of remaining particles
-                            for( unsigned int i = 0 ; i<nDim_particle; i++ ) {
-                                particles->cell_keys[iPart] *= length[i];
-                                particles->cell_keys[iPart] += round( ( particles->position( i, iPart )-min_loc_vec[i] ) * dx_inv_[i] );
-                            }
+                            particles->cell_keys[iPart] = cellKey( *particles, iPart );
                             //First reduction of the count sort algorithm. Lost particles are not included.
                             count[particles->cell_keys[iPart]] ++;
                         }
@@ -350,7 +343,7 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
 #ifdef  __DETAILED_TIMERS
                 timer = MPI_Wtime();
 #endif
-                
+            
             for( unsigned int scell = 0 ; scell < packsize_ ; scell++ )
                 Proj->currentsAndDensityWrapper(
                     EMfields, *particles, smpi, first_index[ipack*packsize_+scell],
@@ -359,7 +352,7 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
                     diag_flag, params.is_spectral,
                     ispec, ipack*packsize_+scell, first_index[ipack*packsize_]
                 );
-                
+            
 #ifdef  __DETAILED_TIMERS
             patch->patch_timers[2] += MPI_Wtime() - timer;
 #endif
@@ -369,10 +362,10 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
             }
         } // End loop on packs
     } //End if moving or ionized particles  
-
+    
     if(time_dual <= time_frozen && diag_flag &&( !particles->is_test ) ) { //immobile particle (at the moment only project density)
-
-        double *b_rho=nullptr;
+        
+        fdouble *b_rho=nullptr;
         for( unsigned int scell = 0 ; scell < first_index.size() ; scell ++ ) { //Loop for projection on buffer_proj
             b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
             for( iPart=first_index[scell] ; ( int )iPart<last_index[scell]; iPart++ ) {
@@ -380,10 +373,104 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
             } //End loop on particles
         }//End loop on scells
     } // End projection for frozen particles
-
+    
 }//END dynamics
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Particle dynamics fused per cell: for each cell, interpolation, push, boundary conditions and projection
+// are applied in sequence before moving to the next cell. The operator buffers are sized to the most populated
+// cell instead of the whole patch, so that they stay in the L1/L2 cache between the operators.
+// Ionization and QED processes, which act on all particles before the push, are not supported.
+// ---------------------------------------------------------------------------------------------------------------------
+void SpeciesV::fused_dynamics( double time_dual, unsigned int ispec,
+                               ElectroMagn *EMfields,
+                               Params &params, bool diag_flag,
+                               PartWalls *partWalls, Patch *patch, SmileiMPI *smpi )
+{
+    int ithread;
+#ifdef _OPENMP
+    ithread = omp_get_thread_num();
+#else
+    ithread = 0;
+#endif
+    
+#ifdef  __DETAILED_TIMERS
+    double timer = MPI_Wtime();
+#endif
+    
+    double ener_iPart( 0. );
+    double nrj_lost( 0. );
+    
+    // Buffers indexed relatively to the first particle of the current cell
+    int max_cell_nparts( 0 );
+    for( unsigned int icell = 0 ; icell < first_index.size() ; icell++ ) {
+        max_cell_nparts = max( max_cell_nparts, last_index[icell]-first_index[icell] );
+    }
+    smpi->dynamics_resize( ithread, nDim_field, max_cell_nparts );
+    double *invgf = &( smpi->dynamics_invgf[ithread][0] );
+    
+    //Prepare for sorting
+    for( unsigned int i=0; i<count.size(); i++ ) {
+        count[i] = 0;
+    }
+    
+    for( unsigned int icell = 0 ; icell < first_index.size() ; icell++ ) {
+        int ipart_ref = first_index[icell];
+        if( last_index[icell] == ipart_ref ) {
+            continue;
+        }
+        
+        // Interpolate the fields at the particle position
+        Interp->fieldsWrapper( EMfields, *particles, smpi, &( first_index[icell] ), &( last_index[icell] ), ithread, ipart_ref );
+        
+        // Push the particles
+        ( *Push )( *particles, smpi, first_index[icell], last_index[icell], ithread, ipart_ref );
+        
+        // Apply wall and boundary conditions
+        for( unsigned int iwall=0; iwall<partWalls->size(); iwall++ ) {
+            for( int iPart=first_index[icell] ; iPart<last_index[icell]; iPart++ ) {
+                double dtgf = params.timestep * invgf[iPart-ipart_ref];
+                if( !( *partWalls )[iwall]->apply( *particles, iPart, this, dtgf, ener_iPart ) ) {
+                    nrj_lost += mass * ener_iPart;
+                }
+            }
+        }
+        
+        // Boundary Condition may be physical or due to domain decomposition
+        // apply returns 0 if iPart is not in the local domain anymore
+        for( int iPart=first_index[icell] ; iPart<last_index[icell]; iPart++ ) {
+            if( !partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
+                addPartInExchList( iPart );
+                nrj_lost += mass * ener_iPart;
+                particles->cell_keys[iPart] = -1;
+            } else {
+                //Compute cell_keys of remaining particles
+                particles->cell_keys[iPart] = cellKey( *particles, iPart );
+                //First reduction of the count sort algorithm. Lost particles are not included.
+                count[particles->cell_keys[iPart]] ++;
+            }
+        }
+        
+        // Project currents if not a Test species and charges as well if a diag is needed.
+        if( !particles->is_test ) {
+            Proj->currentsAndDensityWrapper(
+                EMfields, *particles, smpi, first_index[icell], last_index[icell],
+                ithread, diag_flag, params.is_spectral, ispec, icell, ipart_ref
+            );
+        }
+    }
+    
+    nrj_bc_lost += nrj_lost;
+    
+#ifdef  __DETAILED_TIMERS
+    // The operators are not timed separately in the fused kernel
+    patch->patch_timers[1] += MPI_Wtime() - timer;
+#endif
+    
+}//END fused_dynamics
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // For all particles of the species
 //   - increment the charge (projection)
@@ -395,10 +482,21 @@ void SpeciesV::computeCharge( unsigned int ispec, ElectroMagn *EMfields )
     // calculate the particle charge
     // -------------------------------
     if( ( !particles->is_test ) ) {
-        double *b_rho=&( *EMfields->rho_ )( 0 );
-        
-        for( unsigned int iPart=first_index[0] ; ( int )iPart<last_index[last_index.size()-1]; iPart++ ) {
-            Proj->basic( b_rho, ( *particles ), iPart, 0 );
+        if( !isAM_ ) {
+            fdouble *b_rho=&( *EMfields->rho_ )( 0 );
+            
+            for( unsigned int iPart=first_index[0] ; ( int )iPart<last_index[last_index.size()-1]; iPart++ ) {
+                Proj->basic( b_rho, ( *particles ), iPart, 0 );
+            }
+        } else {
+            ElectroMagnAM *emAM = static_cast<ElectroMagnAM *>( EMfields );
+            unsigned int Nmode = emAM->rho_AM_.size();
+            for( unsigned int imode=0; imode<Nmode; imode++ ) {
+                complex<double> *b_rho = &( *emAM->rho_AM_[imode] )( 0 );
+                for( unsigned int iPart=first_index[0] ; ( int )iPart<last_index[last_index.size()-1]; iPart++ ) {
+                    Proj->basicForComplex( b_rho, ( *particles ), iPart, 0, imode );
+                }
+            }
         }
         
     }
@@ -411,7 +509,7 @@ void SpeciesV::computeCharge( unsigned int ispec, ElectroMagn *EMfields )
 // ---------------------------------------------------------------------------------------------------------------------
 void SpeciesV::sort_part( Params &params )
 {
-    unsigned int npart, ncell;
+    unsigned int npart, ncell, nmoved, nrecv;
     int ip_dest, cell_target;
     unsigned int length[3];
     vector<int> buf_cell_keys[3][2];
@@ -437,11 +535,7 @@ void SpeciesV::sort_part( Params &params )
             buf_cell_keys[idim][ineighbor].resize( MPIbuff.part_index_recv_sz[idim][ineighbor] );
             #pragma omp simd
             for( unsigned int ip=0; ip < MPIbuff.part_index_recv_sz[idim][ineighbor]; ip++ ) {
-                for( unsigned int ipos=0; ipos < nDim_particle ; ipos++ ) {
-                    double X = MPIbuff.partRecv[idim][ineighbor].position( ipos, ip )-min_loc_vec[ipos];
-                    int IX = round( X * dx_inv_[ipos] );
-                    buf_cell_keys[idim][ineighbor][ip] = buf_cell_keys[idim][ineighbor][ip] * length[ipos] + IX;
-                }
+                buf_cell_keys[idim][ineighbor][ip] = cellKey( MPIbuff.partRecv[idim][ineighbor], ip );
             }
             //Can we vectorize this reduction ?
             for( unsigned int ip=0; ip < MPIbuff.part_index_recv_sz[idim][ineighbor]; ip++ ) {
@@ -450,6 +544,40 @@ void SpeciesV::sort_part( Params &params )
         }
     }
     
+    // Particles which changed cell or left the patch, plus the arrived ones, have to be relocated
+    nmoved = 0;
+    for( unsigned int ic=0; ic < ncell; ic++ ) {
+        for( int ip=first_index[ic]; ip < last_index[ic]; ip++ ) {
+            nmoved += ( particles->cell_keys[ip] != ( int )ic );
+        }
+    }
+    nrecv = 0;
+    for( unsigned int idim=0; idim < nDim_particle ; idim++ ) {
+        for( unsigned int ineighbor=0 ; ineighbor < 2 ; ineighbor++ ) {
+            nrecv += MPIbuff.part_index_recv_sz[idim][ineighbor];
+        }
+    }
+    nmoved += nrecv;
+    nparts_moved_by_sort += nmoved;
+    
+    // Too many particles to relocate one by one, or multithreaded kernel: append the arrived particles and sort from scratch
+    if( multithreaded_sort || nmoved > params.incremental_sort_threshold * npart ) {
+        particles->resize( npart + nrecv, nDim_particle );
+        particles->cell_keys.resize( npart + nrecv );
+        ip_dest = npart;
+        for( unsigned int idim=0; idim < nDim_particle ; idim++ ) {
+            for( unsigned int ineighbor=0 ; ineighbor < 2 ; ineighbor++ ) {
+                for( unsigned int ip=0; ip < MPIbuff.part_index_recv_sz[idim][ineighbor]; ip++ ) {
+                    MPIbuff.partRecv[idim][ineighbor].overwrite_part( ip, *particles, ip_dest );
+                    particles->cell_keys[ip_dest] = buf_cell_keys[idim][ineighbor][ip];
+                    ip_dest++;
+                }
+            }
+        }
+        count_sort_part( params );
+        return;
+    }
+    
     // second loop convert the count array in cumulative sum
     first_index[0]=0;
     for( unsigned int ic=1; ic < ncell; ic++ ) {
@@ -575,19 +703,13 @@ void SpeciesV::compute_part_cell_keys( Params &params )
     //Compute part_cell_keys at patch creation. This operation is normally done in the pusher to avoid additional particles pass.
     
     unsigned int ip, npart;
-    int IX;
-    double X;
     
     npart = particles->size(); //Number of particles
     
     #pragma omp simd
     for( ip=0; ip < npart ; ip++ ) {
         // Counts the # of particles in each cell (or sub_cell) and store it in slast_index.
-        for( unsigned int ipos=0; ipos < nDim_particle ; ipos++ ) {
-            X = particles->position( ipos, ip )-min_loc_vec[ipos];
-            IX = round( X * dx_inv_[ipos] );
-            particles->cell_keys[ip] = particles->cell_keys[ip] * this->length_[ipos] + IX;
-        }
+        particles->cell_keys[ip] = cellKey( *particles, ip );
     }
     for( ip=0; ip < npart ; ip++ ) {
         count[particles->cell_keys[ip]] ++ ;
@@ -609,16 +731,13 @@ void SpeciesV::compute_bin_cell_keys( Params &params, int istart, int iend )
     #pragma omp simd
     for( int ip=istart; ip < iend; ip++ ) {
         // Counts the # of particles in each cell (or sub_cell) and store it in slast_index.
-        for( unsigned int ipos=0; ipos < nDim_particle ; ipos++ ) {
-            particles->cell_keys[ip] *= this->length_[ipos];
-            particles->cell_keys[ip] += round( ( particles->position( ipos, ip )-min_loc_vec[ipos] ) * dx_inv_[ipos] );
-        }
+        particles->cell_keys[ip] = cellKey( *particles, ip );
     }
 }
 
 void SpeciesV::importParticles( Params &params, Patch *patch, Particles &source_particles, vector<Diagnostic *> &localDiags )
 {
-
+    
     unsigned int npart = source_particles.size(), scell, ii, nbin=first_index.size();
     
     // If this species is tracked, set the particle IDs
@@ -626,14 +745,6 @@ void SpeciesV::importParticles( Params &params, Patch *patch, Particles &source_
         dynamic_cast<DiagnosticTrack *>( localDiags[tracking_diagnostic] )->setIDs( source_particles );
     }
     
-    unsigned int length[3];
-    length[0]=0;
-    length[1]=params.n_space[1]+1;
-    length[2]=params.n_space[2]+1;
-    
-    int IX;
-    double X;
-    
     // std::cerr << "SpeciesV::importParticles "
     //           << " for "<< this->name
     //           << " in patch (" << patch->Pcoordinates[0] << "," <<  patch->Pcoordinates[1] << "," <<  patch->Pcoordinates[2] << ") "
@@ -645,14 +756,9 @@ void SpeciesV::importParticles( Params &params, Patch *patch, Particles &source_
     
     // Move particles
     for( unsigned int i=0; i<npart; i++ ) {
-    
+        
         // Compute the receiving bin index
-        scell = 0;
-        for( unsigned int ipos=0; ipos < nDim_particle ; ipos++ ) {
-            X = source_particles.position( ipos, i )-min_loc_vec[ipos];
-            IX = round( X * dx_inv_[ipos] );
-            scell = scell * length[ipos] + IX;
-        }
+        scell = cellKey( source_particles, i );
         
         // Copy particle to the correct bin
         source_particles.cp_particle( i, *particles, last_index[scell] );
@@ -684,7 +790,7 @@ void SpeciesV::ponderomotive_update_susceptibility_and_momentum( double time_dua
         Patch *patch, SmileiMPI *smpi,
         std::vector<Diagnostic *> &localDiags )
 {
-
+    
 ////////////////////////////// new vectorized
     int ithread;
 #ifdef _OPENMP
@@ -706,7 +812,7 @@ void SpeciesV::ponderomotive_update_susceptibility_and_momentum( double time_dua
         //else
         //    npack_ *= (f_dim0-2*oversize[0]);
         
-        if( nDim_particle == 3 ) {
+        if( nDim_field == 3 ) {
             packsize_ *= ( f_dim2-2*oversize[2] );
         }
     }
@@ -716,14 +822,14 @@ void SpeciesV::ponderomotive_update_susceptibility_and_momentum( double time_dua
     // calculate the particle dynamics
     // -------------------------------
     if( time_dual>time_frozen ) { // advance particle momentum
-    
-        for( unsigned int ipack = 0 ; ipack < npack_ ; ipack++ ) {
         
+        for( unsigned int ipack = 0 ; ipack < npack_ ; ipack++ ) {
+            
             // ipack start @ first_index [ ipack * packsize_ ]
             // ipack end   @ last_index [ ipack * packsize_ + packsize_ - 1 ]
             //int nparts_in_pack = last_index[ (ipack+1) * packsize_-1 ] - first_index [ ipack * packsize_ ];
             int nparts_in_pack = last_index[( ipack+1 ) * packsize_-1 ];
-            smpi->dynamics_resize( ithread, nDim_particle, nparts_in_pack );
+            smpi->dynamics_resize( ithread, nDim_field, nparts_in_pack, isAM_ );
             
 #ifdef  __DETAILED_TIMERS
             timer = MPI_Wtime();
@@ -759,7 +865,7 @@ void SpeciesV::ponderomotive_update_susceptibility_and_momentum( double time_dua
         }
         
     } else { // immobile particle (at the moment only project density)
-    
+        
     }//END if time vs. time_frozen
     
 } // end ponderomotive_update_susceptibility_and_momentum
@@ -775,7 +881,7 @@ void SpeciesV::ponderomotive_project_susceptibility( double time_dual, unsigned
         Patch *patch, SmileiMPI *smpi,
         std::vector<Diagnostic *> &localDiags )
 {
-
+    
 ////////////////////////////// new vectorized
     int ithread;
 #ifdef _OPENMP
@@ -797,7 +903,7 @@ void SpeciesV::ponderomotive_project_susceptibility( double time_dual, unsigned
         //else
         //    npack_ *= (f_dim0-2*oversize[0]);
         
-        if( nDim_particle == 3 ) {
+        if( nDim_field == 3 ) {
             packsize_ *= ( f_dim2-2*oversize[2] );
         }
     }
@@ -807,14 +913,14 @@ void SpeciesV::ponderomotive_project_susceptibility( double time_dual, unsigned
     // calculate the particle dynamics
     // -------------------------------
     if( time_dual>time_frozen ) { // advance particle momentum
-    
-        for( unsigned int ipack = 0 ; ipack < npack_ ; ipack++ ) {
         
+        for( unsigned int ipack = 0 ; ipack < npack_ ; ipack++ ) {
+            
             // ipack start @ first_index [ ipack * packsize_ ]
             // ipack end   @ last_index [ ipack * packsize_ + packsize_ - 1 ]
             //int nparts_in_pack = last_index[ (ipack+1) * packsize_-1 ] - first_index [ ipack * packsize_ ];
             int nparts_in_pack = last_index[( ipack+1 ) * packsize_-1 ];
-            smpi->dynamics_resize( ithread, nDim_particle, nparts_in_pack );
+            smpi->dynamics_resize( ithread, nDim_field, nparts_in_pack, isAM_ );
             
 #ifdef  __DETAILED_TIMERS
             timer = MPI_Wtime();
@@ -842,7 +948,7 @@ void SpeciesV::ponderomotive_project_susceptibility( double time_dual, unsigned
         }
         
     } else { // immobile particle (at the moment only project density)
-    
+        
     }//END if time vs. time_frozen
     
 } // end ponderomotive_project_susceptibility
@@ -860,8 +966,8 @@ void SpeciesV::ponderomotive_update_position_and_currents( double time_dual, uns
         Patch *patch, SmileiMPI *smpi,
         std::vector<Diagnostic *> &localDiags )
 {
-
-
+    
+    
     int ithread;
 #ifdef _OPENMP
     ithread = omp_get_thread_num();
@@ -886,17 +992,17 @@ void SpeciesV::ponderomotive_update_position_and_currents( double time_dual, uns
     // calculate the particle dynamics
     // -------------------------------
     if( time_dual>time_frozen ) { // moving particle
-    
+        
         //Prepare for sorting
         for( unsigned int i=0; i<count.size(); i++ ) {
             count[i] = 0;
         }
         
         for( unsigned int ipack = 0 ; ipack < npack_ ; ipack++ ) {
-        
+            
             //int nparts_in_pack = last_index[ (ipack+1) * packsize_-1 ] - first_index [ ipack * packsize_ ];
             int nparts_in_pack = last_index[( ipack+1 ) * packsize_-1 ];
-            smpi->dynamics_resize( ithread, nDim_particle, nparts_in_pack );
+            smpi->dynamics_resize( ithread, nDim_field, nparts_in_pack, isAM_ );
             
 #ifdef  __DETAILED_TIMERS
             timer = MPI_Wtime();
@@ -918,11 +1024,6 @@ void SpeciesV::ponderomotive_update_position_and_currents( double time_dual, uns
             patch->patch_timers[11] += MPI_Wtime() - timer;
             timer = MPI_Wtime();
 #endif
-            unsigned int length[3];
-            length[0]=0;
-            length[1]=params.n_space[1]+1;
-            length[2]=params.n_space[2]+1;
-            
             for( unsigned int scell = 0 ; scell < packsize_ ; scell++ ) {
                 // Apply wall and boundary conditions
                 if( mass>0 ) { // condition mass>0
@@ -944,10 +1045,7 @@ void SpeciesV::ponderomotive_update_position_and_currents( double time_dual, uns
                             particles->cell_keys[iPart] = -1;
                         } else {
                             //First reduction of the count sort algorithm. Lost particles are not included.
-                            for( int i = 0 ; i<( int )nDim_particle; i++ ) {
-                                particles->cell_keys[iPart] *= length[i];
-                                particles->cell_keys[iPart] += round( ( particles->position( i, iPart )-min_loc_vec[i] ) * dx_inv_[i] );
-                            }
+                            particles->cell_keys[iPart] = cellKey( *particles, iPart );
                             count[particles->cell_keys[iPart]] ++; //First reduction of the count sort algorithm. Lost particles are not included.
                         }
                     }
@@ -969,7 +1067,7 @@ void SpeciesV::ponderomotive_update_position_and_currents( double time_dual, uns
                 for( unsigned int scell = 0 ; scell < packsize_ ; scell++ ) {
                     Proj->currentsAndDensityWrapper( EMfields, *particles, smpi, first_index[ipack*packsize_+scell], last_index[ipack*packsize_+scell], ithread, diag_flag, params.is_spectral, ispec, ipack*packsize_+scell, first_index[ipack*packsize_] );
                 }
-                
+            
 #ifdef  __DETAILED_TIMERS
             patch->patch_timers[12] += MPI_Wtime() - timer;
 #endif
@@ -981,9 +1079,9 @@ void SpeciesV::ponderomotive_update_position_and_currents( double time_dual, uns
         
     } else { // immobile particle (at the moment only project density)
         if( diag_flag &&( !particles->is_test ) ) {
-            double *b_rho=nullptr;
+            fdouble *b_rho=nullptr;
             for( unsigned int scell = 0 ; scell < first_index.size() ; scell ++ ) {
-            
+                
                 if( nDim_field==2 ) {
                     b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
                 }
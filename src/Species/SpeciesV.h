@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include <cmath>
 
 #include "Species.h"
 
@@ -32,7 +33,7 @@ public:
 //                      Projector* proj, Params &params, bool diag_flag,
 //                      PartWalls* partWalls, Patch* patch, SmileiMPI* smpi) override;
 //
-
+    
     //! Method calculating the Particle dynamics (interpolation, pusher, projection)
     void dynamics( double time, unsigned int ispec,
                    ElectroMagn *EMfields,
@@ -41,22 +42,29 @@ public:
                    RadiationTables &RadiationTables,
                    MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
                    std::vector<Diagnostic *> &localDiags ) override;
-                   
+    
+    //! Particle dynamics processing one cell at a time from interpolation to projection,
+    //! so that the particles and the operator buffers of the cell stay in cache
+    void fused_dynamics( double time_dual, unsigned int ispec,
+                         ElectroMagn *EMfields,
+                         Params &params, bool diag_flag,
+                         PartWalls *partWalls, Patch *patch, SmileiMPI *smpi );
+    
     //! Method projecting susceptibility and calculating the particles updated momentum (interpolation, momentum pusher), only particles interacting with envelope
     void ponderomotive_update_susceptibility_and_momentum( double time_dual, unsigned int ispec,
             ElectroMagn *EMfields,
             Params &params, bool diag_flag,
             Patch *patch, SmileiMPI *smpi,
             std::vector<Diagnostic *> &localDiags ) override;
-            
+    
     //! Method projecting susceptibility, only particles interacting with envelope
     void ponderomotive_project_susceptibility( double time_dual, unsigned int ispec,
             ElectroMagn *EMfields,
             Params &params, bool diag_flag,
             Patch *patch, SmileiMPI *smpi,
             std::vector<Diagnostic *> &localDiags ) override;
-            
-            
+    
+    
     //! Method calculating the Particle updated position (interpolation, position pusher, only particles interacting with envelope)
     // and projecting charge density and thus current density (through Esirkepov method) for Maxwell's Equations
     void ponderomotive_update_position_and_currents( double time_dual, unsigned int ispec,
@@ -64,7 +72,7 @@ public:
             Params &params, bool diag_flag, PartWalls *partWalls,
             Patch *patch, SmileiMPI *smpi,
             std::vector<Diagnostic *> &localDiags ) override;
-            
+    
     //! Method calculating the Particle charge on the grid (projection)
     void computeCharge( unsigned int ispec, ElectroMagn *EMfields ) override;
     
@@ -87,8 +95,31 @@ public:
     //! Method to import particles in this species while conserving the sorting among bins
     void importParticles( Params &, Patch *, Particles &, std::vector<Diagnostic *> & )override;
     
+protected:
+    
+    //! Index of the cell of the patch containing the particle ipart, used as sorting key
+    //! (cells are located by their longitudinal and radial coordinates in AM geometry)
+    inline int cellKey( Particles &parts, int ipart )
+    {
+        int key;
+        if( isAM_ ) {
+            double r = sqrt( parts.position( 1, ipart )*parts.position( 1, ipart ) + parts.position( 2, ipart )*parts.position( 2, ipart ) );
+            key  = round( ( parts.position( 0, ipart )-min_loc_vec[0] ) * dx_inv_[0] );
+            key  = key * length_[1] + round( ( r-min_loc_vec[1] ) * dx_inv_[1] );
+        } else {
+            key = 0;
+            for( unsigned int i = 0 ; i<nDim_particle; i++ ) {
+                key = key * length_[i] + round( ( parts.position( i, ipart )-min_loc_vec[i] ) * dx_inv_[i] );
+            }
+        }
+        return key;
+    }
+    
+    //! True in AMcylindrical geometry
+    bool isAM_;
+    
 private:
-
+    
     //! Number of packs of particles that divides the total number of particles
     unsigned int npack_;
     //! Size of the pack in number of particles
@@ -96,7 +96,7 @@ void SpeciesVAdaptive::scalar_dynamics( double time_dual, unsigned int ispec,
     if( time_dual>time_frozen || Ionize ) {
         // moving particle
 
-        smpi->dynamics_resize( ithread, nDim_particle, last_index.back() );
+        smpi->dynamics_resize( ithread, nDim_field, last_index.back(), isAM_ );
 
         //Point to local thread dedicated buffers
         //Still needed for ionization
@@ -181,10 +181,6 @@ void SpeciesVAdaptive::scalar_dynamics( double time_dual, unsigned int ispec,
                         first_index[scell],
                         last_index[scell],
                         ithread );
-
-                // Suppression of the decayed photons into pairs
-                Multiphoton_Breit_Wheeler_process->decayed_photon_cleaning(
-                    *particles, smpi, scell, first_index.size(), &first_index[0], &last_index[0], ithread );
 #ifdef  __DETAILED_TIMERS
                 patch->patch_timers[6] += MPI_Wtime() - timer;
 #endif
@@ -223,10 +219,7 @@ void SpeciesVAdaptive::scalar_dynamics( double time_dual, unsigned int ispec,
                         particles->cell_keys[iPart] = -1;
                     } else {
                         //Compute cell_keys of remaining particles
-                        for( unsigned int i = 0 ; i<nDim_particle; i++ ) {
-                            particles->cell_keys[iPart] *= this->length_[i];
-                            particles->cell_keys[iPart] += round( ( particles->position( i, iPart )-min_loc_vec[i] ) * dx_inv_[i] );
-                        }
+                        particles->cell_keys[iPart] = cellKey( *particles, iPart );
                         //First reduction of the count sort algorithm. Lost particles are not included.
                         count[particles->cell_keys[iPart]] ++;
                     }
@@ -246,16 +239,16 @@ void SpeciesVAdaptive::scalar_dynamics( double time_dual, unsigned int ispec,
                 // apply returns 0 if iPart is not in the local domain anymore
                 //        if omp, create a list per thread
                 for( iPart=first_index[scell] ; ( int )iPart<last_index[scell]; iPart++ ) {
-                    if( !partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
+                    // Photons decayed into pairs (weight <= 0) are tombstones: the sort drops them
+                    if( Multiphoton_Breit_Wheeler_process && particles->weight( iPart ) <= 0 ) {
+                        particles->cell_keys[iPart] = -1;
+                    } else if( !partBoundCond->apply( *particles, iPart, this, ener_iPart ) ) {
                         addPartInExchList( iPart );
                         nrj_lost_per_thd[tid] += ener_iPart;
                         particles->cell_keys[iPart] = -1;
                     } else {
                         //Compute cell_keys of remaining particles
-                        for( unsigned int i = 0 ; i<nDim_particle; i++ ) {
-                            particles->cell_keys[iPart] *= this->length_[i];
-                            particles->cell_keys[iPart] += round( ( particles->position( i, iPart )-min_loc_vec[i] ) * dx_inv_[i] );
-                        }
+                        particles->cell_keys[iPart] = cellKey( *particles, iPart );
                         //First reduction of the count sort algorithm. Lost particles are not included.
                         count[particles->cell_keys[iPart]] ++;
                     }
@@ -296,7 +289,7 @@ void SpeciesVAdaptive::scalar_dynamics( double time_dual, unsigned int ispec,
 
     if(time_dual <= time_frozen && diag_flag &&( !particles->is_test ) ) { //immobile particle (at the moment only project density)
 
-        double *b_rho=nullptr;
+        fdouble *b_rho=nullptr;
         for( unsigned int ibin = 0 ; ibin < first_index.size() ; ibin ++ ) { //Loop for projection on buffer_proj
 
             b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
@@ -627,10 +620,7 @@ void SpeciesVAdaptive::scalar_ponderomotive_update_position_and_currents( double
                         particles->cell_keys[iPart] = -1;
                     } else {
                         //Compute cell_keys of remaining particles
-                        for( unsigned int i = 0 ; i<nDim_particle; i++ ) {
-                            particles->cell_keys[iPart] *= this->length_[i];
-                            particles->cell_keys[iPart] += round( ( particles->position( i, iPart )-min_loc_vec[i] ) * dx_inv_[i] );
-                        }
+                        particles->cell_keys[iPart] = cellKey( *particles, iPart );
                         //First reduction of the count sort algorithm. Lost particles are not included.
                         count[particles->cell_keys[iPart]] ++;
                     }
@@ -660,7 +650,7 @@ void SpeciesVAdaptive::scalar_ponderomotive_update_position_and_currents( double
     else { // immobile particle
 
         if( Ionize ) {
-            smpi->dynamics_resize( ithread, nDim_particle, last_index.back() );
+            smpi->dynamics_resize( ithread, nDim_field, last_index.back(), isAM_ );
 
             //Point to local thread dedicated buffers
             //Still needed for ionization
@@ -694,7 +684,7 @@ void SpeciesVAdaptive::scalar_ponderomotive_update_position_and_currents( double
         }// end if ionize
 
         if( diag_flag &&( !particles->is_test ) ) {
-            double *b_rho=nullptr;
+            fdouble *b_rho=nullptr;
             for( unsigned int ibin = 0 ; ibin < first_index.size() ; ibin ++ ) { //Loop for projection on buffer_proj
                 // only 3D is implemented actually
                 if( nDim_field==2 ) {
@@ -106,8 +106,6 @@ void SpeciesVAdaptiveMixedSort::compute_part_cell_keys( Params &params )
 {
 
     unsigned int ip, nparts;
-    int IX;
-    double X;
 
     //Number of particles before exchange
     nparts = particles->size();
@@ -123,11 +121,7 @@ void SpeciesVAdaptiveMixedSort::compute_part_cell_keys( Params &params )
     #pragma omp simd
     for( ip=0; ip < nparts ; ip++ ) {
         // Counts the # of particles in each cell (or sub_cell) and store it in slast_index.
-        for( unsigned int ipos=0; ipos < nDim_particle ; ipos++ ) {
-            X = particles->position( ipos, ip )-min_loc_vec[ipos];
-            IX = round( X * dx_inv_[ipos] );
-            particles->cell_keys[ip] = particles->cell_keys[ip] * this->length_[ipos] + IX;
-        }
+        particles->cell_keys[ip] = cellKey( *particles, ip );
     }
 
     // Reduction of the number of particles per cell in count
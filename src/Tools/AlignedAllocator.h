@@ -0,0 +1,76 @@
+// -----------------------------------------------------------------------------
+//
+//! \file AlignedAllocator.h
+//
+//! \brief Standard-compliant allocator returning memory aligned on a
+//!        given boundary (default: 64 bytes, i.e. one cache line or
+//!        one AVX-512 register), recycled through the MemoryArena
+//
+// -----------------------------------------------------------------------------
+
+#ifndef ALIGNEDALLOCATOR_H
+#define ALIGNEDALLOCATOR_H
+
+#include <cstddef>
+#include <vector>
+
+#include "MemoryArena.h"
+
+//! Alignment (in bytes) of the particle property and field arrays
+#ifndef SMILEI_ALIGNMENT
+#define SMILEI_ALIGNMENT 64
+#endif
+
+template<typename T, std::size_t Alignment = SMILEI_ALIGNMENT>
+class AlignedAllocator
+{
+public:
+    typedef T              value_type;
+    typedef T             *pointer;
+    typedef const T       *const_pointer;
+    typedef T             &reference;
+    typedef const T       &const_reference;
+    typedef std::size_t    size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    //! Non-type template parameters prevent the automatic rebind of allocator_traits
+    template<typename U>
+    struct rebind {
+        typedef AlignedAllocator<U, Alignment> other;
+    };
+
+    AlignedAllocator() {}
+
+    template<typename U>
+    AlignedAllocator( const AlignedAllocator<U, Alignment> & ) {}
+
+    //! Allocate n elements on an Alignment-bytes boundary
+    T *allocate( std::size_t n )
+    {
+        if( n == 0 ) {
+            return nullptr;
+        }
+        return static_cast<T *>( MemoryArena::allocate( n*sizeof( T ), Alignment ) );
+    }
+
+    void deallocate( T *p, std::size_t n )
+    {
+        if( p ) {
+            MemoryArena::deallocate( p, n*sizeof( T ), Alignment );
+        }
+    }
+};
+
+template<typename T, typename U, std::size_t A>
+inline bool operator==( const AlignedAllocator<T, A> &, const AlignedAllocator<U, A> & )
+{
+    return true;
+}
+
+template<typename T, typename U, std::size_t A>
+inline bool operator!=( const AlignedAllocator<T, A> &, const AlignedAllocator<U, A> & )
+{
+    return false;
+}
+
+#endif
@@ -0,0 +1,122 @@
+#include "FFT.h"
+
+#include <cmath>
+
+using namespace std;
+
+FFT::FFT( unsigned int n ) :
+    n_( n )
+{
+    // Length of the radix-2 transforms
+    bool is_power_of_2 = ( n_ & ( n_-1 ) ) == 0;
+    m_ = 1;
+    if( is_power_of_2 ) {
+        m_ = n_;
+    } else {
+        while( m_ < 2*n_-1 ) {
+            m_ *= 2;
+        }
+    }
+    
+    twiddles_.resize( m_/2 );
+    for( unsigned int k=0 ; k<m_/2 ; k++ ) {
+        double angle = -2.*M_PI*( double )k/( double )m_;
+        twiddles_[k] = complex<double>( cos( angle ), sin( angle ) );
+    }
+    
+    unsigned int nbits = 0;
+    while( ( 1u<<nbits ) < m_ ) {
+        nbits++;
+    }
+    bitrev_.resize( m_ );
+    for( unsigned int k=0 ; k<m_ ; k++ ) {
+        unsigned int r = 0;
+        for( unsigned int b=0 ; b<nbits ; b++ ) {
+            r |= ( ( k>>b ) & 1 ) << ( nbits-1-b );
+        }
+        bitrev_[k] = r;
+    }
+    
+    if( !is_power_of_2 ) {
+        // Chirp, the angle being computed from k^2 modulo 2n to keep its accuracy
+        chirp_.resize( n_ );
+        for( unsigned int k=0 ; k<n_ ; k++ ) {
+            unsigned long long k2 = ( ( unsigned long long )k*k ) % ( 2*n_ );
+            double angle = -M_PI*( double )k2/( double )n_;
+            chirp_[k] = complex<double>( cos( angle ), sin( angle ) );
+        }
+        // Transforms of the convolution kernels, conj(chirp) for the forward transform, chirp for the backward one
+        for( unsigned int isign=0 ; isign<2 ; isign++ ) {
+            chirp_fft_[isign].assign( m_, 0. );
+            for( unsigned int k=0 ; k<n_ ; k++ ) {
+                complex<double> b = isign==0 ? conj( chirp_[k] ) : chirp_[k];
+                chirp_fft_[isign][k] = b;
+                if( k>0 ) {
+                    chirp_fft_[isign][m_-k] = b;
+                }
+            }
+            radix2( &chirp_fft_[isign][0], -1 );
+        }
+        work_.resize( m_ );
+    }
+}
+
+void FFT::forward( complex<double> *data )
+{
+    transform( data, -1 );
+}
+
+void FFT::backward( complex<double> *data )
+{
+    transform( data, 1 );
+}
+
+void FFT::transform( complex<double> *data, int sign )
+{
+    if( m_ == n_ ) {
+        radix2( data, sign );
+        return;
+    }
+    
+    // Bluestein : X_k = c_k sum_j ( x_j c_j ) conj( c_(k-j) )
+    vector<complex<double> > &kernel = chirp_fft_[sign<0 ? 0 : 1];
+    for( unsigned int k=0 ; k<n_ ; k++ ) {
+        work_[k] = data[k] * ( sign<0 ? chirp_[k] : conj( chirp_[k] ) );
+    }
+    for( unsigned int k=n_ ; k<m_ ; k++ ) {
+        work_[k] = 0.;
+    }
+    radix2( &work_[0], -1 );
+    for( unsigned int k=0 ; k<m_ ; k++ ) {
+        work_[k] *= kernel[k];
+    }
+    radix2( &work_[0], 1 );
+    double norm = 1./( double )m_;
+    for( unsigned int k=0 ; k<n_ ; k++ ) {
+        data[k] = work_[k] * ( sign<0 ? chirp_[k] : conj( chirp_[k] ) ) * norm;
+    }
+}
+
+void FFT::radix2( complex<double> *data, int sign )
+{
+    for( unsigned int k=0 ; k<m_ ; k++ ) {
+        if( k < bitrev_[k] ) {
+            swap( data[k], data[bitrev_[k]] );
+        }
+    }
+    
+    for( unsigned int len=2 ; len<=m_ ; len*=2 ) {
+        unsigned int half = len/2;
+        unsigned int step = m_/len;
+        for( unsigned int start=0 ; start<m_ ; start+=len ) {
+            for( unsigned int k=0 ; k<half ; k++ ) {
+                complex<double> w = sign<0 ? twiddles_[k*step] : conj( twiddles_[k*step] );
+                complex<double> u = data[start+k];
+                complex<double> v = data[start+k+half] * w;
+                data[start+k]      = u + v;
+                data[start+k+half] = u - v;
+            }
+        }
+    }
+}
+
@@ -0,0 +1,56 @@
+#ifndef FFT_H
+#define FFT_H
+
+#include <complex>
+#include <vector>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class FFT : in-place 1D complex Fourier transform of a given length
+//! Iterative radix-2 transform when the length is a power of 2, Bluestein algorithm otherwise
+//! (the transform is then computed as a convolution with a chirp, using radix-2 transforms of a padded length).
+//! The transforms are not normalized. An instance holds its work buffers and is not thread-safe.
+//  --------------------------------------------------------------------------------------------------------------------
+class FFT
+{
+    
+public:
+    FFT( unsigned int n );
+    ~FFT() {};
+    
+    //! Forward transform ( exp(-i...) ) of n contiguous values
+    void forward( std::complex<double> *data );
+    //! Backward transform ( exp(+i...) ) of n contiguous values
+    void backward( std::complex<double> *data );
+    
+    //! Length of the transform
+    inline unsigned int size()
+    {
+        return n_;
+    }
+    
+private:
+    //! Transform of n values (sign = -1 for forward, +1 for backward)
+    void transform( std::complex<double> *data, int sign );
+    //! Radix-2 transform of m values
+    void radix2( std::complex<double> *data, int sign );
+    
+    //! Length of the transform
+    unsigned int n_;
+    //! Length of the radix-2 transforms (n_, or padded length for Bluestein)
+    unsigned int m_;
+    //! Twiddle factors exp(-2i pi k/m), k<m/2
+    std::vector<std::complex<double> > twiddles_;
+    //! Bit reversal permutation of the radix-2 transforms
+    std::vector<unsigned int> bitrev_;
+    
+    //! Bluestein chirp exp(-i pi k^2/n), k<n
+    std::vector<std::complex<double> > chirp_;
+    //! Transforms of the conjugated chirps for the forward ([0]) and backward ([1]) transforms
+    std::vector<std::complex<double> > chirp_fft_[2];
+    //! Work buffer of the Bluestein algorithm
+    std::vector<std::complex<double> > work_;
+    
+};//END class
+
+#endif
+
@@ -301,8 +301,8 @@ public:
     
     
     //! write any vector
-    template<class T>
-    static void vect( hid_t locationId, std::string name, std::vector<T> v, hid_t type, int deflate=0 )
+    template<class T, class A>
+    static void vect( hid_t locationId, std::string name, std::vector<T, A> v, hid_t type, int deflate=0 )
     {
         vect( locationId, name, v[0], v.size(), type, deflate );
     }
@@ -359,8 +359,8 @@ public:
     }
     
     //! template to read generic 1d vector
-    template<class T>
-    static void getVect( hid_t locationId, std::string vect_name, std::vector<T> &vect, hid_t type, bool resizeVect=false )
+    template<class T, class A>
+    static void getVect( hid_t locationId, std::string vect_name, std::vector<T, A> &vect, hid_t type, bool resizeVect=false )
     {
         hid_t did = H5Dopen( locationId, vect_name.c_str(), H5P_DEFAULT );
         hid_t sid = H5Dget_space( did );
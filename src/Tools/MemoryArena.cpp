@@ -0,0 +1,135 @@
+// -----------------------------------------------------------------------------
+//
+//! \file MemoryArena.cpp
+//
+//! \brief Per-thread caches of aligned memory blocks
+//
+// -----------------------------------------------------------------------------
+
+#include "MemoryArena.h"
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <atomic>
+
+#ifdef __HUGE_PAGES
+#include <sys/mman.h>
+#endif
+
+namespace
+{
+
+//! Blocks smaller than this are all rounded up to it
+const std::size_t min_block_size = 256;
+
+//! Number of size classes: one for the small blocks, then 4 per power of two
+const unsigned int n_size_classes = 1 + 4*( 64-8 );
+
+#ifdef __HUGE_PAGES
+//! Size of the transparent huge pages
+const std::size_t huge_page_size = std::size_t( 2 ) << 20;
+#endif
+
+std::atomic<uint64_t> system_allocations( 0 );
+std::atomic<uint64_t> recycled_allocations( 0 );
+
+//! Size class of a block of `bytes` bytes, and size of the blocks of this class
+unsigned int sizeClass( std::size_t bytes, std::size_t &block_size )
+{
+    if( bytes <= min_block_size ) {
+        block_size = min_block_size;
+        return 0;
+    }
+    // The octave ]2^n, 2^(n+1)] is split in 4 classes
+    unsigned int n = 63 - __builtin_clzll( ( unsigned long long )( bytes-1 ) );
+    std::size_t step = std::size_t( 1 ) << ( n-2 );
+    std::size_t sub  = ( bytes - 1 - ( std::size_t( 1 ) << n ) ) / step;
+    block_size = ( std::size_t( 1 ) << n ) + ( sub+1 ) * step;
+    return 1 + 4*( n-8 ) + sub;
+}
+
+//! Alignment actually used for a block
+std::size_t blockAlignment( std::size_t block_size, std::size_t alignment )
+{
+#ifdef __HUGE_PAGES
+    if( block_size >= huge_page_size ) {
+        return huge_page_size;
+    }
+#endif
+    return alignment < sizeof( void * ) ? sizeof( void * ) : alignment;
+}
+
+//! Cache of the released blocks of one thread
+struct ThreadCache {
+    std::vector<void *> blocks[n_size_classes];
+    std::size_t cached_bytes;
+    
+    ThreadCache() : cached_bytes( 0 ) {}
+    ~ThreadCache();
+};
+
+//! Set once the cache of the thread is destroyed (blocks released afterwards go to the system)
+thread_local bool cache_destroyed = false;
+thread_local ThreadCache cache;
+
+ThreadCache::~ThreadCache()
+{
+    for( unsigned int iclass=0 ; iclass<n_size_classes ; iclass++ ) {
+        for( unsigned int i=0 ; i<blocks[iclass].size() ; i++ ) {
+            free( blocks[iclass][i] );
+        }
+    }
+    cache_destroyed = true;
+}
+
+}
+
+void *MemoryArena::allocate( std::size_t bytes, std::size_t alignment )
+{
+    std::size_t block_size;
+    unsigned int iclass = sizeClass( bytes, block_size );
+    
+    if( !cache_destroyed && !cache.blocks[iclass].empty() ) {
+        void *p = cache.blocks[iclass].back();
+        cache.blocks[iclass].pop_back();
+        cache.cached_bytes -= block_size;
+        recycled_allocations.fetch_add( 1, std::memory_order_relaxed );
+        return p;
+    }
+    
+    void *p = nullptr;
+    if( posix_memalign( &p, blockAlignment( block_size, alignment ), block_size ) != 0 ) {
+        throw std::bad_alloc();
+    }
+#if defined(__HUGE_PAGES) && defined(MADV_HUGEPAGE)
+    if( block_size >= huge_page_size ) {
+        madvise( p, block_size, MADV_HUGEPAGE );
+    }
+#endif
+    system_allocations.fetch_add( 1, std::memory_order_relaxed );
+    return p;
+}
+
+void MemoryArena::deallocate( void *p, std::size_t bytes, std::size_t )
+{
+    std::size_t block_size;
+    unsigned int iclass = sizeClass( bytes, block_size );
+    
+    if( cache_destroyed || cache.cached_bytes + block_size > SMILEI_ARENA_MAX_CACHED_BYTES ) {
+        free( p );
+        return;
+    }
+    cache.blocks[iclass].push_back( p );
+    cache.cached_bytes += block_size;
+}
+
+uint64_t MemoryArena::getSystemAllocations()
+{
+    return system_allocations.load( std::memory_order_relaxed );
+}
+
+uint64_t MemoryArena::getRecycledAllocations()
+{
+    return recycled_allocations.load( std::memory_order_relaxed );
+}
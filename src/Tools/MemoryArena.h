@@ -0,0 +1,46 @@
+// -----------------------------------------------------------------------------
+//
+//! \file MemoryArena.h
+//
+//! \brief Per-thread caches of aligned memory blocks backing the particle
+//!        property arrays (see AlignedAllocator.h)
+//
+// -----------------------------------------------------------------------------
+
+#ifndef MEMORYARENA_H
+#define MEMORYARENA_H
+
+#include <cstddef>
+#include <cstdint>
+
+//! Maximum number of bytes kept by the cache of each thread
+#ifndef SMILEI_ARENA_MAX_CACHED_BYTES
+#define SMILEI_ARENA_MAX_CACHED_BYTES ( std::size_t( 64 ) << 20 )
+#endif
+
+//! Released blocks are not returned to the system but kept in a cache owned
+//! by the releasing thread, sorted by size classes (4 per power of two).
+//! The next allocation of the same class by this thread reuses the block:
+//! the buffers resized at each sort or exchange stop going through malloc,
+//! and a thread keeps reusing pages it touched first (local NUMA node).
+//! Each cache holds at most SMILEI_ARENA_MAX_CACHED_BYTES, which bounds the
+//! memory kept beyond the high-water mark of the simulation.
+//! With config=huge_pages, large blocks are aligned on 2 MB and advised to
+//! the kernel as transparent huge pages.
+class MemoryArena
+{
+public:
+    //! Allocate at least `bytes` bytes aligned on `alignment` bytes
+    static void *allocate( std::size_t bytes, std::size_t alignment );
+    
+    //! Release a block obtained from allocate with the same `bytes` and `alignment`
+    static void deallocate( void *p, std::size_t bytes, std::size_t alignment );
+    
+    //! Number of blocks obtained from the system since the beginning
+    static uint64_t getSystemAllocations();
+    
+    //! Number of blocks reused from the thread caches since the beginning
+    static uint64_t getRecycledAllocations();
+};
+
+#endif
@@ -0,0 +1,41 @@
+#include "SimdDispatch.h"
+
+SimdDispatch::InstructionSet SimdDispatch::detect()
+{
+#ifdef SMILEI_SIMD_DISPATCH
+    __builtin_cpu_init();
+    if( __builtin_cpu_supports( "avx512f" ) && __builtin_cpu_supports( "avx512cd" )
+            && __builtin_cpu_supports( "avx512vl" ) && __builtin_cpu_supports( "avx512bw" )
+            && __builtin_cpu_supports( "avx512dq" ) ) {
+        return avx512;
+    }
+    if( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) ) {
+        return avx2;
+    }
+#endif
+    return generic;
+}
+
+bool SimdDispatch::fromName( std::string name, InstructionSet &isa )
+{
+    if( name == "generic" ) {
+        isa = generic;
+    } else if( name == "avx2" ) {
+        isa = avx2;
+    } else if( name == "avx512" ) {
+        isa = avx512;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::string SimdDispatch::name( InstructionSet isa )
+{
+    if( isa == avx512 ) {
+        return "avx512";
+    } else if( isa == avx2 ) {
+        return "avx2";
+    }
+    return "generic";
+}
@@ -0,0 +1,74 @@
+// -----------------------------------------------------------------------------
+//
+//! \file SimdDispatch.h
+//
+//! \brief Selection at startup of the instruction set used by the
+//!        vectorized particle kernels
+//
+// -----------------------------------------------------------------------------
+
+#ifndef SIMDDISPATCH_H
+#define SIMDDISPATCH_H
+
+#include <string>
+
+//! The hot vectorized kernels (PusherBorisV, Interpolator3D2OrderV,
+//! Projector3D2OrderV) are compiled several times from the same source:
+//! once with the instruction set of the compilation flags, and once for each
+//! of AVX2 and AVX-512 through the target attribute. The instance matching
+//! the processor of each MPI process is selected when the operator is built,
+//! so that a binary compiled for a generic x86-64 target still uses the
+//! widest registers available on every node.
+//! Disabled with config=no_simd_dispatch, with the Intel compiler (use -ax
+//! instead) and on other architectures: all instances are then identical.
+#if defined( __x86_64__ ) && defined( __GNUC__ ) && !defined( __INTEL_COMPILER ) && !defined( __NO_SIMD_DISPATCH )
+#define SMILEI_SIMD_DISPATCH
+#endif
+
+#ifdef SMILEI_SIMD_DISPATCH
+#define SMILEI_TARGET_AVX2   __attribute__( ( target( "avx2,fma" ) ) )
+#ifdef __clang__
+#define SMILEI_TARGET_AVX512 __attribute__( ( target( "avx512f,avx512cd,avx512vl,avx512bw,avx512dq,avx2,fma" ) ) )
+#else
+#define SMILEI_TARGET_AVX512 __attribute__( ( target( "avx512f,avx512cd,avx512vl,avx512bw,avx512dq,avx2,fma,prefer-vector-width=512" ) ) )
+#endif
+#else
+#define SMILEI_TARGET_AVX2
+#define SMILEI_TARGET_AVX512
+#endif
+
+//! Body of a kernel, inlined in each of its instances
+#define SMILEI_KERNEL_INLINE inline __attribute__( ( always_inline ) )
+
+class SimdDispatch
+{
+public:
+    enum InstructionSet {
+        //! Instruction set of the compilation flags
+        generic = 0,
+        avx2,
+        avx512
+    };
+    
+    //! Widest instruction set supported by the processor running this process
+    static InstructionSet detect();
+    
+    //! Parse "generic", "avx2" or "avx512"; returns false if the name is unknown
+    static bool fromName( std::string name, InstructionSet &isa );
+    
+    static std::string name( InstructionSet isa );
+    
+    //! Return the instance of a kernel compiled for the instruction set isa
+    template<typename Kernel>
+    static Kernel select( InstructionSet isa, Kernel generic_kernel, Kernel avx2_kernel, Kernel avx512_kernel )
+    {
+        if( isa == avx512 ) {
+            return avx512_kernel;
+        } else if( isa == avx2 ) {
+            return avx2_kernel;
+        }
+        return generic_kernel;
+    }
+};
+
+#endif
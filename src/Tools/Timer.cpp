@@ -14,6 +14,8 @@ using namespace std;
 Timer::Timer( string name ) :
     name_( name ),
     time_acc_( 0.0 ),
+    counter_acc_( 0.0 ),
+    counter_name_( "" ),
     smpi_( NULL )
 {
     register_timers.resize( 0, 0. );
@@ -93,6 +95,7 @@ void Timer::reboot()
     smpi_->barrier();
     last_start_ =  MPI_Wtime();
     time_acc_ = 0.;
+    counter_acc_ = 0.;
     register_timers.clear();
 }
 
@@ -110,5 +113,8 @@ void Timer::print( double tot )
         } else {
             MESSAGE( 0, "\t" << setw( 20 ) << name_ << "\t" << time_acc_  << "\t" << perc << "%" );
         }
+        if( counter_name_!="" ) {
+            MESSAGE( 0, "\t" << setw( 20 ) << "" << "\t" << ( uint64_t )counter_acc_ << " " << counter_name_ );
+        }
     }
 }
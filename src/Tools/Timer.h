@@ -36,6 +36,11 @@ public:
     {
         return time_acc_;
     }
+    //! Add n items to the counter of the timer
+    inline void addCount( double n )
+    {
+        counter_acc_ += n;
+    }
     //! Print accumulated time in stdout
     void print( double tot );
     //! name of the timer
@@ -52,6 +57,12 @@ public:
     
     std::vector<double> register_timers;
     
+    //! Accumulated number of items processed under this timer
+    double counter_acc_;
+    
+    //! Name of the counted items, empty if the timer has no counter
+    std::string counter_name_;
+    
 #ifdef __DETAILED_TIMERS
     //! Id of the associated timer in the patch timer array
     unsigned int patch_timer_id;
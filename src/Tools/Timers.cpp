@@ -61,6 +61,7 @@ Timers::Timers( SmileiMPI *smpi ) :
     timers.push_back( &envelope );
     timers.push_back( &susceptibility );
     patch_timer_id_start = timers.size()-1;
+    syncPart.counter_name_ = "particles moved by the sort";
 #ifdef __DETAILED_TIMERS
     timers.push_back( &interpolator );
     timers.back()->patch_timer_id = 0;
@@ -219,6 +220,12 @@ std::vector<Timer *> Timers::consolidate( SmileiMPI *smpi, bool final_profile )
         
         delete [] tmp;
         
+        // Counters are summed over all processes
+        double counter_sum( 0. );
+        if( timers[itimer]->counter_name_!="" ) {
+            MPI_Reduce( &( timers[itimer]->counter_acc_ ), &counter_sum, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+        }
+        
         if( ( max>0. ) && ( rk==0 ) && ! smpi->test_mode ) {
             fout.setf( ios::fixed,  ios::floatfield );
             fout << setw( 14 ) << scientific << setprecision( 3 )
@@ -227,11 +234,16 @@ std::vector<Timer *> Timers::consolidate( SmileiMPI *smpi, bool final_profile )
                  << "\t - \t" <<  "Max time =  " << max
                  << "\t - \t" <<  "SD time =  " << sqrt( sig-sum*sum/( double )( sz )/( double )( sz ) )
                  << endl;
+            if( timers[itimer]->counter_name_!="" ) {
+                fout << setw( 14 ) << "" << "\t : " << "Total = " << ( uint64_t )counter_sum << " " << timers[itimer]->counter_name_ << endl;
+            }
         }
         if( ( rk==0 ) && ( final_profile ) ) {
             Timer *newTimer = new Timer( "" );
             newTimer->time_acc_ = avg;
             newTimer->name_ = timers[itimer]->name_;
+            newTimer->counter_acc_ = counter_sum;
+            newTimer->counter_name_ = timers[itimer]->counter_name_;
             avg_timers.push_back( newTimer );
         }
         
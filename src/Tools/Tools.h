@@ -138,5 +138,14 @@ public:
 #define PATH_SEPARATOR "/"
 #endif
 
+//! Type of the values of the real fields (float if compiled with config=single_precision_fields)
+#ifdef __SINGLE_PRECISION_FIELDS
+typedef float fdouble;
+#define MPI_FDOUBLE MPI_FLOAT
+#else
+typedef double fdouble;
+#define MPI_FDOUBLE MPI_DOUBLE
+#endif
+
 
 #endif